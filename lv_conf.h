@@ -220,6 +220,13 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  define LV_GC_INCLUDE "gc.h"                           /*Include Garbage Collector related things*/
 #endif /*LV_ENABLE_GC*/
 
+/*1: Enable `lv_async_post()` to post updates from other threads without locking (needs the atomics of GCC or Clang)*/
+#define LV_USE_ASYNC_QUEUE      1
+#if LV_USE_ASYNC_QUEUE
+#  define LV_ASYNC_QUEUE_SIZE       64    /*Max. number of pending updates. Must be a power of 2.*/
+#  define LV_ASYNC_QUEUE_DATA_SIZE  32    /*Max. size of the data of an update [bytes]*/
+#endif /*LV_USE_ASYNC_QUEUE*/
+
 /*=====================
  *  COMPILER SETTINGS
  *====================*/
@@ -451,6 +458,8 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 #define LV_USE_LIST         1
 
+#define LV_USE_VLIST        1
+
 #define LV_USE_METER        1
 
 #define LV_USE_MSGBOX       1
@@ -17,6 +17,10 @@
 #include LV_DRV_DISP_INCLUDE
 #include LV_DRV_DELAY_INCLUDE
 
+#if USE_SPIDEV
+#include "spidev.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -570,7 +574,11 @@ void GC9A01_flush(struct _disp_drv_t * disp_drv, const lv_area_t * area, lv_colo
   int32_t len = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1) * 2;
 
 	LV_DRV_DISP_CMD_DATA(GC9A01_DATA_MODE);
+#ifdef LV_DRV_DISP_SPI_WR_PIXELS
+  LV_DRV_DISP_SPI_WR_PIXELS(color_p, len / 2);  // Sent in big endian order by the interface
+#else
   LV_DRV_DISP_SPI_WR_ARRAY((char*)color_p, len);
+#endif
 
   LV_DRV_DISP_SPI_CS(1);
   lv_disp_flush_ready(disp_drv);         /* Indicate you are ready with the flushing*/
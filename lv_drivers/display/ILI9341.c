@@ -22,6 +22,14 @@
 #include LV_DRV_DISP_INCLUDE
 #include LV_DRV_DELAY_INCLUDE
 
+#if USE_SPIDEV
+#include "spidev.h"
+#endif
+
+#if USE_FLUSH_THREAD
+#include "flush_thread.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -138,6 +146,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void ili9341_flush_sync(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 static inline void ili9341_write(int mode, uint8_t data);
 static inline void ili9341_write_array(int mode, uint8_t *data, uint16_t len);
 
@@ -329,56 +338,31 @@ void ili9341_init(void)
     ili9341_write(ILI9341_CMD_MODE, ILI9341_DISPON);
 
     LV_DRV_DELAY_MS(20);
+
+#if USE_FLUSH_THREAD
+    flush_thread_init();
+#endif
 }
 
 void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
 {
-    if(area->x2 < 0 || area->y2 < 0 || area->x1 > (ILI9341_HOR_RES - 1) || area->y1 > (ILI9341_VER_RES - 1)) {
-        lv_disp_flush_ready(drv);
-        return;
-    }
-
-    /* Truncate the area to the screen */
-    int32_t act_x1 = area->x1 < 0 ? 0 : area->x1;
-    int32_t act_y1 = area->y1 < 0 ? 0 : area->y1;
-    int32_t act_x2 = area->x2 > ILI9341_HOR_RES - 1 ? ILI9341_HOR_RES - 1 : area->x2;
-    int32_t act_y2 = area->y2 > ILI9341_VER_RES - 1 ? ILI9341_VER_RES - 1 : area->y2;
-
-    int32_t y;
-    uint8_t data[4];
-    int32_t len = len = (act_x2 - act_x1 + 1) * 2;
-    lv_coord_t w = (area->x2 - area->x1) + 1;
-
-    /* window horizontal */
-    ili9341_write(ILI9341_CMD_MODE, ILI9341_CASET);
-    data[0] = act_x1 >> 8;
-    data[1] = act_x1;
-    data[2] = act_x2 >> 8;
-    data[3] = act_x2;
-    ili9341_write_array(ILI9341_DATA_MODE, data, 4);
-
-    /* window vertical */
-    ili9341_write(ILI9341_CMD_MODE,  ILI9341_PASET);
-    data[0] = act_y1 >> 8;
-    data[1] = act_y1;
-    data[2] = act_y2 >> 8;
-    data[3] = act_y2;
-    ili9341_write_array(ILI9341_DATA_MODE, data, 4);
-
-    ili9341_write(ILI9341_CMD_MODE, ILI9341_RAMWR);
-
-    for(y = act_y1; y <= act_y2; y++) {
-        ili9341_write_array(ILI9341_DATA_MODE, (uint8_t *)color_p, len);
-        color_p += w;
-    }
-
-    lv_disp_flush_ready(drv);
+#if USE_FLUSH_THREAD
+    /* Transfer on the flush thread while LVGL renders the next area */
+    flush_thread_submit(ili9341_flush_sync, drv, area, color_p);
+#else
+    ili9341_flush_sync(drv, area, color_p);
+#endif
 }
 
 void ili9341_rotate(int degrees, bool bgr)
 {
     uint8_t color_order = MADCTL_RGB;
 
+#if USE_FLUSH_THREAD
+    /* Don't change the orientation while an area is being sent */
+    flush_thread_wait(NULL);
+#endif
+
     if(bgr)
         color_order = MADCTL_BGR;
 
@@ -429,4 +413,72 @@ static inline void ili9341_write_array(int mode, uint8_t *data, uint16_t len)
     LV_DRV_DISP_SPI_WR_ARRAY(data, len);
 }
 
+/**
+ * Send the pixels of an area to the display and signal the end of flushing
+ * @param drv pointer to driver where this function belongs
+ * @param area an area where to copy `color_p`
+ * @param color_p an array of pixel to copy to the `area` part of the screen
+ */
+static void ili9341_flush_sync(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    if(area->x2 < 0 || area->y2 < 0 || area->x1 > (ILI9341_HOR_RES - 1) || area->y1 > (ILI9341_VER_RES - 1)) {
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
+    /* Truncate the area to the screen */
+    int32_t act_x1 = area->x1 < 0 ? 0 : area->x1;
+    int32_t act_y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t act_x2 = area->x2 > ILI9341_HOR_RES - 1 ? ILI9341_HOR_RES - 1 : area->x2;
+    int32_t act_y2 = area->y2 > ILI9341_VER_RES - 1 ? ILI9341_VER_RES - 1 : area->y2;
+
+    int32_t y;
+    uint8_t data[4];
+    int32_t len = len = (act_x2 - act_x1 + 1) * 2;
+    lv_coord_t w = (area->x2 - area->x1) + 1;
+
+    LV_DRV_DISP_SPI_CS(0);
+
+    /* window horizontal */
+    ili9341_write(ILI9341_CMD_MODE, ILI9341_CASET);
+    data[0] = act_x1 >> 8;
+    data[1] = act_x1;
+    data[2] = act_x2 >> 8;
+    data[3] = act_x2;
+    ili9341_write_array(ILI9341_DATA_MODE, data, 4);
+
+    /* window vertical */
+    ili9341_write(ILI9341_CMD_MODE,  ILI9341_PASET);
+    data[0] = act_y1 >> 8;
+    data[1] = act_y1;
+    data[2] = act_y2 >> 8;
+    data[3] = act_y2;
+    ili9341_write_array(ILI9341_DATA_MODE, data, 4);
+
+    ili9341_write(ILI9341_CMD_MODE, ILI9341_RAMWR);
+
+#ifdef LV_DRV_DISP_SPI_WR_PIXELS
+    /* the interface sends the pixels in big endian order */
+    LV_DRV_DISP_CMD_DATA(ILI9341_DATA_MODE);
+    if(len == w * 2) {
+        /* the lines are contiguous so send them at once */
+        LV_DRV_DISP_SPI_WR_PIXELS(color_p, w * (act_y2 - act_y1 + 1));
+    } else {
+        for(y = act_y1; y <= act_y2; y++) {
+            LV_DRV_DISP_SPI_WR_PIXELS(color_p, len / 2);
+            color_p += w;
+        }
+    }
+#else
+    for(y = act_y1; y <= act_y2; y++) {
+        ili9341_write_array(ILI9341_DATA_MODE, (uint8_t *)color_p, len);
+        color_p += w;
+    }
+#endif
+
+    LV_DRV_DISP_SPI_CS(1);
+
+    lv_disp_flush_ready(drv);
+}
+
 #endif
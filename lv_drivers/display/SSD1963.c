@@ -13,6 +13,10 @@
 #include LV_DRV_DISP_INCLUDE
 #include LV_DRV_DELAY_INCLUDE
 
+#if USE_FLUSH_THREAD
+#include "flush_thread.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -26,6 +30,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void ssd1963_flush_sync(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
 static inline void ssd1963_cmd_mode(void);
 static inline void ssd1963_data_mode(void);
 static inline void ssd1963_cmd(uint8_t cmd);
@@ -145,60 +150,20 @@ void ssd1963_init(void)
     //DisplayBacklightOn();
 
     LV_DRV_DELAY_MS(30);
+
+#if USE_FLUSH_THREAD
+    flush_thread_init();
+#endif
 }
 
 void ssd1963_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
 {
-
-    /*Return if the area is out the screen*/
-    if(area->x2 < 0) return;
-    if(area->y2 < 0) return;
-    if(area->x1 > SSD1963_HOR_RES - 1) return;
-    if(area->y1 > SSD1963_VER_RES - 1) return;
-
-    /*Truncate the area to the screen*/
-    int32_t act_x1 = area->x1 < 0 ? 0 : area->x1;
-    int32_t act_y1 = area->y1 < 0 ? 0 : area->y1;
-    int32_t act_x2 = area->x2 > SSD1963_HOR_RES - 1 ? SSD1963_HOR_RES - 1 : area->x2;
-    int32_t act_y2 = area->y2 > SSD1963_VER_RES - 1 ? SSD1963_VER_RES - 1 : area->y2;
-
-    //Set the rectangular area
-    ssd1963_cmd(0x002A);
-    ssd1963_data(act_x1 >> 8);
-    ssd1963_data(0x00FF & act_x1);
-    ssd1963_data(act_x2 >> 8);
-    ssd1963_data(0x00FF & act_x2);
-
-    ssd1963_cmd(0x002B);
-    ssd1963_data(act_y1 >> 8);
-    ssd1963_data(0x00FF & act_y1);
-    ssd1963_data(act_y2 >> 8);
-    ssd1963_data(0x00FF & act_y2);
-
-    ssd1963_cmd(0x2c);
-    int16_t i;
-    uint16_t full_w = area->x2 - area->x1 + 1;
-
-    ssd1963_data_mode();
-    LV_DRV_DISP_PAR_CS(0);
-#if LV_COLOR_DEPTH == 16
-    uint16_t act_w = act_x2 - act_x1 + 1;
-    for(i = act_y1; i <= act_y2; i++) {
-        LV_DRV_DISP_PAR_WR_ARRAY((uint16_t *)color_p, act_w);
-        color_p += full_w;
-    }
-    LV_DRV_DISP_PAR_CS(1);
+#if USE_FLUSH_THREAD
+    /*Write on the flush thread while LVGL renders the next area*/
+    flush_thread_submit(ssd1963_flush_sync, disp_drv, area, color_p);
 #else
-    int16_t j;
-    for(i = act_y1; i <= act_y2; i++) {
-        for(j = 0; j <= act_x2 - act_x1 + 1; j++) {
-            LV_DRV_DISP_PAR_WR_WORD(color_p[j]);
-            color_p += full_w;
-        }
-    }
+    ssd1963_flush_sync(disp_drv, area, color_p);
 #endif
-
-    lv_disp_flush_ready(disp_drv);
 }
 
 /**********************
@@ -289,4 +254,63 @@ static inline void ssd1963_data(uint8_t data)
 
 }
 
+/**
+ * Write the pixels of an area to the display and signal the end of flushing
+ * @param disp_drv pointer to driver where this function belongs
+ * @param area an area where to copy `color_p`
+ * @param color_p an array of pixel to copy to the `area` part of the screen
+ */
+static void ssd1963_flush_sync(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*Return if the area is out the screen*/
+    if(area->x2 < 0 || area->y2 < 0 || area->x1 > SSD1963_HOR_RES - 1 || area->y1 > SSD1963_VER_RES - 1) {
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+
+    /*Truncate the area to the screen*/
+    int32_t act_x1 = area->x1 < 0 ? 0 : area->x1;
+    int32_t act_y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t act_x2 = area->x2 > SSD1963_HOR_RES - 1 ? SSD1963_HOR_RES - 1 : area->x2;
+    int32_t act_y2 = area->y2 > SSD1963_VER_RES - 1 ? SSD1963_VER_RES - 1 : area->y2;
+
+    //Set the rectangular area
+    ssd1963_cmd(0x002A);
+    ssd1963_data(act_x1 >> 8);
+    ssd1963_data(0x00FF & act_x1);
+    ssd1963_data(act_x2 >> 8);
+    ssd1963_data(0x00FF & act_x2);
+
+    ssd1963_cmd(0x002B);
+    ssd1963_data(act_y1 >> 8);
+    ssd1963_data(0x00FF & act_y1);
+    ssd1963_data(act_y2 >> 8);
+    ssd1963_data(0x00FF & act_y2);
+
+    ssd1963_cmd(0x2c);
+    int16_t i;
+    uint16_t full_w = area->x2 - area->x1 + 1;
+
+    ssd1963_data_mode();
+    LV_DRV_DISP_PAR_CS(0);
+#if LV_COLOR_DEPTH == 16
+    uint16_t act_w = act_x2 - act_x1 + 1;
+    for(i = act_y1; i <= act_y2; i++) {
+        LV_DRV_DISP_PAR_WR_ARRAY((uint16_t *)color_p, act_w);
+        color_p += full_w;
+    }
+    LV_DRV_DISP_PAR_CS(1);
+#else
+    int16_t j;
+    for(i = act_y1; i <= act_y2; i++) {
+        for(j = 0; j <= act_x2 - act_x1 + 1; j++) {
+            LV_DRV_DISP_PAR_WR_WORD(color_p[j]);
+            color_p += full_w;
+        }
+    }
+#endif
+
+    lv_disp_flush_ready(disp_drv);
+}
+
 #endif
@@ -16,6 +16,10 @@
 #include LV_DRV_DISP_INCLUDE
 #include LV_DRV_DELAY_INCLUDE
 
+#if USE_SPIDEV
+#include "spidev.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
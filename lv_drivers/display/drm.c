@@ -27,6 +27,11 @@
 #include <xf86drmMode.h>
 #include <drm_fourcc.h>
 
+#if USE_FLUSH_THREAD
+#include "flush_thread.h"
+#endif
+#include "flush_rotate.h"
+
 #define DBG_TAG "drm"
 
 #define DIV_ROUND_UP(n, d) (((n) + (d) - 1) / (d))
@@ -67,6 +72,9 @@ struct drm_dev {
 	drmModePropertyPtr conn_props[128];
 	struct drm_buffer drm_bufs[2]; /* DUMB buffers */
 	struct drm_buffer *cur_bufs[2]; /* double buffering handling */
+	lv_area_t copy_area; /* area to move in the next frame, see drm_copy() */
+	lv_coord_t copy_dx, copy_dy;
+	int copy_pending;
 } drm_dev;
 
 static uint32_t get_plane_property_id(const char *name)
@@ -117,7 +125,22 @@ static uint32_t get_conn_property_id(const char *name)
 static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec,
 			      unsigned int tv_usec, void *user_data)
 {
+	lv_disp_drv_t *disp_drv = user_data;
+	struct timespec now;
+	int64_t age;
+
 	dbg("flip");
+
+	if (!disp_drv)
+		return;
+
+	/* The event is stamped with CLOCK_MONOTONIC, convert it to the LVGL tick */
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	age = ((int64_t)now.tv_sec - tv_sec) * 1000 + now.tv_nsec / 1000000 - tv_usec / 1000;
+	if (age < 0)
+		age = 0;
+
+	lv_disp_report_present(disp_drv, lv_tick_get() - (uint32_t)age);
 }
 
 static int drm_get_plane_props(void)
@@ -240,7 +263,7 @@ static int drm_add_conn_property(const char *name, uint64_t value)
 	return 0;
 }
 
-static int drm_dmabuf_set_plane(struct drm_buffer *buf)
+static int drm_dmabuf_set_plane(struct drm_buffer *buf, lv_disp_drv_t *disp_drv)
 {
 	int ret;
 	static int first = 1;
@@ -271,7 +294,8 @@ static int drm_dmabuf_set_plane(struct drm_buffer *buf)
 	drm_add_plane_property("CRTC_W", drm_dev.width);
 	drm_add_plane_property("CRTC_H", drm_dev.height);
 
-	ret = drmModeAtomicCommit(drm_dev.fd, drm_dev.req, flags, NULL);
+	/* The driver is passed to page_flip_handler() to report the presentation */
+	ret = drmModeAtomicCommit(drm_dev.fd, drm_dev.req, flags, disp_drv);
 	if (ret) {
 		err("drmModeAtomicCommit failed: %s", strerror(errno));
 		drmModeAtomicFree(drm_dev.req);
@@ -710,30 +734,133 @@ void drm_wait_vsync(lv_disp_drv_t *disp_drv)
 	drm_dev.req = NULL;
 }
 
-void drm_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
+static void drm_buffer_move(struct drm_buffer *buf, const lv_area_t *area, lv_coord_t dx, lv_coord_t dy)
+{
+	int32_t x1 = area->x1, y1 = area->y1, x2 = area->x2, y2 = area->y2;
+	int32_t y, line_cnt;
+	size_t line_size;
+	uint8_t *src, *dest;
+
+	/* The source pixels which remain in the area */
+	if (dx > 0)
+		x2 -= dx;
+	else
+		x1 -= dx;
+	if (dy > 0)
+		y2 -= dy;
+	else
+		y1 -= dy;
+	if (x1 > x2 || y1 > y2)
+		return;
+
+	line_size = (x2 - x1 + 1) * (LV_COLOR_SIZE/8);
+	line_cnt = y2 - y1 + 1;
+	src = (uint8_t *)buf->map + x1 * (LV_COLOR_SIZE/8) + y1 * buf->pitch;
+	dest = src + dx * (LV_COLOR_SIZE/8) + dy * (int32_t)buf->pitch;
+
+	/* Don't overwrite the lines which are not moved yet */
+	if (dy > 0) {
+		src += (line_cnt - 1) * buf->pitch;
+		dest += (line_cnt - 1) * buf->pitch;
+		for (y = 0; y < line_cnt; y++) {
+			memmove(dest, src, line_size);
+			src -= buf->pitch;
+			dest -= buf->pitch;
+		}
+	} else {
+		for (y = 0; y < line_cnt; y++) {
+			memmove(dest, src, line_size);
+			src += buf->pitch;
+			dest += buf->pitch;
+		}
+	}
+}
+
+bool drm_copy(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_coord_t dx, lv_coord_t dy)
+{
+#if USE_FLUSH_THREAD
+	/* The copy state is used by the flush thread */
+	flush_thread_wait(disp_drv);
+#endif
+
+	/* Nothing to move yet or another area is waiting to be moved */
+	if (!drm_dev.cur_bufs[0] || drm_dev.copy_pending)
+		return false;
+
+	if (area->x1 < 0 || area->y1 < 0 || area->x2 >= (int32_t)drm_dev.width || area->y2 >= (int32_t)drm_dev.height)
+		return false;
+
+	/* The front buffer is being scanned out, so move the pixels when the next frame is composed in the back buffer */
+	drm_dev.copy_area = *area;
+	drm_dev.copy_dx = dx;
+	drm_dev.copy_dy = dy;
+	drm_dev.copy_pending = 1;
+
+	return true;
+}
+
+/* Copy a part of a line into the buffer, used by flush_rotate() */
+static void drm_buffer_write_line(void *user_data, int32_t x, int32_t y, const lv_color_t *color_p, uint32_t px_cnt)
+{
+	struct drm_buffer *buf = user_data;
+	int32_t x2 = x + (int32_t)px_cnt - 1;
+
+	if (y < 0 || y >= (int32_t)drm_dev.height)
+		return;
+	if (x < 0) {
+		color_p -= x;
+		x = 0;
+	}
+	if (x2 >= (int32_t)drm_dev.width)
+		x2 = drm_dev.width - 1;
+	if (x > x2)
+		return;
+
+	memcpy((uint8_t *)buf->map + (x * (LV_COLOR_SIZE/8)) + (buf->pitch * y), color_p,
+	       (x2 - x + 1) * (LV_COLOR_SIZE/8));
+}
+
+static void drm_flush_sync(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
 	struct drm_buffer *fbuf = drm_dev.cur_bufs[1];
-	lv_coord_t w = (area->x2 - area->x1 + 1);
-	lv_coord_t h = (area->y2 - area->y1 + 1);
+	lv_area_t rot_area;
+	lv_coord_t w, h;
 	int i, y;
 
-	dbg("x %d:%d y %d:%d w %d h %d", area->x1, area->x2, area->y1, area->y2, w, h);
+	/* The area on the display in its native orientation */
+	if (flush_rotate_is_needed(disp_drv))
+		flush_rotate_area(disp_drv, area, &rot_area);
+	else
+		rot_area = *area;
+	w = (rot_area.x2 - rot_area.x1 + 1);
+	h = (rot_area.y2 - rot_area.y1 + 1);
+
+	dbg("x %d:%d y %d:%d w %d h %d", rot_area.x1, rot_area.x2, rot_area.y1, rot_area.y2, w, h);
 
 	/* Partial update */
-	if ((w != drm_dev.width || h != drm_dev.height) && drm_dev.cur_bufs[0])
+	if ((w != drm_dev.width || h != drm_dev.height) && drm_dev.cur_bufs[0]) {
 		memcpy(fbuf->map, drm_dev.cur_bufs[0]->map, fbuf->size);
+		if (drm_dev.copy_pending)
+			drm_buffer_move(fbuf, &drm_dev.copy_area, drm_dev.copy_dx, drm_dev.copy_dy);
+	}
+	drm_dev.copy_pending = 0;
 
-	for (y = 0, i = area->y1 ; i <= area->y2 ; ++i, ++y) {
-                memcpy((uint8_t *)fbuf->map + (area->x1 * (LV_COLOR_SIZE/8)) + (fbuf->pitch * i),
-                       (uint8_t *)color_p + (w * (LV_COLOR_SIZE/8) * y),
-		       w * (LV_COLOR_SIZE/8));
+	if (flush_rotate_is_needed(disp_drv)) {
+		/* Rotate in cache sized tiles while copying instead of rotating into a buffer first */
+		flush_rotate(disp_drv, area, color_p, drm_buffer_write_line, fbuf);
+	} else {
+		for (y = 0, i = area->y1 ; i <= area->y2 ; ++i, ++y) {
+			memcpy((uint8_t *)fbuf->map + (area->x1 * (LV_COLOR_SIZE/8)) + (fbuf->pitch * i),
+			       (uint8_t *)color_p + (w * (LV_COLOR_SIZE/8) * y),
+			       w * (LV_COLOR_SIZE/8));
+		}
 	}
 
 	if (drm_dev.req)
 		drm_wait_vsync(disp_drv);
 
 	/* show fbuf plane */
-	if (drm_dmabuf_set_plane(fbuf)) {
+	if (drm_dmabuf_set_plane(fbuf, disp_drv)) {
 		err("Flush fail");
 		return;
 	}
@@ -750,6 +877,16 @@ void drm_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color
 	lv_disp_flush_ready(disp_drv);
 }
 
+void drm_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
+{
+#if USE_FLUSH_THREAD
+	/* Copy, wait for the vsync and flip on the flush thread while LVGL renders the next frame */
+	flush_thread_submit(drm_flush_sync, disp_drv, area, color_p);
+#else
+	drm_flush_sync(disp_drv, area, color_p);
+#endif
+}
+
 #if LV_COLOR_DEPTH == 32
 #define DRM_FOURCC DRM_FORMAT_ARGB8888
 #elif LV_COLOR_DEPTH == 16
@@ -790,10 +927,17 @@ void drm_init(void)
 	}
 
 	info("DRM subsystem and buffer mapped successfully");
+
+#if USE_FLUSH_THREAD
+	flush_thread_init();
+#endif
 }
 
 void drm_exit(void)
 {
+#if USE_FLUSH_THREAD
+	flush_thread_wait(NULL);
+#endif
 	close(drm_dev.fd);
 	drm_dev.fd = -1;
 }
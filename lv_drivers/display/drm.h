@@ -44,6 +44,7 @@ void drm_init(void);
 void drm_get_sizes(lv_coord_t *width, lv_coord_t *height, uint32_t *dpi);
 void drm_exit(void);
 void drm_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+bool drm_copy(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
 void drm_wait_vsync(lv_disp_drv_t * drv);
 
 
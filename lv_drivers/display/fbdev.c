@@ -26,6 +26,11 @@
 #include <linux/fb.h>
 #endif /* USE_BSD_FBDEV */
 
+#if USE_FLUSH_THREAD
+#include "flush_thread.h"
+#endif
+#include "flush_rotate.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -33,10 +38,27 @@
 #define FBDEV_PATH  "/dev/fb0"
 #endif
 
+#ifndef FBDEV_VSYNC
+#define FBDEV_VSYNC 0
+#endif
+
+#ifndef FBDEV_DITHER
+#define FBDEV_DITHER 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Convert a line of pixels to the format of the frame buffer. `x` and `y` are the screen coordinates of the first pixel.*/
+typedef void (*fbdev_conv_t)(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+
+/*Position of a color channel in a pixel of the frame buffer*/
+typedef struct {
+    uint8_t offset;
+    uint8_t length;
+} fbdev_channel_t;
+
 /**********************
  *      STRUCTURES
  **********************/
@@ -57,6 +79,20 @@ struct bsd_fb_fix_info{
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void fbdev_flush_sync(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static void fbdev_flush_done(lv_disp_drv_t * drv);
+static void fbdev_write_line(void * user_data, int32_t x, int32_t y, const lv_color_t * color_p, uint32_t px_cnt);
+static void fbdev_select_conv(void);
+static bool fbdev_channels_are(uint8_t r_ofs, uint8_t g_ofs, uint8_t b_ofs, uint8_t r_len, uint8_t g_len, uint8_t b_len);
+static void conv_copy(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+#if LV_COLOR_DEPTH == 32
+static void conv_xbgr8888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+static void conv_rgb888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+static void conv_bgr888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+static void conv_rgb565(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+static void conv_bgr565(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
+#endif
+static void conv_generic(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y);
 
 /**********************
  *  STATIC VARIABLES
@@ -71,6 +107,19 @@ static struct fb_fix_screeninfo finfo;
 static char *fbp = 0;
 static long int screensize = 0;
 static int fbfd = 0;
+static fbdev_conv_t px_conv;            /*Converts the pixels of LVGL to the frame buffer, NULL for 8 and 1 bpp*/
+static uint32_t px_size;                /*Bytes per pixel in the frame buffer*/
+static fbdev_channel_t channels[3];     /*Red, green and blue channels of the frame buffer*/
+
+#if LV_COLOR_DEPTH == 32 && FBDEV_DITHER
+/*4x4 ordered dithering thresholds (Bayer matrix)*/
+static const uint8_t dither_4x4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+#endif
 
 /**********************
  *      MACROS
@@ -140,6 +189,8 @@ void fbdev_init(void)
 
     printf("%dx%d, %dbpp\n", vinfo.xres, vinfo.yres, vinfo.bits_per_pixel);
 
+    fbdev_select_conv();
+
     // Figure out the size of the screen in bytes
     screensize =  finfo.smem_len; //finfo.line_length * vinfo.yres;    
 
@@ -153,10 +204,16 @@ void fbdev_init(void)
 
     printf("The framebuffer device was mapped to memory successfully.\n");
 
+#if USE_FLUSH_THREAD
+    flush_thread_init();
+#endif
 }
 
 void fbdev_exit(void)
 {
+#if USE_FLUSH_THREAD
+    flush_thread_wait(NULL);
+#endif
     close(fbfd);
 }
 
@@ -168,6 +225,101 @@ void fbdev_exit(void)
  */
 void fbdev_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
 {
+#if USE_FLUSH_THREAD
+    /*Copy on the flush thread while LVGL renders the next area*/
+    flush_thread_submit(fbdev_flush_sync, drv, area, color_p);
+#else
+    fbdev_flush_sync(drv, area, color_p);
+#endif
+}
+
+/**
+ * Move the pixels of an area on the screen. Can be used as `copy_cb` of the display driver
+ * to scroll without redrawing the whole content.
+ * @param drv pointer to driver where this function belongs
+ * @param area the area whose pixels are moved
+ * @param dx horizontal movement
+ * @param dy vertical movement
+ * @return true: the pixels are moved; false: not supported
+ */
+bool fbdev_copy(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+    LV_UNUSED(drv);
+
+#if USE_FLUSH_THREAD
+    /*Move the pixels only after the areas being flushed are written*/
+    flush_thread_wait(NULL);
+#endif
+
+    /*The pixels of 1 bpp frame buffers are not byte aligned*/
+    if(px_size == 0 || fbp == NULL) return false;
+
+    /*Truncate the area to the screen*/
+    int32_t x1 = area->x1 < 0 ? 0 : area->x1;
+    int32_t y1 = area->y1 < 0 ? 0 : area->y1;
+    int32_t x2 = area->x2 > (int32_t)vinfo.xres - 1 ? (int32_t)vinfo.xres - 1 : area->x2;
+    int32_t y2 = area->y2 > (int32_t)vinfo.yres - 1 ? (int32_t)vinfo.yres - 1 : area->y2;
+
+    /*The source pixels which remain in the area*/
+    if(dx > 0) x2 -= dx;
+    else x1 -= dx;
+    if(dy > 0) y2 -= dy;
+    else y1 -= dy;
+    if(x1 > x2 || y1 > y2) return true;
+
+    size_t line_size = (x2 - x1 + 1) * px_size;
+    long int src_ofs = (x1 + vinfo.xoffset) * px_size + (y1 + vinfo.yoffset) * finfo.line_length;
+    long int dest_ofs = src_ofs + dx * (long int)px_size + dy * (long int)finfo.line_length;
+    int32_t line_cnt = y2 - y1 + 1;
+    int32_t y;
+
+    /*Don't overwrite the lines which are not moved yet*/
+    if(dy > 0) {
+        src_ofs += (line_cnt - 1) * finfo.line_length;
+        dest_ofs += (line_cnt - 1) * finfo.line_length;
+        for(y = 0; y < line_cnt; y++) {
+            memmove(fbp + dest_ofs, fbp + src_ofs, line_size);
+            src_ofs -= finfo.line_length;
+            dest_ofs -= finfo.line_length;
+        }
+    } else {
+        for(y = 0; y < line_cnt; y++) {
+            memmove(fbp + dest_ofs, fbp + src_ofs, line_size);
+            src_ofs += finfo.line_length;
+            dest_ofs += finfo.line_length;
+        }
+    }
+
+    return true;
+}
+
+void fbdev_get_sizes(uint32_t *width, uint32_t *height) {
+    if (width)
+        *width = vinfo.xres;
+
+    if (height)
+        *height = vinfo.yres;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Copy the pixels to the frame buffer and signal the end of flushing
+ * @param drv pointer to driver where this function belongs
+ * @param area an area where to copy `color_p`
+ * @param color_p an array of pixel to copy to the `area` part of the screen
+ */
+static void fbdev_flush_sync(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*Rotate while writing to the frame buffer instead of rotating into a buffer first*/
+    if(flush_rotate_is_needed(drv)) {
+        if(fbp != NULL) flush_rotate(drv, area, color_p, fbdev_write_line, NULL);
+        fbdev_flush_done(drv);
+        return;
+    }
+
     if(fbp == NULL ||
             area->x2 < 0 ||
             area->y2 < 0 ||
@@ -189,23 +341,13 @@ void fbdev_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color
     long int byte_location = 0;
     unsigned char bit_location = 0;
 
-    /*32 or 24 bit per pixel*/
-    if(vinfo.bits_per_pixel == 32 || vinfo.bits_per_pixel == 24) {
-        uint32_t * fbp32 = (uint32_t *)fbp;
-        int32_t y;
-        for(y = act_y1; y <= act_y2; y++) {
-            location = (act_x1 + vinfo.xoffset) + (y + vinfo.yoffset) * finfo.line_length / 4;
-            memcpy(&fbp32[location], (uint32_t *)color_p, (act_x2 - act_x1 + 1) * 4);
-            color_p += w;
-        }
-    }
-    /*16 bit per pixel*/
-    else if(vinfo.bits_per_pixel == 16) {
-        uint16_t * fbp16 = (uint16_t *)fbp;
+    /*32, 24 or 16 bit per pixel: copy or convert the lines*/
+    if(px_conv) {
+        uint8_t * dest = (uint8_t *)fbp + (act_x1 + vinfo.xoffset) * px_size + (act_y1 + vinfo.yoffset) * finfo.line_length;
         int32_t y;
         for(y = act_y1; y <= act_y2; y++) {
-            location = (act_x1 + vinfo.xoffset) + (y + vinfo.yoffset) * finfo.line_length / 2;
-            memcpy(&fbp16[location], (uint32_t *)color_p, (act_x2 - act_x1 + 1) * 2);
+            px_conv(dest, color_p, w, act_x1, y);
+            dest += finfo.line_length;
             color_p += w;
         }
     }
@@ -243,19 +385,277 @@ void fbdev_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color
     //May be some direct update command is required
     //ret = ioctl(state->fd, FBIO_UPDATE, (unsigned long)((uintptr_t)rect));
 
+    fbdev_flush_done(drv);
+}
+
+/**
+ * Wait for the vertical sync after the last area if enabled and signal the end of flushing
+ * @param drv pointer to driver where this function belongs
+ */
+static void fbdev_flush_done(lv_disp_drv_t * drv)
+{
+#if FBDEV_VSYNC && defined(FBIO_WAITFORVSYNC)
+    /*The new frame is visible from the next vertical sync. Not all drivers support waiting for it.*/
+    static bool vsync_failed = false;
+    if(!vsync_failed && lv_disp_flush_is_last(drv)) {
+        uint32_t crtc = 0;
+        if(ioctl(fbfd, FBIO_WAITFORVSYNC, &crtc) == 0) {
+            lv_disp_report_present(drv, lv_tick_get());
+        } else {
+            perror("ioctl(FBIO_WAITFORVSYNC)");
+            vsync_failed = true;
+        }
+    }
+#endif
+
     lv_disp_flush_ready(drv);
 }
 
-void fbdev_get_sizes(uint32_t *width, uint32_t *height) {
-    if (width)
-        *width = vinfo.xres;
+/**
+ * Write a part of a line into the frame buffer in any supported format. Used by `flush_rotate()`.
+ * @param user_data not used
+ * @param x the first pixel on the screen
+ * @param y the line on the screen
+ * @param color_p the pixels in the order of the screen
+ * @param px_cnt number of pixels
+ */
+static void fbdev_write_line(void * user_data, int32_t x, int32_t y, const lv_color_t * color_p, uint32_t px_cnt)
+{
+    LV_UNUSED(user_data);
+
+    /*Truncate the line to the screen*/
+    int32_t x2 = x + (int32_t)px_cnt - 1;
+    if(y < 0 || y > (int32_t)vinfo.yres - 1) return;
+    if(x < 0) {
+        color_p -= x;
+        x = 0;
+    }
+    if(x2 > (int32_t)vinfo.xres - 1) x2 = (int32_t)vinfo.xres - 1;
+    if(x > x2) return;
 
-    if (height)
-        *height = vinfo.yres;
+    /*32, 24 or 16 bit per pixel*/
+    if(px_conv) {
+        uint8_t * dest = (uint8_t *)fbp + (x + vinfo.xoffset) * px_size + (y + vinfo.yoffset) * finfo.line_length;
+        px_conv(dest, color_p, x2 - x + 1, x, y);
+    }
+    /*8 bit per pixel*/
+    else if(vinfo.bits_per_pixel == 8) {
+        uint8_t * dest = (uint8_t *)fbp + (x + vinfo.xoffset) + (y + vinfo.yoffset) * finfo.line_length;
+        memcpy(dest, color_p, x2 - x + 1);
+    }
+    /*1 bit per pixel*/
+    else if(vinfo.bits_per_pixel == 1) {
+        uint8_t * fbp8 = (uint8_t *)fbp;
+        for(; x <= x2; x++) {
+            long int location = (x + vinfo.xoffset) + (y + vinfo.yoffset) * vinfo.xres;
+            fbp8[location / 8] &= ~(((uint8_t)(1)) << (location % 8));
+            fbp8[location / 8] |= ((uint8_t)(color_p->full)) << (location % 8);
+            color_p++;
+        }
+    }
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Select the conversion of the pixels to the format of the frame buffer
+ */
+static void fbdev_select_conv(void)
+{
+#if USE_BSD_FBDEV
+    /*The channels are not reported, assume the usual formats*/
+    if(vinfo.bits_per_pixel == 16) {
+        channels[0].offset = 11; channels[0].length = 5;
+        channels[1].offset = 5;  channels[1].length = 6;
+        channels[2].offset = 0;  channels[2].length = 5;
+    } else {
+        channels[0].offset = 16; channels[0].length = 8;
+        channels[1].offset = 8;  channels[1].length = 8;
+        channels[2].offset = 0;  channels[2].length = 8;
+    }
+#else
+    channels[0].offset = vinfo.red.offset;   channels[0].length = vinfo.red.length;
+    channels[1].offset = vinfo.green.offset; channels[1].length = vinfo.green.length;
+    channels[2].offset = vinfo.blue.offset;  channels[2].length = vinfo.blue.length;
+#endif
+
+    px_conv = NULL;
+    px_size = 0;
+    if(vinfo.bits_per_pixel == 8) px_size = 1;
+    if(vinfo.bits_per_pixel != 32 && vinfo.bits_per_pixel != 24 && vinfo.bits_per_pixel != 16) return;
+
+    px_size = vinfo.bits_per_pixel / 8;
+    px_conv = conv_generic;
+
+    if(vinfo.bits_per_pixel == LV_COLOR_DEPTH) {
+#if LV_COLOR_DEPTH == 32
+        if(fbdev_channels_are(16, 8, 0, 8, 8, 8)) px_conv = conv_copy;
+        else if(fbdev_channels_are(0, 8, 16, 8, 8, 8)) px_conv = conv_xbgr8888;
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+        if(fbdev_channels_are(11, 5, 0, 5, 6, 5)) px_conv = conv_copy;
+#endif
+    }
+#if LV_COLOR_DEPTH == 32
+    else if(vinfo.bits_per_pixel == 24) {
+        if(fbdev_channels_are(16, 8, 0, 8, 8, 8)) px_conv = conv_rgb888;
+        else if(fbdev_channels_are(0, 8, 16, 8, 8, 8)) px_conv = conv_bgr888;
+    }
+    else if(vinfo.bits_per_pixel == 16) {
+        if(fbdev_channels_are(11, 5, 0, 5, 6, 5)) px_conv = conv_rgb565;
+        else if(fbdev_channels_are(0, 5, 11, 5, 6, 5)) px_conv = conv_bgr565;
+    }
+#endif
+
+    if(px_conv == conv_generic) {
+        printf("Converting the pixels to R%d@%d G%d@%d B%d@%d\n", channels[0].length, channels[0].offset,
+               channels[1].length, channels[1].offset, channels[2].length, channels[2].offset);
+    }
+}
+
+/**
+ * Check the channels of the frame buffer
+ * @return true: the offsets and lengths of the channels are the given ones
+ */
+static bool fbdev_channels_are(uint8_t r_ofs, uint8_t g_ofs, uint8_t b_ofs, uint8_t r_len, uint8_t g_len, uint8_t b_len)
+{
+    return channels[0].offset == r_ofs && channels[1].offset == g_ofs && channels[2].offset == b_ofs &&
+           channels[0].length == r_len && channels[1].length == g_len && channels[2].length == b_len;
+}
+
+/**
+ * The frame buffer has the format of LVGL
+ */
+static void conv_copy(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+
+    memcpy(dest, src, px_cnt * sizeof(lv_color_t));
+}
+
+#if LV_COLOR_DEPTH == 32
+
+/*The loops below are simple enough to be vectorized by the compiler*/
+
+/**
+ * ARGB8888 to ABGR8888 (XBGR8888)
+ */
+static void conv_xbgr8888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+
+    uint32_t * d = (uint32_t *)dest;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t c = src[i].full;
+        d[i] = (c & 0xFF00FF00) | ((c >> 16) & 0xFF) | ((c & 0xFF) << 16);
+    }
+}
+
+/**
+ * ARGB8888 to packed RGB888 (blue on the lowest address)
+ */
+static void conv_rgb888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        dest[3 * i] = src[i].ch.blue;
+        dest[3 * i + 1] = src[i].ch.green;
+        dest[3 * i + 2] = src[i].ch.red;
+    }
+}
+
+/**
+ * ARGB8888 to packed BGR888 (red on the lowest address)
+ */
+static void conv_bgr888(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        dest[3 * i] = src[i].ch.red;
+        dest[3 * i + 1] = src[i].ch.green;
+        dest[3 * i + 2] = src[i].ch.blue;
+    }
+}
+
+/**
+ * ARGB8888 to RGB565, dithered if `FBDEV_DITHER` is enabled
+ */
+static void conv_rgb565(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    uint16_t * d = (uint16_t *)dest;
+    uint32_t i;
+#if FBDEV_DITHER
+    /*Add a threshold below one step of the channel before truncating it*/
+    const uint8_t * th = dither_4x4[y & 0x3];
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t t = th[(x + i) & 0x3];
+        uint32_t r = src[i].ch.red + (t >> 1);
+        uint32_t g = src[i].ch.green + (t >> 2);
+        uint32_t b = src[i].ch.blue + (t >> 1);
+        r = r > 0xFF ? 0xFF : r;
+        g = g > 0xFF ? 0xFF : g;
+        b = b > 0xFF ? 0xFF : b;
+        d[i] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+#else
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+    for(i = 0; i < px_cnt; i++) {
+        d[i] = ((src[i].ch.red & 0xF8) << 8) | ((src[i].ch.green & 0xFC) << 3) | (src[i].ch.blue >> 3);
+    }
+#endif
+}
+
+/**
+ * ARGB8888 to BGR565
+ */
+static void conv_bgr565(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    /*Convert to RGB565 and swap the red and blue channels*/
+    conv_rgb565(dest, src, px_cnt, x, y);
+
+    uint16_t * d = (uint16_t *)dest;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint16_t c = d[i];
+        d[i] = (c & 0x07E0) | (c >> 11) | ((c & 0x1F) << 11);
+    }
+}
+
+#endif /*LV_COLOR_DEPTH == 32*/
+
+/**
+ * Any color format to any channel layout described by `channels`
+ */
+static void conv_generic(uint8_t * dest, const lv_color_t * src, uint32_t px_cnt, int32_t x, int32_t y)
+{
+    LV_UNUSED(x);
+    LV_UNUSED(y);
+
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t c = lv_color_to32(src[i]);
+        uint32_t ch8[3] = {(c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF};
+        uint32_t v = 0;
+        uint32_t j;
+        for(j = 0; j < 3; j++) {
+            if(channels[j].length == 0 || channels[j].length > 8) continue;
+            v |= (ch8[j] >> (8 - channels[j].length)) << channels[j].offset;
+        }
+
+        /*Little endian*/
+        for(j = 0; j < px_size; j++) {
+            dest[j] = v & 0xFF;
+            v >>= 8;
+        }
+        dest += px_size;
+    }
+}
 
 #endif
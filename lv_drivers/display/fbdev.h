@@ -43,6 +43,7 @@ extern "C" {
 void fbdev_init(void);
 void fbdev_exit(void);
 void fbdev_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+bool fbdev_copy(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
 void fbdev_get_sizes(uint32_t *width, uint32_t *height);
 
 
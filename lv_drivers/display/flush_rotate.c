@@ -0,0 +1,170 @@
+/**
+ * @file flush_rotate.c
+ * Rotate the rendered areas while they are written to the display
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "flush_rotate.h"
+#if USE_FBDEV || USE_BSD_FBDEV || USE_DRM
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Side of the tiles in pixels. A tile (4 kB with 32 bit colors) and the lines it's read from should fit into the L1 cache.*/
+#ifndef FLUSH_ROTATE_TILE
+#define FLUSH_ROTATE_TILE   32
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline void transpose_tile(lv_color_t * tile, const lv_color_t * src, int32_t stride, int32_t tw, int32_t th,
+                                  bool reverse);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Not on the stack because of its size. The areas are flushed one by one, on the flush thread if enabled.*/
+static lv_color_t tile_buf[FLUSH_ROTATE_TILE * FLUSH_ROTATE_TILE];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool flush_rotate_is_needed(const lv_disp_drv_t * drv)
+{
+    return drv->rotated != LV_DISP_ROT_NONE && drv->sw_rotate == 0;
+}
+
+void flush_rotate_area(const lv_disp_drv_t * drv, const lv_area_t * area, lv_area_t * res)
+{
+    switch(drv->rotated) {
+        case LV_DISP_ROT_90:
+            res->x1 = area->y1;
+            res->x2 = area->y2;
+            res->y1 = drv->ver_res - 1 - area->x2;
+            res->y2 = drv->ver_res - 1 - area->x1;
+            break;
+        case LV_DISP_ROT_180:
+            res->x1 = drv->hor_res - 1 - area->x2;
+            res->x2 = drv->hor_res - 1 - area->x1;
+            res->y1 = drv->ver_res - 1 - area->y2;
+            res->y2 = drv->ver_res - 1 - area->y1;
+            break;
+        case LV_DISP_ROT_270:
+            res->x1 = drv->hor_res - 1 - area->y2;
+            res->x2 = drv->hor_res - 1 - area->y1;
+            res->y1 = area->x1;
+            res->y2 = area->x2;
+            break;
+        default:
+            *res = *area;
+            break;
+    }
+}
+
+void flush_rotate(const lv_disp_drv_t * drv, const lv_area_t * area, const lv_color_t * color_p,
+                  flush_rotate_write_cb_t write_cb, void * user_data)
+{
+    lv_area_t rot_area;
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    int32_t x;
+    int32_t y;
+
+    flush_rotate_area(drv, area, &rot_area);
+
+    if(drv->rotated == LV_DISP_ROT_NONE) {
+        for(y = 0; y < h; y++) {
+            write_cb(user_data, rot_area.x1, rot_area.y1 + y, color_p, w);
+            color_p += w;
+        }
+    }
+    else if(drv->rotated == LV_DISP_ROT_180) {
+        /*The last line of the area is the first one on the display and the lines are mirrored*/
+        for(y = 0; y < h; y++) {
+            const lv_color_t * line_end = color_p + (h - y) * w;
+            for(x = 0; x < w; x += FLUSH_ROTATE_TILE) {
+                int32_t n = LV_MIN(FLUSH_ROTATE_TILE, w - x);
+                int32_t i;
+                for(i = 0; i < n; i++) {
+                    tile_buf[i] = line_end[-1 - x - i];
+                }
+                write_cb(user_data, rot_area.x1 + x, rot_area.y1 + y, tile_buf, n);
+            }
+        }
+    }
+    else {
+        /* Go through the area in tiles: read `th` lines of `tw` pixels and transpose them.
+         * Every column of the area becomes a line on the display, so a column of the tile is
+         * `th` consecutive pixels of a line. The tiles next to each other on the display are
+         * written after each other to keep the lines of the display in the cache too.*/
+        bool rot_90 = drv->rotated == LV_DISP_ROT_90;
+        int32_t tx;
+        int32_t ty;
+        for(tx = 0; tx < w; tx += FLUSH_ROTATE_TILE) {
+            int32_t tw = LV_MIN(FLUSH_ROTATE_TILE, w - tx);
+            for(ty = 0; ty < h; ty += FLUSH_ROTATE_TILE) {
+                int32_t th = LV_MIN(FLUSH_ROTATE_TILE, h - ty);
+                const lv_color_t * src = color_p + ty * w + tx;
+
+                /*Let the compiler unroll and vectorize the full tiles with constant sizes*/
+                if(tw == FLUSH_ROTATE_TILE && th == FLUSH_ROTATE_TILE) {
+                    transpose_tile(tile_buf, src, w, FLUSH_ROTATE_TILE, FLUSH_ROTATE_TILE, !rot_90);
+                }
+                else {
+                    transpose_tile(tile_buf, src, w, tw, th, !rot_90);
+                }
+
+                int32_t i;
+                for(i = 0; i < tw; i++) {
+                    if(rot_90) {
+                        write_cb(user_data, rot_area.x1 + ty, rot_area.y2 - tx - i, &tile_buf[i * FLUSH_ROTATE_TILE], th);
+                    }
+                    else {
+                        write_cb(user_data, rot_area.x2 - ty - th + 1, rot_area.y1 + tx + i, &tile_buf[i * FLUSH_ROTATE_TILE], th);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Transpose a block of pixels into a tile
+ * @param tile store the columns of the block as the lines of the tile here
+ * @param src the top left pixel of the block
+ * @param stride the number of pixels in a line of `src`
+ * @param tw width of the block
+ * @param th height of the block
+ * @param reverse true: reverse the order of the pixels in the lines of the tile (270 degrees)
+ */
+static inline void transpose_tile(lv_color_t * tile, const lv_color_t * src, int32_t stride, int32_t tw, int32_t th,
+                                  bool reverse)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < th; y++) {
+        lv_color_t * dest = tile + (reverse ? th - 1 - y : y);
+        for(x = 0; x < tw; x++) {
+            dest[x * FLUSH_ROTATE_TILE] = src[x];
+        }
+        src += stride;
+    }
+}
+
+#endif
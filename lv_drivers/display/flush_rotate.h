@@ -0,0 +1,88 @@
+/**
+ * @file flush_rotate.h
+ *
+ */
+
+#ifndef FLUSH_ROTATE_H
+#define FLUSH_ROTATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifndef LV_DRV_NO_CONF
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_drv_conf.h"
+#else
+#include "../../lv_drv_conf.h"
+#endif
+#endif
+
+#if USE_FBDEV || USE_BSD_FBDEV || USE_DRM
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Write a part of a line to the display. `x` and `y` are in the native orientation of the display
+ *and the pixels are in the order of the display too.*/
+typedef void (*flush_rotate_write_cb_t)(void * user_data, int32_t x, int32_t y, const lv_color_t * color_p,
+                                        uint32_t px_cnt);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Check whether the flush function should rotate the areas.
+ * It's the case if the display is rotated and software rotation of LVGL is disabled (`sw_rotate = 0`).
+ * @param drv pointer to the display driver
+ * @return true: the areas need to be rotated
+ */
+bool flush_rotate_is_needed(const lv_disp_drv_t * drv);
+
+/**
+ * Get where an area of LVGL is on the display in its native orientation
+ * @param drv pointer to the display driver
+ * @param area an area in the rotated coordinates of LVGL
+ * @param res store the rotated area here
+ */
+void flush_rotate_area(const lv_disp_drv_t * drv, const lv_area_t * area, lv_area_t * res);
+
+/**
+ * Rotate the pixels of an area to the native orientation of the display while passing them to `write_cb`.
+ * 90 and 270 degrees are transposed in small tiles which stay in the cache, so there is no need for a rotated copy
+ * of the whole area.
+ * @param drv pointer to the display driver
+ * @param area the area to flush in the rotated coordinates of LVGL
+ * @param color_p the rendered pixels of the area
+ * @param write_cb called with the parts of the lines of the display
+ * @param user_data passed to `write_cb`
+ */
+void flush_rotate(const lv_disp_drv_t * drv, const lv_area_t * area, const lv_color_t * color_p,
+                  flush_rotate_write_cb_t write_cb, void * user_data);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif  /*USE_FBDEV || USE_BSD_FBDEV || USE_DRM*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*FLUSH_ROTATE_H*/
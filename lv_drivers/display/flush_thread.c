@@ -0,0 +1,130 @@
+/**
+ * @file flush_thread.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "flush_thread.h"
+#if USE_FLUSH_THREAD
+
+#include <stdio.h>
+#include <pthread.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    flush_thread_cb_t flush_cb;
+    lv_disp_drv_t * drv;
+    lv_area_t area;
+    lv_color_t * color_p;
+} flush_job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * flush_thread_main(void * arg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static pthread_t thread;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t submitted_cond = PTHREAD_COND_INITIALIZER;  /*A job was submitted*/
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;       /*The job was flushed*/
+/*LVGL waits for `lv_disp_flush_ready()` before it flushes the next area,
+ *so there is never more than one job: the one being flushed*/
+static flush_job_t pending_job;
+static bool pending;
+static bool started;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void flush_thread_init(void)
+{
+    if(started) return;
+
+    if(pthread_create(&thread, NULL, flush_thread_main, NULL) != 0) {
+        perror("Error: cannot create the flush thread");
+        return;
+    }
+
+    started = true;
+}
+
+void flush_thread_submit(flush_thread_cb_t flush_cb, lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*Flush synchronously if the thread couldn't be started*/
+    if(!started) {
+        flush_cb(drv, area, color_p);
+        return;
+    }
+
+    pthread_mutex_lock(&mutex);
+    /*Only if it's called without waiting for the previous area*/
+    while(pending) {
+        pthread_cond_wait(&done_cond, &mutex);
+    }
+
+    pending_job.flush_cb = flush_cb;
+    pending_job.drv = drv;
+    pending_job.area = *area;  /*LVGL reuses the area for the next part*/
+    pending_job.color_p = color_p;
+    pending = true;
+
+    pthread_cond_signal(&submitted_cond);
+    pthread_mutex_unlock(&mutex);
+}
+
+void flush_thread_wait(lv_disp_drv_t * drv)
+{
+    LV_UNUSED(drv);
+
+    pthread_mutex_lock(&mutex);
+    while(pending) {
+        pthread_cond_wait(&done_cond, &mutex);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * flush_thread_main(void * arg)
+{
+    LV_UNUSED(arg);
+
+    pthread_mutex_lock(&mutex);
+    while(1) {
+        while(!pending) {
+            pthread_cond_wait(&submitted_cond, &mutex);
+        }
+
+        /*Keep the job pending while it's flushed so `flush_thread_wait()` waits for it too*/
+        flush_job_t job = pending_job;
+        pthread_mutex_unlock(&mutex);
+
+        job.flush_cb(job.drv, &job.area, job.color_p);
+
+        pthread_mutex_lock(&mutex);
+        pending = false;
+        pthread_cond_broadcast(&done_cond);
+    }
+
+    return NULL;
+}
+
+#endif
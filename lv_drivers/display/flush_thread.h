@@ -0,0 +1,80 @@
+/**
+ * @file flush_thread.h
+ *
+ */
+
+#ifndef FLUSH_THREAD_H
+#define FLUSH_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifndef LV_DRV_NO_CONF
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_drv_conf.h"
+#else
+#include "../../lv_drv_conf.h"
+#endif
+#endif
+
+#if USE_FLUSH_THREAD
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The synchronous flush function of a driver. It's called on the flush thread and
+ *it should call `lv_disp_flush_ready()` when it's finished.*/
+typedef void (*flush_thread_cb_t)(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start the flush thread. Called by the drivers using it, can be called more times.
+ */
+void flush_thread_init(void);
+
+/**
+ * Flush an area on the flush thread. Returns immediately, so LVGL can render
+ * the next area into the other draw buffer meanwhile.
+ * @param flush_cb the synchronous flush function of the driver
+ * @param drv pointer to the display driver
+ * @param area the area to flush. It's copied.
+ * @param color_p the rendered pixels. They are read until `lv_disp_flush_ready()` is called.
+ */
+void flush_thread_submit(flush_thread_cb_t flush_cb, lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**
+ * Wait until all the submitted areas are flushed.
+ * Can be used as `wait_cb` of the display driver to sleep instead of polling while LVGL waits for the flushing.
+ * @param drv pointer to the display driver (not used)
+ */
+void flush_thread_wait(lv_disp_drv_t * drv);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif  /*USE_FLUSH_THREAD*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*FLUSH_THREAD_H*/
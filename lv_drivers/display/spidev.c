@@ -0,0 +1,345 @@
+/**
+ * @file spidev.c
+ * Batched transfers to SPI display panels through the Linux spidev interface
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "spidev.h"
+#if USE_SPIDEV
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+#include <linux/gpio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef SPIDEV_PATH
+#define SPIDEV_PATH         "/dev/spidev0.0"
+#endif
+
+#ifndef SPIDEV_SPEED_HZ
+#define SPIDEV_SPEED_HZ     32000000
+#endif
+
+#ifndef SPIDEV_MODE
+#define SPIDEV_MODE         0
+#endif
+
+#ifndef SPIDEV_GPIO_CHIP
+#define SPIDEV_GPIO_CHIP    "/dev/gpiochip0"
+#endif
+
+#ifndef SPIDEV_DC_LINE
+#define SPIDEV_DC_LINE      -1
+#endif
+
+#ifndef SPIDEV_RST_LINE
+#define SPIDEV_RST_LINE     -1
+#endif
+
+#ifndef SPIDEV_BATCH_SIZE
+#define SPIDEV_BATCH_SIZE   (64 * 1024)
+#endif
+
+/*Configures the SPI and GPIO devices and sends the messages. Can be replaced e.g. to record the messages in tests.*/
+#ifndef SPIDEV_IOCTL
+#define SPIDEV_IOCTL        ioctl
+#endif
+
+/*spidev rejects the messages larger than its `bufsiz` parameter*/
+#define SPIDEV_BUFSIZ_PATH  "/sys/module/spidev/parameters/bufsiz"
+#define SPIDEV_BUFSIZ_DEF   4096
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void spidev_transfer(const uint8_t * data, uint32_t len);
+static uint32_t spidev_get_bufsiz(void);
+static int gpio_request(int chip_fd, int line, int value, const char * label);
+static void gpio_set(int fd, int value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static int spi_fd = -1;
+static int dc_fd = -1;
+static int rst_fd = -1;
+static int dc_value = -1;
+static uint32_t speed_hz = SPIDEV_SPEED_HZ;
+static uint8_t * batch;         /*The bytes waiting to be sent*/
+static uint32_t batch_len;
+static uint32_t batch_size;     /*Max. size of a message*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void spidev_init(void)
+{
+    spi_fd = open(SPIDEV_PATH, O_RDWR);
+    if(spi_fd == -1) {
+        perror("Error: cannot open SPI device");
+        return;
+    }
+
+    uint8_t mode = SPIDEV_MODE;
+    uint8_t bits = 8;
+    if(SPIDEV_IOCTL(spi_fd, SPI_IOC_WR_MODE, &mode) == -1 ||
+            SPIDEV_IOCTL(spi_fd, SPI_IOC_WR_BITS_PER_WORD, &bits) == -1 ||
+            SPIDEV_IOCTL(spi_fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed_hz) == -1) {
+        perror("ioctl(SPI_IOC_WR_*)");
+    }
+
+    batch_size = spidev_get_bufsiz();
+    if(batch_size > SPIDEV_BATCH_SIZE) batch_size = SPIDEV_BATCH_SIZE;
+    batch = malloc(batch_size);
+    if(batch == NULL) {
+        perror("Error: cannot allocate the SPI batch buffer");
+        close(spi_fd);
+        spi_fd = -1;
+        return;
+    }
+    batch_len = 0;
+
+    if(SPIDEV_DC_LINE >= 0 || SPIDEV_RST_LINE >= 0) {
+        int chip_fd = open(SPIDEV_GPIO_CHIP, O_RDWR);
+        if(chip_fd == -1) {
+            perror("Error: cannot open GPIO chip");
+        }
+        else {
+            if(SPIDEV_DC_LINE >= 0) dc_fd = gpio_request(chip_fd, SPIDEV_DC_LINE, 0, "lvgl-dc");
+            if(SPIDEV_RST_LINE >= 0) rst_fd = gpio_request(chip_fd, SPIDEV_RST_LINE, 1, "lvgl-rst");
+            close(chip_fd);
+        }
+    }
+    dc_value = 0;
+
+    printf("The SPI device was opened successfully, %u bytes per transfer.\n", batch_size);
+}
+
+void spidev_exit(void)
+{
+    spidev_sync();
+
+    if(dc_fd != -1) close(dc_fd);
+    if(rst_fd != -1) close(rst_fd);
+    if(spi_fd != -1) close(spi_fd);
+    dc_fd = -1;
+    rst_fd = -1;
+    spi_fd = -1;
+
+    free(batch);
+    batch = NULL;
+}
+
+void spidev_cmd_data(int val)
+{
+    if(val == dc_value) return;
+
+    /*The bytes collected so far belong to the previous level*/
+    spidev_sync();
+    if(dc_fd != -1) gpio_set(dc_fd, val);
+    dc_value = val;
+}
+
+void spidev_rst(int val)
+{
+    spidev_sync();
+    if(rst_fd != -1) gpio_set(rst_fd, val);
+}
+
+void spidev_cs(int val)
+{
+    if(val) spidev_sync();
+}
+
+void spidev_write_byte(uint8_t data)
+{
+    if(batch_len == batch_size) spidev_sync();
+    if(batch == NULL) return;
+
+    batch[batch_len] = data;
+    batch_len++;
+}
+
+void spidev_write_array(const void * data, uint32_t len)
+{
+    if(batch == NULL) return;
+
+    const uint8_t * src = data;
+    while(len) {
+        /*Send the large blocks directly instead of copying them*/
+        if(batch_len == 0 && len >= batch_size) {
+            spidev_transfer(src, batch_size);
+            src += batch_size;
+            len -= batch_size;
+            continue;
+        }
+
+        uint32_t n = batch_size - batch_len;
+        if(n > len) n = len;
+        memcpy(batch + batch_len, src, n);
+        batch_len += n;
+        src += n;
+        len -= n;
+
+        if(batch_len == batch_size) spidev_sync();
+    }
+}
+
+void spidev_write_pixels(const lv_color_t * color_p, uint32_t px_cnt)
+{
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    /*The pixels are already in the order of the panel*/
+    spidev_write_array(color_p, px_cnt * sizeof(lv_color_t));
+#else
+    if(batch == NULL) return;
+
+    /*Convert to RGB565 and swap the bytes to big endian while collecting them*/
+    while(px_cnt) {
+        uint32_t n = (batch_size - batch_len) / 2;
+        if(n > px_cnt) n = px_cnt;
+
+        uint8_t * dest = batch + batch_len;
+        uint32_t i;
+        for(i = 0; i < n; i++) {
+            uint16_t c = lv_color_to16(color_p[i]);
+#if LV_COLOR_16_SWAP
+            /*The 16 bit colors are stored swapped*/
+            c = (uint16_t)((c << 8) | (c >> 8));
+#endif
+            dest[2 * i] = c >> 8;
+            dest[2 * i + 1] = c & 0xFF;
+        }
+        batch_len += n * 2;
+        color_p += n;
+        px_cnt -= n;
+
+        if(batch_size - batch_len < 2) spidev_sync();
+    }
+#endif
+}
+
+void spidev_sync(void)
+{
+    if(batch_len == 0) return;
+
+    spidev_transfer(batch, batch_len);
+    batch_len = 0;
+}
+
+void spidev_set_speed(uint32_t hz)
+{
+    spidev_sync();
+    speed_hz = hz;
+}
+
+void spidev_set_mode(uint8_t mode)
+{
+    spidev_sync();
+    if(spi_fd != -1 && SPIDEV_IOCTL(spi_fd, SPI_IOC_WR_MODE, &mode) == -1) {
+        perror("ioctl(SPI_IOC_WR_MODE)");
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Send bytes in one message
+ * @param data pointer to the bytes
+ * @param len number of bytes, max. `batch_size`
+ */
+static void spidev_transfer(const uint8_t * data, uint32_t len)
+{
+    if(spi_fd == -1) return;
+
+    struct spi_ioc_transfer tr;
+    memset(&tr, 0, sizeof(tr));
+    tr.tx_buf = (uintptr_t)data;
+    tr.len = len;
+    tr.speed_hz = speed_hz;
+    tr.bits_per_word = 8;
+
+    if(SPIDEV_IOCTL(spi_fd, SPI_IOC_MESSAGE(1), &tr) == -1) {
+        perror("ioctl(SPI_IOC_MESSAGE)");
+    }
+}
+
+/**
+ * Get the max. size of a message accepted by spidev
+ * @return the size in bytes
+ */
+static uint32_t spidev_get_bufsiz(void)
+{
+    uint32_t bufsiz = SPIDEV_BUFSIZ_DEF;
+    FILE * f = fopen(SPIDEV_BUFSIZ_PATH, "r");
+    if(f) {
+        unsigned int v;
+        if(fscanf(f, "%u", &v) == 1 && v >= 2) bufsiz = v;
+        fclose(f);
+    }
+
+    return bufsiz;
+}
+
+/**
+ * Request a GPIO line as output
+ * @param chip_fd file descriptor of the GPIO chip
+ * @param line offset of the line on the chip
+ * @param value the initial value
+ * @param label name of the user shown by the kernel
+ * @return file descriptor of the line or -1 on error
+ */
+static int gpio_request(int chip_fd, int line, int value, const char * label)
+{
+    struct gpiohandle_request req;
+    memset(&req, 0, sizeof(req));
+    req.lineoffsets[0] = line;
+    req.lines = 1;
+    req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+    req.default_values[0] = value;
+    strncpy(req.consumer_label, label, sizeof(req.consumer_label) - 1);
+
+    if(SPIDEV_IOCTL(chip_fd, GPIO_GET_LINEHANDLE_IOCTL, &req) == -1) {
+        perror("ioctl(GPIO_GET_LINEHANDLE_IOCTL)");
+        return -1;
+    }
+
+    return req.fd;
+}
+
+/**
+ * Set the value of a GPIO line
+ * @param fd file descriptor of the line
+ * @param value the new value
+ */
+static void gpio_set(int fd, int value)
+{
+    struct gpiohandle_data data;
+    memset(&data, 0, sizeof(data));
+    data.values[0] = value ? 1 : 0;
+
+    if(SPIDEV_IOCTL(fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data) == -1) {
+        perror("ioctl(GPIOHANDLE_SET_LINE_VALUES_IOCTL)");
+    }
+}
+
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @file spidev.h
+ *
+ */
+
+#ifndef DISP_SPIDEV_H
+#define DISP_SPIDEV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifndef LV_DRV_NO_CONF
+#ifdef LV_CONF_INCLUDE_SIMPLE
+#include "lv_drv_conf.h"
+#else
+#include "../../lv_drv_conf.h"
+#endif
+#endif
+
+#if USE_SPIDEV
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+#include "lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Route the display interface of the SPI panel drivers (ILI9341, GC9A01, ST7565) to spidev*/
+#undef LV_DRV_DISP_CMD_DATA
+#undef LV_DRV_DISP_RST
+#undef LV_DRV_DISP_SPI_CS
+#undef LV_DRV_DISP_SPI_WR_BYTE
+#undef LV_DRV_DISP_SPI_WR_ARRAY
+#undef LV_DRV_DISP_SPI_WR_PIXELS
+#undef LV_DRV_DISP_SPI_FREQ
+#undef LV_DRV_DISP_SPI_MODE
+#define LV_DRV_DISP_CMD_DATA(val)           spidev_cmd_data(val)
+#define LV_DRV_DISP_RST(val)                spidev_rst(val)
+#define LV_DRV_DISP_SPI_CS(val)             spidev_cs(val)
+#define LV_DRV_DISP_SPI_WR_BYTE(data)       spidev_write_byte(data)
+#define LV_DRV_DISP_SPI_WR_ARRAY(adr, n)    spidev_write_array(adr, n)
+#define LV_DRV_DISP_SPI_WR_PIXELS(adr, n)   spidev_write_pixels(adr, n)
+#define LV_DRV_DISP_SPI_FREQ(hz)            spidev_set_speed(hz)
+#define LV_DRV_DISP_SPI_MODE(bits, mode)    spidev_set_mode(mode)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Open the SPI device and request the data/command and reset GPIO lines.
+ * Call it before the init function of the panel.
+ */
+void spidev_init(void);
+
+/**
+ * Send the pending bytes and close the SPI device
+ */
+void spidev_exit(void);
+
+/**
+ * Set the data/command line. The bytes written before are sent first.
+ * @param val 0: command, 1: data
+ */
+void spidev_cmd_data(int val);
+
+/**
+ * Set the reset line
+ * @param val level of the line
+ */
+void spidev_rst(int val);
+
+/**
+ * The chip select is driven by the SPI controller. Releasing it sends the pending bytes.
+ * @param val 0: start of a transaction; 1: end of a transaction
+ */
+void spidev_cs(int val);
+
+/**
+ * Add a byte to the pending transfer
+ * @param data the byte to send
+ */
+void spidev_write_byte(uint8_t data);
+
+/**
+ * Add bytes to the pending transfer
+ * @param data pointer to the bytes
+ * @param len number of bytes
+ */
+void spidev_write_array(const void * data, uint32_t len);
+
+/**
+ * Add pixels to the pending transfer. They are converted to RGB565 and sent in big endian order,
+ * so `LV_COLOR_16_SWAP` is not required and any `LV_COLOR_DEPTH` can be used.
+ * @param color_p pointer to the pixels
+ * @param px_cnt number of pixels
+ */
+void spidev_write_pixels(const lv_color_t * color_p, uint32_t px_cnt);
+
+/**
+ * Send the pending bytes
+ */
+void spidev_sync(void);
+
+/**
+ * Change the clock frequency of the transfers
+ * @param hz the new frequency
+ */
+void spidev_set_speed(uint32_t hz);
+
+/**
+ * Change the SPI mode
+ * @param mode 0..3 (clock polarity and phase)
+ */
+void spidev_set_mode(uint8_t mode);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif  /*USE_SPIDEV*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*DISP_SPIDEV_H*/
@@ -12,6 +12,23 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/ioctl.h>
+#if EVDEV_THREAD
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#endif
+#if EVDEV_HOTPLUG
+#include <dirent.h>
+#include <string.h>
+#include <sys/stat.h>
+#if USE_BSD_EVDEV == 0
+#include <sys/inotify.h>
+#endif
+#endif
 #if USE_BSD_EVDEV
 #include <dev/evdev/input.h>
 #else
@@ -21,29 +38,183 @@
 /*********************
  *      DEFINES
  *********************/
+#ifndef EVDEV_QUEUE_SIZE
+#define EVDEV_QUEUE_SIZE    32
+#endif
+
+/*Queries the capabilities and the state of the devices. Can be replaced e.g. to fake a device in tests.*/
+#ifndef EVDEV_IOCTL
+#define EVDEV_IOCTL         ioctl
+#endif
+
+/*Number of the tracked multi-touch slots*/
+#ifndef EVDEV_SLOT_MAX
+#define EVDEV_SLOT_MAX      LV_INDEV_TOUCH_MAX
+#endif
+
+#if EVDEV_HOTPLUG
+#ifndef EVDEV_DIR
+#define EVDEV_DIR           "/dev/input"
+#endif
+
+/*Max. number of the opened devices*/
+#ifndef EVDEV_DEV_MAX
+#define EVDEV_DEV_MAX       8
+#endif
+
+/*Check the plugged and removed devices with this period [ms]*/
+#ifndef EVDEV_HOTPLUG_PERIOD
+#define EVDEV_HOTPLUG_PERIOD    200
+#endif
+#endif
+
+#if EVDEV_FILTER
+/*Settings of the pointer filter (see `lv_indev_drv_t`)*/
+#ifndef EVDEV_FILTER_MIN_CUTOFF
+#define EVDEV_FILTER_MIN_CUTOFF 10
+#endif
+#ifndef EVDEV_FILTER_BETA
+#define EVDEV_FILTER_BETA       70
+#endif
+#ifndef EVDEV_PREDICT_TIME
+#define EVDEV_PREDICT_TIME      30
+#endif
+#endif
+
+/*Read this many events with one system call*/
+#define EVDEV_READ_BATCH    64
+
+#define EVDEV_PATH_MAX      64
+
+/*Older kernel headers don't have the accessors of the time stamp*/
+#ifndef input_event_sec
+#define input_event_sec     time.tv_sec
+#define input_event_usec    time.tv_usec
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*A multi-touch slot (protocol B)*/
+typedef struct {
+    int x;
+    int y;
+    int32_t id;     /*Tracking ID or -1 if the slot is not used*/
+} evdev_slot_t;
+
+/*A sample: the state at a SYN_REPORT or at a key event*/
+typedef struct {
+    int x;
+    int y;
+    uint32_t key;
+    lv_indev_state_t state;
+    lv_indev_state_t key_state;
+    int16_t enc_diff;       /*Wheel steps since the previous sample*/
+    uint32_t timestamp;
+    evdev_slot_t touches[EVDEV_SLOT_MAX];   /*The used slots in slot order*/
+    uint8_t touch_cnt;
+} evdev_frame_t;
+
+/*An opened device*/
+typedef struct {
+    int fd;
+    char path[EVDEV_PATH_MAX];
+    lv_indev_type_t type;       /*The type by the capabilities of the device, see `evdev_classify()`*/
+
+    /*The state collected from the events*/
+    int root_x;
+    int root_y;
+    int button;
+    int key_val;
+    int key_state;
+    uint16_t key_code;          /*The evdev code of the last key*/
+    bool shift;
+    int enc_diff;
+    evdev_slot_t slots[EVDEV_SLOT_MAX];
+    int slot;                   /*The slot selected by ABS_MT_SLOT*/
+    bool mt;                    /*Tracking IDs were received, the slots tell the touches*/
+    bool changed;               /*The state has changed since the last SYN_REPORT*/
+    bool dropped;               /*The kernel dropped events, skip until the next SYN_REPORT*/
+    bool removed;               /*The device is gone, reading it failed*/
+    clockid_t clock;            /*The clock of the event time stamps*/
+
+    /*Single producer (reader of the device) single consumer (`evdev_read`) ring of the samples.
+     *Only the producer writes `tail` and only the consumer writes `head`.*/
+    evdev_frame_t queue[EVDEV_QUEUE_SIZE];
+    uint32_t queue_head;        /*Index of the oldest frame*/
+    uint32_t queue_tail;        /*Index of the next free slot*/
+    evdev_frame_t overflow;     /*The newest sample which didn't fit into the queue*/
+    bool overflowed;
+    uint32_t batch_left;        /*Samples to report in the current `continue_reading` sequence*/
+    evdev_frame_t last;         /*The last reported frame*/
+
+#if EVDEV_THREAD
+    pthread_t thread;
+    bool thread_run;
+    bool thread_quit;           /*Asks the input thread to return*/
+    int stop_fd;                /*Wakes the input thread to check `thread_quit`*/
+#endif
+#if EVDEV_HOTPLUG
+    lv_indev_drv_t drv;
+    lv_indev_t * indev;         /*Kept after removing the device to reuse it for a new one of the same type*/
+#endif
+} evdev_dev_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 int map(int x, int in_min, int in_max, int out_min, int out_max);
+static evdev_dev_t * evdev_find(lv_indev_drv_t * drv);
+static bool evdev_open(evdev_dev_t * dev, const char * dev_name);
+static void evdev_close(evdev_dev_t * dev);
+static void evdev_reset(evdev_dev_t * dev);
+static bool evdev_poll(evdev_dev_t * dev);
+static bool evdev_process(evdev_dev_t * dev, const struct input_event * in);
+static void evdev_resync(evdev_dev_t * dev);
+static bool evdev_push(evdev_dev_t * dev, uint32_t timestamp);
+static bool evdev_queue_flush(evdev_dev_t * dev);
+static uint32_t evdev_time_to_tick(evdev_dev_t * dev, const struct input_event * in);
+static uint32_t evdev_map_key(uint16_t code, bool shift);
+static void evdev_to_point(lv_indev_drv_t * drv, int x, int y, lv_point_t * point);
+static lv_indev_type_t evdev_classify(int fd);
+#if EVDEV_THREAD
+static void evdev_wake_init(void);
+static void evdev_thread_start(evdev_dev_t * dev);
+static void evdev_thread_stop(evdev_dev_t * dev);
+static void * evdev_thread_main(void * arg);
+#endif
+#if EVDEV_HOTPLUG
+static void evdev_hotplug_scan(void);
+static void evdev_hotplug_add(const char * path);
+static void evdev_hotplug_remove(evdev_dev_t * dev);
+static void evdev_hotplug_timer_cb(lv_timer_t * timer);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-int evdev_fd;
-int evdev_root_x;
-int evdev_root_y;
-int evdev_button;
-
-int evdev_key_val;
+static evdev_dev_t evdev_default = {.fd = -1};    /*The device of `evdev_init()` and `evdev_set_file()`*/
+#if EVDEV_THREAD
+static int evdev_wake_fd = -1;        /*Signaled by the input threads if there are new samples*/
+#endif
+#if EVDEV_HOTPLUG
+static evdev_dev_t evdev_devs[EVDEV_DEV_MAX];
+static int evdev_notify_fd = -1;      /*inotify of EVDEV_DIR*/
+#endif
 
 /**********************
  *      MACROS
  **********************/
+#define EVDEV_QUEUE_NEXT(i) (((i) + 1) % EVDEV_QUEUE_SIZE)
+
+/*The samples are written before publishing the new tail and read before releasing the slot*/
+#define EVDEV_LOAD_ACQUIRE(v)       __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define EVDEV_STORE_RELEASE(v, x)   __atomic_store_n(&(v), (x), __ATOMIC_RELEASE)
+
+/*Capability bits returned by EVIOCGBIT*/
+#define EVDEV_LONG_BITS             (sizeof(unsigned long) * 8)
+#define EVDEV_BITS_SIZE(max)        ((max) / EVDEV_LONG_BITS + 1)
+#define EVDEV_BIT_TEST(bits, b)     (((bits)[(b) / EVDEV_LONG_BITS] >> ((b) % EVDEV_LONG_BITS)) & 1)
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -54,26 +225,16 @@ int evdev_key_val;
  */
 void evdev_init(void)
 {
-#if USE_BSD_EVDEV
-    evdev_fd = open(EVDEV_NAME, O_RDWR | O_NOCTTY);
-#else
-    evdev_fd = open(EVDEV_NAME, O_RDWR | O_NOCTTY | O_NDELAY);
+#if EVDEV_THREAD
+    /*Can be polled even if the device is opened later*/
+    evdev_wake_init();
 #endif
-    if(evdev_fd == -1) {
-        perror("unable open evdev interface:");
-        return;
-    }
 
-#if USE_BSD_EVDEV
-    fcntl(evdev_fd, F_SETFL, O_NONBLOCK);
-#else
-    fcntl(evdev_fd, F_SETFL, O_ASYNC | O_NONBLOCK);
-#endif
+    if(!evdev_open(&evdev_default, EVDEV_NAME)) return;
 
-    evdev_root_x = 0;
-    evdev_root_y = 0;
-    evdev_key_val = 0;
-    evdev_button = LV_INDEV_STATE_REL;
+#if EVDEV_THREAD
+    evdev_thread_start(&evdev_default);
+#endif
 }
 /**
  * reconfigure the device file for evdev
@@ -82,157 +243,144 @@ void evdev_init(void)
  *         false: the device file doesn't exist current system
  */
 bool evdev_set_file(char* dev_name)
-{ 
-     if(evdev_fd != -1) {
-        close(evdev_fd);
-     }
-#if USE_BSD_EVDEV
-     evdev_fd = open(dev_name, O_RDWR | O_NOCTTY);
-#else
-     evdev_fd = open(dev_name, O_RDWR | O_NOCTTY | O_NDELAY);
+{
+     evdev_close(&evdev_default);
+
+     if(!evdev_open(&evdev_default, dev_name)) return false;
+
+#if EVDEV_THREAD
+     evdev_thread_start(&evdev_default);
 #endif
 
-     if(evdev_fd == -1) {
-        perror("unable open evdev interface:");
-        return false;
-     }
+     return true;
+}
 
-#if USE_BSD_EVDEV
-     fcntl(evdev_fd, F_SETFL, O_NONBLOCK);
-#else
-     fcntl(evdev_fd, F_SETFL, O_ASYNC | O_NONBLOCK);
+/**
+ * Initialize an input device driver to read the evdev with the settings of the driver
+ * @param drv pointer to the input device driver to initialize
+ * @param type the type of the input device
+ */
+void evdev_indev_drv_init(lv_indev_drv_t * drv, lv_indev_type_t type)
+{
+    lv_indev_drv_init(drv);
+    drv->type = type;
+    drv->read_cb = evdev_read;
+#if EVDEV_FILTER
+    drv->filter_min_cutoff = EVDEV_FILTER_MIN_CUTOFF;
+    drv->filter_beta = EVDEV_FILTER_BETA;
+    drv->predict_time = EVDEV_PREDICT_TIME;
 #endif
+}
 
-     evdev_root_x = 0;
-     evdev_root_y = 0;
-     evdev_key_val = 0;
-     evdev_button = LV_INDEV_STATE_REL;
+#if EVDEV_HOTPLUG
+/**
+ * Open every input device of EVDEV_DIR and register an LVGL input device for each by their capabilities.
+ * The devices plugged in and removed later are followed without restarting.
+ */
+void evdev_hotplug_init(void)
+{
+    uint32_t i;
+    for(i = 0; i < EVDEV_DEV_MAX; i++) evdev_devs[i].fd = -1;
 
-     return true;
+#if EVDEV_THREAD
+    /*Can be polled even if there are no devices yet*/
+    evdev_wake_init();
+#endif
+
+#if USE_BSD_EVDEV == 0
+    evdev_notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(evdev_notify_fd == -1 ||
+       inotify_add_watch(evdev_notify_fd, EVDEV_DIR, IN_CREATE | IN_DELETE | IN_ATTRIB | IN_MOVED_TO | IN_MOVED_FROM) == -1) {
+        perror("unable to watch " EVDEV_DIR ", the devices are scanned periodically:");
+        if(evdev_notify_fd != -1) close(evdev_notify_fd);
+        evdev_notify_fd = -1;
+    }
+#endif
+
+    evdev_hotplug_scan();
+    lv_timer_create(evdev_hotplug_timer_cb, EVDEV_HOTPLUG_PERIOD, NULL);
 }
+#endif
+
 /**
- * Get the current position and state of the evdev
- * @param data store the evdev data here
- * @return false: because the points are not buffered, so no more data to be read
+ * Get the buffered samples of the evdev one by one.
+ * Every SYN_REPORT frame (or key event for keypads) is reported with its own time stamp
+ * so the gestures are recognized from all the samples even if they arrived between two reads.
+ * @param drv pointer to the input device driver
+ * @param data store the evdev data here. `continue_reading` is set if there are more samples.
  */
 void evdev_read(lv_indev_drv_t * drv, lv_indev_data_t * data)
 {
-    struct input_event in;
-
-    while(read(evdev_fd, &in, sizeof(struct input_event)) > 0) {
-        if(in.type == EV_REL) {
-            if(in.code == REL_X)
-				#if EVDEV_SWAP_AXES
-					evdev_root_y += in.value;
-				#else
-					evdev_root_x += in.value;
-				#endif
-            else if(in.code == REL_Y)
-				#if EVDEV_SWAP_AXES
-					evdev_root_x += in.value;
-				#else
-					evdev_root_y += in.value;
-				#endif
-        } else if(in.type == EV_ABS) {
-            if(in.code == ABS_X)
-				#if EVDEV_SWAP_AXES
-					evdev_root_y = in.value;
-				#else
-					evdev_root_x = in.value;
-				#endif
-            else if(in.code == ABS_Y)
-				#if EVDEV_SWAP_AXES
-					evdev_root_x = in.value;
-				#else
-					evdev_root_y = in.value;
-				#endif
-            else if(in.code == ABS_MT_POSITION_X)
-                                #if EVDEV_SWAP_AXES
-                                        evdev_root_y = in.value;
-                                #else
-                                        evdev_root_x = in.value;
-                                #endif
-            else if(in.code == ABS_MT_POSITION_Y)
-                                #if EVDEV_SWAP_AXES
-                                        evdev_root_x = in.value;
-                                #else
-                                        evdev_root_y = in.value;
-                                #endif
-            else if(in.code == ABS_MT_TRACKING_ID)
-                                if(in.value == -1)
-                                    evdev_button = LV_INDEV_STATE_REL;
-                                else if(in.value == 0)
-                                    evdev_button = LV_INDEV_STATE_PR;
-        } else if(in.type == EV_KEY) {
-            if(in.code == BTN_MOUSE || in.code == BTN_TOUCH) {
-                if(in.value == 0)
-                    evdev_button = LV_INDEV_STATE_REL;
-                else if(in.value == 1)
-                    evdev_button = LV_INDEV_STATE_PR;
-            } else if(drv->type == LV_INDEV_TYPE_KEYPAD) {
-		data->state = (in.value) ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
-		switch(in.code) {
-			case KEY_BACKSPACE:
-				data->key = LV_KEY_BACKSPACE;
-				break;
-			case KEY_ENTER:
-				data->key = LV_KEY_ENTER;
-				break;
-			case KEY_UP:
-				data->key = LV_KEY_UP;
-				break;
-			case KEY_LEFT:
-				data->key = LV_KEY_PREV;
-				break;
-			case KEY_RIGHT:
-				data->key = LV_KEY_NEXT;
-				break;
-			case KEY_DOWN:
-				data->key = LV_KEY_DOWN;
-				break;
-			default:
-				data->key = 0;
-				break;
-		}
-		evdev_key_val = data->key;
-		evdev_button = data->state;
-		return ;
-	    }
-        }
+    evdev_dev_t * dev = evdev_find(drv);
+
+    /*Report only the samples which were queued when the reading started to not read forever*/
+    if(dev->batch_left == 0) {
+#if EVDEV_THREAD == 0
+        if(dev->fd != -1) evdev_poll(dev);
+#endif
+        uint32_t tail = EVDEV_LOAD_ACQUIRE(dev->queue_tail);
+        dev->batch_left = (tail + EVDEV_QUEUE_SIZE - dev->queue_head) % EVDEV_QUEUE_SIZE;
+    }
+
+    if(dev->batch_left) {
+        dev->last = dev->queue[dev->queue_head];
+        EVDEV_STORE_RELEASE(dev->queue_head, EVDEV_QUEUE_NEXT(dev->queue_head));
+        dev->batch_left--;
+        data->timestamp = dev->last.timestamp;
+        data->continue_reading = dev->batch_left != 0;
+    }
+    else {
+        /*No new sample: report the last state at the time of reading*/
+        dev->last.enc_diff = 0;
+        data->timestamp = 0;
+        data->continue_reading = false;
     }
 
     if(drv->type == LV_INDEV_TYPE_KEYPAD) {
-        /* No data retrieved */
-        data->key = evdev_key_val;
-	data->state = evdev_button;
-	return ;
+        data->key = dev->last.key;
+        data->state = dev->last.key_state;
+        return ;
     }
-    if(drv->type != LV_INDEV_TYPE_POINTER)
+    data->state = dev->last.state;
+
+    if(drv->type == LV_INDEV_TYPE_ENCODER) {
+        data->enc_diff = dev->last.enc_diff;
         return ;
-    /*Store the collected data*/
+    }
 
-#if EVDEV_CALIBRATE
-    data->point.x = map(evdev_root_x, EVDEV_HOR_MIN, EVDEV_HOR_MAX, 0, drv->disp->driver->hor_res);
-    data->point.y = map(evdev_root_y, EVDEV_VER_MIN, EVDEV_VER_MAX, 0, drv->disp->driver->ver_res);
-#else
-    data->point.x = evdev_root_x;
-    data->point.y = evdev_root_y;
-#endif
+    if(drv->type == LV_INDEV_TYPE_MULTI_POINTER) {
+        uint8_t i;
+        for(i = 0; i < dev->last.touch_cnt && i < LV_INDEV_TOUCH_MAX; i++) {
+            data->touches[i].id = dev->last.touches[i].id;
+            evdev_to_point(drv, dev->last.touches[i].x, dev->last.touches[i].y, &data->touches[i].point);
+        }
+        data->touch_cnt = i;
+        return ;
+    }
 
-    data->state = evdev_button;
+    if(drv->type != LV_INDEV_TYPE_POINTER)
+        return ;
 
-    if(data->point.x < 0)
-      data->point.x = 0;
-    if(data->point.y < 0)
-      data->point.y = 0;
-    if(data->point.x >= drv->disp->driver->hor_res)
-      data->point.x = drv->disp->driver->hor_res - 1;
-    if(data->point.y >= drv->disp->driver->ver_res)
-      data->point.y = drv->disp->driver->ver_res - 1;
+    /*Store the collected data*/
+    evdev_to_point(drv, dev->last.x, dev->last.y, &data->point);
 
     return ;
 }
 
+/**
+ * Get the file descriptor which becomes readable when the input thread has new samples.
+ * Poll it in the main loop to process the input without waiting for the read period.
+ * @return the file descriptor or -1 if the events are not read on a separate thread
+ */
+int evdev_get_wake_fd(void)
+{
+#if EVDEV_THREAD
+    return evdev_wake_fd;
+#else
+    return -1;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -241,4 +389,755 @@ int map(int x, int in_min, int in_max, int out_min, int out_max)
   return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
 
+/**
+ * Get the device read by an input device driver
+ * @param drv pointer to the input device driver
+ * @return the device registered by the hotplug or the device of `evdev_init()`
+ */
+static evdev_dev_t * evdev_find(lv_indev_drv_t * drv)
+{
+#if EVDEV_HOTPLUG
+    uint32_t i;
+    for(i = 0; i < EVDEV_DEV_MAX; i++) {
+        if(&evdev_devs[i].drv == drv) return &evdev_devs[i];
+    }
+#else
+    LV_UNUSED(drv);
+#endif
+
+    return &evdev_default;
+}
+
+/**
+ * Open an evdev device
+ * @param dev the device to open
+ * @param dev_name the device file
+ * @return true: the device is opened
+ */
+static bool evdev_open(evdev_dev_t * dev, const char * dev_name)
+{
+#if USE_BSD_EVDEV
+    dev->fd = open(dev_name, O_RDWR | O_NOCTTY);
+#else
+    dev->fd = open(dev_name, O_RDWR | O_NOCTTY | O_NDELAY);
+#endif
+    if(dev->fd == -1) {
+        perror("unable open evdev interface:");
+        return false;
+    }
+
+#if USE_BSD_EVDEV
+    fcntl(dev->fd, F_SETFL, O_NONBLOCK);
+#else
+    fcntl(dev->fd, F_SETFL, O_ASYNC | O_NONBLOCK);
+#endif
+
+    lv_snprintf(dev->path, sizeof(dev->path), "%s", dev_name);
+    dev->type = evdev_classify(dev->fd);
+    evdev_reset(dev);
+
+    return true;
+}
+
+/**
+ * Stop reading a device and close it
+ * @param dev the device to close
+ */
+static void evdev_close(evdev_dev_t * dev)
+{
+#if EVDEV_THREAD
+    evdev_thread_stop(dev);
+#endif
+
+    if(dev->fd != -1) {
+        close(dev->fd);
+        dev->fd = -1;
+    }
+}
+
+/**
+ * Clear the state and the queued samples and set up the time stamps of the opened device
+ * @param dev the device
+ */
+static void evdev_reset(evdev_dev_t * dev)
+{
+    dev->root_x = 0;
+    dev->root_y = 0;
+    dev->key_val = 0;
+    dev->key_state = LV_INDEV_STATE_REL;
+    dev->key_code = 0;
+    dev->button = LV_INDEV_STATE_REL;
+    dev->shift = false;
+    dev->enc_diff = 0;
+
+    uint32_t i;
+    for(i = 0; i < EVDEV_SLOT_MAX; i++) dev->slots[i].id = -1;
+    dev->slot = 0;
+    dev->mt = false;
+
+    dev->queue_head = 0;
+    dev->queue_tail = 0;
+    dev->overflowed = false;
+    dev->batch_left = 0;
+    dev->changed = false;
+    dev->dropped = false;
+    dev->removed = false;
+    lv_memset_00(&dev->last, sizeof(dev->last));
+    dev->last.state = LV_INDEV_STATE_REL;
+    dev->last.key_state = LV_INDEV_STATE_REL;
+
+    /*Ask for monotonic time stamps to compare them with the current time without jumps*/
+    dev->clock = CLOCK_REALTIME;
+#ifdef EVIOCSCLOCKID
+    int clk = CLOCK_MONOTONIC;
+    if(dev->fd != -1 && EVDEV_IOCTL(dev->fd, EVIOCSCLOCKID, &clk) == 0) dev->clock = CLOCK_MONOTONIC;
+#endif
+}
+
+/**
+ * Read all the available events and queue the completed samples
+ * @param dev the device to read
+ * @return true: new samples were queued
+ */
+static bool evdev_poll(evdev_dev_t * dev)
+{
+    struct input_event in[EVDEV_READ_BATCH];
+    ssize_t len;
+    bool queued = evdev_queue_flush(dev);
+
+    while((len = read(dev->fd, in, sizeof(in))) > 0) {
+        size_t cnt = (size_t)len / sizeof(struct input_event);
+        size_t i;
+        for(i = 0; i < cnt; i++) {
+            if(evdev_process(dev, &in[i])) queued = true;
+        }
+        if(cnt < EVDEV_READ_BATCH) break;
+    }
+
+    /*The device was unplugged*/
+    if(len < 0 && errno == ENODEV) EVDEV_STORE_RELEASE(dev->removed, true);
+
+    return queued;
+}
+
+/**
+ * Update the state with an event and queue a sample at the end of a frame
+ * @param dev the device of the event
+ * @param in an input event
+ * @return true: a sample was queued
+ */
+static bool evdev_process(evdev_dev_t * dev, const struct input_event * in)
+{
+    if(in->type == EV_SYN) {
+        bool queued = false;
+        if(in->code == SYN_DROPPED) {
+            /*The events of the current frame are incomplete*/
+            dev->dropped = true;
+        }
+        else if(in->code == SYN_REPORT) {
+            if(dev->dropped) {
+                /*Continue from the current state of the device as e.g. a release might be lost*/
+                dev->dropped = false;
+                evdev_resync(dev);
+                queued = evdev_push(dev, evdev_time_to_tick(dev, in));
+            }
+            else if(dev->changed) queued = evdev_push(dev, evdev_time_to_tick(dev, in));
+            dev->changed = false;
+        }
+        return queued;
+    }
+
+    if(dev->dropped) return false;
+
+    if(in->type == EV_REL) {
+        if(in->code == REL_X) {
+#if EVDEV_SWAP_AXES
+            dev->root_y += in->value;
+#else
+            dev->root_x += in->value;
+#endif
+            /*Rotary encoders report their steps on REL_X too*/
+            if(dev->type == LV_INDEV_TYPE_ENCODER) dev->enc_diff += in->value;
+        }
+        else if(in->code == REL_Y)
+#if EVDEV_SWAP_AXES
+            dev->root_x += in->value;
+#else
+            dev->root_y += in->value;
+#endif
+        else if(in->code == REL_DIAL)
+            dev->enc_diff += in->value;
+        else if(in->code == REL_WHEEL)
+            dev->enc_diff -= in->value;     /*Scrolling down is a positive turn*/
+        else return false;
+    } else if(in->type == EV_ABS) {
+        /*The slot of the multi-touch events or NULL if there are more touches than tracked*/
+        evdev_slot_t * slot = dev->slot >= 0 && dev->slot < EVDEV_SLOT_MAX ? &dev->slots[dev->slot] : NULL;
+
+        if(in->code == ABS_X)
+#if EVDEV_SWAP_AXES
+            dev->root_y = in->value;
+#else
+            dev->root_x = in->value;
+#endif
+        else if(in->code == ABS_Y)
+#if EVDEV_SWAP_AXES
+            dev->root_x = in->value;
+#else
+            dev->root_y = in->value;
+#endif
+        else if(in->code == ABS_MT_SLOT)
+            dev->slot = in->value;
+        else if(in->code == ABS_MT_TRACKING_ID) {
+            /*-1 frees the slot, any other value is a new touch*/
+            if(slot) slot->id = in->value;
+            dev->mt = true;
+        }
+        else if(in->code == ABS_MT_POSITION_X || in->code == ABS_MT_POSITION_Y) {
+            bool swap = EVDEV_SWAP_AXES;
+            bool is_x = (in->code == ABS_MT_POSITION_X) != swap;
+            if(slot) {
+                if(is_x) slot->x = in->value;
+                else slot->y = in->value;
+            }
+            /*Without tracking IDs (protocol A) the positions are used as single touch coordinates*/
+            if(!dev->mt) {
+                if(is_x) dev->root_x = in->value;
+                else dev->root_y = in->value;
+            }
+        }
+        else return false;
+    } else if(in->type == EV_KEY) {
+        if(in->code == BTN_MOUSE || in->code == BTN_TOUCH) {
+            if(in->value == 0)
+                dev->button = LV_INDEV_STATE_REL;
+            else if(in->value == 1)
+                dev->button = LV_INDEV_STATE_PR;
+        } else if(in->code == KEY_LEFTSHIFT || in->code == KEY_RIGHTSHIFT) {
+            dev->shift = in->value != 0;
+            return false;
+        } else if(in->code < BTN_MISC) {
+            /*Every key of a keyboard is a sample, as a frame can contain more keys.
+             *They are ignored by the pointer input devices.*/
+            dev->key_val = evdev_map_key(in->code, dev->shift);
+            dev->key_code = in->code;
+            dev->key_state = in->value ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+            return evdev_push(dev, evdev_time_to_tick(dev, in));
+        }
+        else return false;
+    }
+    else return false;
+
+    dev->changed = true;
+    return false;
+}
+
+/**
+ * Read the current state of the device after the kernel dropped events
+ * @param dev the device
+ */
+static void evdev_resync(evdev_dev_t * dev)
+{
+    unsigned long key_bits[EVDEV_BITS_SIZE(KEY_MAX)];
+    lv_memset_00(key_bits, sizeof(key_bits));
+    if(EVDEV_IOCTL(dev->fd, EVIOCGKEY(sizeof(key_bits)), key_bits) >= 0) {
+        bool pressed = EVDEV_BIT_TEST(key_bits, BTN_TOUCH) || EVDEV_BIT_TEST(key_bits, BTN_MOUSE);
+        dev->button = pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+        dev->shift = EVDEV_BIT_TEST(key_bits, KEY_LEFTSHIFT) || EVDEV_BIT_TEST(key_bits, KEY_RIGHTSHIFT);
+        if(dev->key_state == LV_INDEV_STATE_PR && !EVDEV_BIT_TEST(key_bits, dev->key_code)) {
+            dev->key_state = LV_INDEV_STATE_REL;
+        }
+    }
+
+    bool swap = EVDEV_SWAP_AXES;
+    struct input_absinfo abs;
+    if(EVDEV_IOCTL(dev->fd, EVIOCGABS(ABS_X), &abs) >= 0) {
+        if(swap) dev->root_y = abs.value;
+        else dev->root_x = abs.value;
+    }
+    if(EVDEV_IOCTL(dev->fd, EVIOCGABS(ABS_Y), &abs) >= 0) {
+        if(swap) dev->root_x = abs.value;
+        else dev->root_y = abs.value;
+    }
+
+    if(!dev->mt) return;
+
+    if(EVDEV_IOCTL(dev->fd, EVIOCGABS(ABS_MT_SLOT), &abs) >= 0) dev->slot = abs.value;
+
+#ifdef EVIOCGMTSLOTS
+    /*The tracking IDs and the positions of the slots*/
+    struct {
+        uint32_t code;
+        int32_t values[EVDEV_SLOT_MAX];
+    } mt;
+    uint32_t i;
+    mt.code = ABS_MT_TRACKING_ID;
+    if(EVDEV_IOCTL(dev->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+        for(i = 0; i < EVDEV_SLOT_MAX; i++) dev->slots[i].id = mt.values[i];
+    }
+    mt.code = swap ? ABS_MT_POSITION_Y : ABS_MT_POSITION_X;
+    if(EVDEV_IOCTL(dev->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+        for(i = 0; i < EVDEV_SLOT_MAX; i++) dev->slots[i].x = mt.values[i];
+    }
+    mt.code = swap ? ABS_MT_POSITION_X : ABS_MT_POSITION_Y;
+    if(EVDEV_IOCTL(dev->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+        for(i = 0; i < EVDEV_SLOT_MAX; i++) dev->slots[i].y = mt.values[i];
+    }
+#endif
+}
+
+/**
+ * Add the current state to the queue. If the queue is full the sample is kept aside
+ * and replaced by the newer samples until the consumer makes room for it.
+ * @param dev the device
+ * @param timestamp the time of the sample in ticks
+ * @return true: the sample was queued
+ */
+static bool evdev_push(evdev_dev_t * dev, uint32_t timestamp)
+{
+    evdev_frame_t * f = &dev->overflow;
+
+    /*Keep the wheel steps of a sample which couldn't be queued*/
+    int32_t enc_diff = (dev->overflowed ? f->enc_diff : 0) + dev->enc_diff;
+    f->enc_diff = (int16_t)LV_CLAMP(INT16_MIN, enc_diff, INT16_MAX);
+    dev->enc_diff = 0;
+
+    f->x = dev->root_x;
+    f->y = dev->root_y;
+    f->state = dev->button;
+
+    uint8_t cnt = 0;
+    if(dev->mt) {
+        uint32_t i;
+        for(i = 0; i < EVDEV_SLOT_MAX; i++) {
+            if(dev->slots[i].id == -1) continue;
+            f->touches[cnt] = dev->slots[i];
+            cnt++;
+        }
+
+        /*The pointer follows the first touch and the last position is kept after releasing*/
+        if(cnt) {
+            f->x = f->touches[0].x;
+            f->y = f->touches[0].y;
+            dev->root_x = f->x;
+            dev->root_y = f->y;
+        }
+        f->state = cnt ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    }
+    else if(dev->button == LV_INDEV_STATE_PR) {
+        f->touches[0].x = dev->root_x;
+        f->touches[0].y = dev->root_y;
+        f->touches[0].id = 0;
+        cnt = 1;
+    }
+    f->touch_cnt = cnt;
+
+    f->key = dev->key_val;
+    f->key_state = dev->key_state;
+    f->timestamp = timestamp;
+    dev->overflowed = true;
+
+    return evdev_queue_flush(dev);
+}
+
+/**
+ * Move the sample kept aside into the queue if there is room for it
+ * @param dev the device
+ * @return true: the sample was queued
+ */
+static bool evdev_queue_flush(evdev_dev_t * dev)
+{
+    if(!dev->overflowed) return false;
+
+    uint32_t next = EVDEV_QUEUE_NEXT(dev->queue_tail);
+    if(next == EVDEV_LOAD_ACQUIRE(dev->queue_head)) return false;
+
+    dev->queue[dev->queue_tail] = dev->overflow;
+    dev->overflowed = false;
+    EVDEV_STORE_RELEASE(dev->queue_tail, next);
+    return true;
+}
+
+/**
+ * Convert the time stamp of an event to the time base of `lv_tick_get()`
+ * @param dev the device of the event
+ * @param in an input event
+ * @return the tick of the event (never 0 which means "no time stamp")
+ */
+static uint32_t evdev_time_to_tick(evdev_dev_t * dev, const struct input_event * in)
+{
+    int64_t now_us;
+    if(dev->clock == CLOCK_MONOTONIC) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        now_us = (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    }
+    else {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        now_us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+    }
+
+    int64_t ev_us = (int64_t)in->input_event_sec * 1000000 + in->input_event_usec;
+    int64_t age_ms = (now_us - ev_us) / 1000;
+    if(age_ms < 0) age_ms = 0;
+    if(age_ms > 1000) age_ms = 1000;    /*Don't go far back in time if the clocks don't match*/
+
+    uint32_t tick = lv_tick_get() - (uint32_t)age_ms;
+    return tick ? tick : 1;
+}
+
+/**
+ * Convert a key code of evdev to an LVGL key
+ * @param code an evdev key code
+ * @param shift true: a shift key is pressed
+ * @return the LVGL key, the character of the key (US layout) or 0 if it's not used
+ */
+static uint32_t evdev_map_key(uint16_t code, bool shift)
+{
+    /*The characters of the keys from KEY_1 to KEY_SLASH*/
+    static const char chars[] = "1234567890-=\0\0qwertyuiop[]\0\0asdfghjkl;'`\0\\zxcvbnm,./";
+    static const char chars_shift[] = "!@#$%^&*()_+\0\0QWERTYUIOP{}\0\0ASDFGHJKL:\"~\0|ZXCVBNM<>?";
+
+    switch(code) {
+        case KEY_BACKSPACE:
+            return LV_KEY_BACKSPACE;
+        case KEY_ENTER:
+        case KEY_KPENTER:
+            return LV_KEY_ENTER;
+        case KEY_UP:
+            return LV_KEY_UP;
+        case KEY_LEFT:
+            return LV_KEY_PREV;
+        case KEY_RIGHT:
+            return LV_KEY_NEXT;
+        case KEY_DOWN:
+            return LV_KEY_DOWN;
+        case KEY_TAB:
+            return shift ? LV_KEY_PREV : LV_KEY_NEXT;
+        case KEY_ESC:
+            return LV_KEY_ESC;
+        case KEY_DELETE:
+            return LV_KEY_DEL;
+        case KEY_HOME:
+            return LV_KEY_HOME;
+        case KEY_END:
+            return LV_KEY_END;
+        case KEY_SPACE:
+            return ' ';
+        default:
+            if(code >= KEY_1 && code <= KEY_SLASH) {
+                return (uint8_t)(shift ? chars_shift : chars)[code - KEY_1];
+            }
+            return 0;
+    }
+}
+
+/**
+ * Convert the coordinates of the device to a point on the display
+ * @param drv pointer to the input device driver
+ * @param x the X coordinate of the device
+ * @param y the Y coordinate of the device
+ * @param point store the point on the display here
+ */
+static void evdev_to_point(lv_indev_drv_t * drv, int x, int y, lv_point_t * point)
+{
+#if EVDEV_CALIBRATE
+    point->x = map(x, EVDEV_HOR_MIN, EVDEV_HOR_MAX, 0, drv->disp->driver->hor_res);
+    point->y = map(y, EVDEV_VER_MIN, EVDEV_VER_MAX, 0, drv->disp->driver->ver_res);
+#else
+    point->x = x;
+    point->y = y;
+#endif
+
+    if(point->x < 0)
+      point->x = 0;
+    if(point->y < 0)
+      point->y = 0;
+    if(point->x >= drv->disp->driver->hor_res)
+      point->x = drv->disp->driver->hor_res - 1;
+    if(point->y >= drv->disp->driver->ver_res)
+      point->y = drv->disp->driver->ver_res - 1;
+}
+
+/**
+ * Tell the type of an input device from its capabilities
+ * @param fd the opened device
+ * @return the LVGL input device type to use or LV_INDEV_TYPE_NONE if the device is not used
+ */
+static lv_indev_type_t evdev_classify(int fd)
+{
+    unsigned long ev_bits[EVDEV_BITS_SIZE(EV_MAX)];
+    unsigned long abs_bits[EVDEV_BITS_SIZE(ABS_MAX)];
+    unsigned long rel_bits[EVDEV_BITS_SIZE(REL_MAX)];
+    unsigned long key_bits[EVDEV_BITS_SIZE(KEY_MAX)];
+    lv_memset_00(ev_bits, sizeof(ev_bits));
+    lv_memset_00(abs_bits, sizeof(abs_bits));
+    lv_memset_00(rel_bits, sizeof(rel_bits));
+    lv_memset_00(key_bits, sizeof(key_bits));
+
+    if(EVDEV_IOCTL(fd, EVIOCGBIT(0, sizeof(ev_bits)), ev_bits) < 0) return LV_INDEV_TYPE_NONE;
+    if(EVDEV_BIT_TEST(ev_bits, EV_ABS)) EVDEV_IOCTL(fd, EVIOCGBIT(EV_ABS, sizeof(abs_bits)), abs_bits);
+    if(EVDEV_BIT_TEST(ev_bits, EV_REL)) EVDEV_IOCTL(fd, EVIOCGBIT(EV_REL, sizeof(rel_bits)), rel_bits);
+    if(EVDEV_BIT_TEST(ev_bits, EV_KEY)) EVDEV_IOCTL(fd, EVIOCGBIT(EV_KEY, sizeof(key_bits)), key_bits);
+
+    /*Touchscreen: absolute coordinates with touches*/
+    if(EVDEV_BIT_TEST(abs_bits, ABS_MT_SLOT) && EVDEV_BIT_TEST(abs_bits, ABS_MT_POSITION_X)) {
+        return LV_INDEV_TYPE_MULTI_POINTER;
+    }
+    if(EVDEV_BIT_TEST(abs_bits, ABS_X) && EVDEV_BIT_TEST(abs_bits, ABS_Y) && EVDEV_BIT_TEST(key_bits, BTN_TOUCH)) {
+        return LV_INDEV_TYPE_POINTER;
+    }
+
+    /*Mouse*/
+    if(EVDEV_BIT_TEST(rel_bits, REL_X) && EVDEV_BIT_TEST(rel_bits, REL_Y) && EVDEV_BIT_TEST(key_bits, BTN_LEFT)) {
+        return LV_INDEV_TYPE_POINTER;
+    }
+
+    /*Rotary encoder: a single relative axis*/
+    if(EVDEV_BIT_TEST(rel_bits, REL_DIAL) || EVDEV_BIT_TEST(rel_bits, REL_WHEEL) ||
+       (EVDEV_BIT_TEST(rel_bits, REL_X) && !EVDEV_BIT_TEST(rel_bits, REL_Y))) {
+        return LV_INDEV_TYPE_ENCODER;
+    }
+
+    /*Keyboard or keypad (e.g. a barcode reader), not just a power button*/
+    if(EVDEV_BIT_TEST(key_bits, KEY_ENTER) || EVDEV_BIT_TEST(key_bits, KEY_A) ||
+       EVDEV_BIT_TEST(key_bits, KEY_1) || EVDEV_BIT_TEST(key_bits, KEY_UP)) {
+        return LV_INDEV_TYPE_KEYPAD;
+    }
+
+    return LV_INDEV_TYPE_NONE;
+}
+
+#if EVDEV_THREAD
+/**
+ * Create the eventfd signaled by the input threads
+ */
+static void evdev_wake_init(void)
+{
+    if(evdev_wake_fd != -1) return;
+
+    evdev_wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(evdev_wake_fd == -1) perror("unable to create evdev eventfd:");
+}
+
+/**
+ * Start reading a device on a separate thread
+ * @param dev the opened device
+ */
+static void evdev_thread_start(evdev_dev_t * dev)
+{
+    evdev_wake_init();
+    if(evdev_wake_fd == -1) return;
+
+    dev->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(dev->stop_fd == -1) {
+        perror("unable to create evdev eventfd:");
+        return;
+    }
+
+    dev->thread_quit = false;
+    if(pthread_create(&dev->thread, NULL, evdev_thread_main, dev) != 0) {
+        perror("unable to start evdev thread:");
+        close(dev->stop_fd);
+        return;
+    }
+    dev->thread_run = true;
+}
+
+/**
+ * Stop the input thread to not use the device while it's changed.
+ * The thread is not cancelled to not leave it in the middle of queuing a sample,
+ * it returns when it sees the request.
+ * @param dev the device
+ */
+static void evdev_thread_stop(evdev_dev_t * dev)
+{
+    if(!dev->thread_run) return;
+
+    EVDEV_STORE_RELEASE(dev->thread_quit, true);
+    eventfd_write(dev->stop_fd, 1);
+    pthread_join(dev->thread, NULL);
+    dev->thread_run = false;
+
+    close(dev->stop_fd);
+    dev->stop_fd = -1;
+}
+
+/**
+ * Wait for the events of a device and queue the samples
+ * @param arg the device
+ * @return NULL
+ */
+static void * evdev_thread_main(void * arg)
+{
+    evdev_dev_t * dev = arg;
+
+    struct pollfd pfd[2];
+    pfd[0].fd = dev->fd;
+    pfd[0].events = POLLIN;
+    pfd[1].fd = dev->stop_fd;
+    pfd[1].events = POLLIN;
+
+    while(!EVDEV_LOAD_ACQUIRE(dev->thread_quit)) {
+        /*Retry soon to queue the sample kept aside when the queue was full*/
+        int timeout = dev->overflowed ? 5 : -1;
+        if(poll(pfd, 2, timeout) < 0) {
+            if(errno == EINTR) continue;
+            perror("evdev poll:");
+            break;
+        }
+
+        if(EVDEV_LOAD_ACQUIRE(dev->thread_quit)) break;
+
+        /*The device was removed*/
+        if(pfd[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            EVDEV_STORE_RELEASE(dev->removed, true);
+            break;
+        }
+
+        if(evdev_poll(dev)) eventfd_write(evdev_wake_fd, 1);
+        if(EVDEV_LOAD_ACQUIRE(dev->removed)) break;
+    }
+
+    return NULL;
+}
+#endif /*EVDEV_THREAD*/
+
+#if EVDEV_HOTPLUG
+/**
+ * Close the removed devices and open the new ones in EVDEV_DIR
+ */
+static void evdev_hotplug_scan(void)
+{
+    uint32_t i;
+    for(i = 0; i < EVDEV_DEV_MAX; i++) {
+        evdev_dev_t * dev = &evdev_devs[i];
+        if(dev->fd == -1) continue;
+
+        struct stat st;
+        if(EVDEV_LOAD_ACQUIRE(dev->removed) || stat(dev->path, &st) != 0) evdev_hotplug_remove(dev);
+    }
+
+    DIR * dir = opendir(EVDEV_DIR);
+    if(dir == NULL) return;
+
+    struct dirent * ent;
+    while((ent = readdir(dir)) != NULL) {
+        if(strncmp(ent->d_name, "event", 5) != 0) continue;
+
+        char path[EVDEV_PATH_MAX];
+        lv_snprintf(path, sizeof(path), "%s/%s", EVDEV_DIR, ent->d_name);
+
+        /*Skip the opened devices*/
+        for(i = 0; i < EVDEV_DEV_MAX; i++) {
+            if(evdev_devs[i].fd != -1 && strcmp(evdev_devs[i].path, path) == 0) break;
+        }
+        if(i == EVDEV_DEV_MAX) evdev_hotplug_add(path);
+    }
+
+    closedir(dir);
+}
+
+/**
+ * Open a new device and read it with an input device of its type.
+ * The not used input devices of the removed devices are reused because they can't be deleted.
+ * @param path the device file
+ */
+static void evdev_hotplug_add(const char * path)
+{
+    int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    /*Might be not accessible yet. Retried when its permissions are set.*/
+    if(fd == -1) return;
+
+    lv_indev_type_t type = evdev_classify(fd);
+    close(fd);
+    if(type == LV_INDEV_TYPE_NONE) return;
+
+    evdev_dev_t * dev = NULL;
+    uint32_t i;
+    for(i = 0; i < EVDEV_DEV_MAX; i++) {
+        if(evdev_devs[i].fd == -1 && evdev_devs[i].indev && evdev_devs[i].drv.type == type) {
+            dev = &evdev_devs[i];
+            break;
+        }
+    }
+
+    if(dev == NULL) {
+        for(i = 0; i < EVDEV_DEV_MAX; i++) {
+            if(evdev_devs[i].indev == NULL) {
+                dev = &evdev_devs[i];
+                break;
+            }
+        }
+    }
+
+    if(dev == NULL) {
+        LV_LOG_WARN("too many input devices, %s is not used", path);
+        return;
+    }
+
+    if(!evdev_open(dev, path)) return;
+
+    if(dev->indev == NULL) {
+        evdev_indev_drv_init(&dev->drv, type);
+        dev->indev = lv_indev_drv_register(&dev->drv);
+
+        /*Keypads and encoders control the default group*/
+        if(type == LV_INDEV_TYPE_KEYPAD || type == LV_INDEV_TYPE_ENCODER) {
+            lv_indev_set_group(dev->indev, lv_group_get_default());
+        }
+    }
+    lv_indev_enable(dev->indev, true);
+
+#if EVDEV_THREAD
+    evdev_thread_start(dev);
+#endif
+
+    LV_LOG_INFO("%s is added as input device type %d", path, type);
+}
+
+/**
+ * Close a removed device. Its input device is released and kept for a new device.
+ * @param dev the device
+ */
+static void evdev_hotplug_remove(evdev_dev_t * dev)
+{
+    LV_LOG_INFO("%s is removed", dev->path);
+
+    evdev_close(dev);
+    evdev_reset(dev);
+
+    /*Forget the pressed object and don't read the device until it's reused*/
+    lv_indev_reset(dev->indev, NULL);
+    lv_indev_enable(dev->indev, false);
+}
+
+/**
+ * Check the changes in EVDEV_DIR
+ * @param timer pointer to the timer
+ */
+static void evdev_hotplug_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+    bool changed = evdev_notify_fd == -1;   /*Scan periodically without inotify*/
+
+#if USE_BSD_EVDEV == 0
+    if(evdev_notify_fd != -1) {
+        char buf[1024];
+        while(read(evdev_notify_fd, buf, sizeof(buf)) > 0) changed = true;
+    }
+#endif
+
+    /*A device is gone even if its file wasn't deleted yet*/
+    uint32_t i;
+    for(i = 0; i < EVDEV_DEV_MAX; i++) {
+        if(evdev_devs[i].fd != -1 && EVDEV_LOAD_ACQUIRE(evdev_devs[i].removed)) changed = true;
+    }
+
+    if(changed) evdev_hotplug_scan();
+}
+#endif /*EVDEV_HOTPLUG*/
+
 #endif
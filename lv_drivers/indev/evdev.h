@@ -53,11 +53,33 @@ void evdev_init(void);
  */
 bool evdev_set_file(char* dev_name);
 /**
- * Get the current position and state of the evdev
- * @param data store the evdev data here
- * @return false: because the points are not buffered, so no more data to be read
+ * Initialize an input device driver to read the evdev: set `read_cb` and, if `EVDEV_FILTER` is enabled,
+ * the pointer filter with `EVDEV_FILTER_MIN_CUTOFF`, `EVDEV_FILTER_BETA` and `EVDEV_PREDICT_TIME`
+ * @param drv pointer to the input device driver to initialize
+ * @param type the type of the input device
+ */
+void evdev_indev_drv_init(lv_indev_drv_t * drv, lv_indev_type_t type);
+#if EVDEV_HOTPLUG
+/**
+ * Open every input device of EVDEV_DIR and register an LVGL input device for each
+ * by their capabilities (touchscreen, mouse, rotary encoder or keyboard).
+ * The devices plugged in and removed later are followed without restarting.
+ * Keypads and encoders get the default group. Call it after registering the display.
+ */
+void evdev_hotplug_init(void);
+#endif
+/**
+ * Get the buffered samples of the evdev one by one with their time stamps
+ * @param drv pointer to the input device driver
+ * @param data store the evdev data here. `continue_reading` is set if there are more samples.
  */
 void evdev_read(lv_indev_drv_t * drv, lv_indev_data_t * data);
+/**
+ * Get the file descriptor which becomes readable when the input thread has new samples.
+ * Poll it in the main loop to process the input without waiting for the read period.
+ * @return the file descriptor or -1 if the events are not read on a separate thread
+ */
+int evdev_get_wake_fd(void);
 
 
 /**********************
@@ -15,33 +15,82 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <stdbool.h>
-#include <poll.h>
+#include <time.h>
 #include <libinput.h>
+#if LIBINPUT_THREAD
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#endif
 
 /*********************
  *      DEFINES
  *********************/
+#ifndef LIBINPUT_QUEUE_SIZE
+#define LIBINPUT_QUEUE_SIZE     32
+#endif
+
+/*Number of the tracked touch slots*/
+#ifndef LIBINPUT_SLOT_MAX
+#define LIBINPUT_SLOT_MAX       LV_INDEV_TOUCH_MAX
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*A sample: the state of the touches at a touch frame*/
+typedef struct {
+  lv_point_t point;
+  lv_indev_state_t state;
+  uint32_t timestamp;
+  lv_indev_touch_t touches[LIBINPUT_SLOT_MAX];  /*The touching slots in slot order*/
+  uint8_t touch_cnt;
+} libinput_frame_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static int open_restricted(const char *path, int flags, void *user_data);
 static void close_restricted(int fd, void *user_data);
+static bool libinput_poll(void);
+static bool libinput_push(uint32_t timestamp);
+static bool libinput_queue_flush(void);
+static uint32_t libinput_time_to_tick(uint32_t time_ms);
+#if LIBINPUT_THREAD
+static void libinput_wake_init(void);
+static void libinput_thread_start(void);
+static void libinput_thread_stop(void);
+static void * libinput_thread_main(void * arg);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static int libinput_fd;
-static int libinput_button;
-static const int timeout = 0; // do not block
-static const nfds_t nfds = 1;
-static struct pollfd fds[1];
 static lv_point_t most_recent_touch_point = { .x = 0, .y = 0};
 
+/*The touches by slots. `id` is the slot or -1 if it's not touched.*/
+static lv_indev_touch_t libinput_slots[LIBINPUT_SLOT_MAX];
+static bool libinput_slots_changed;         /*The slots have changed since the last frame*/
+
+/*Single producer (`libinput_poll`) single consumer (`libinput_read`) ring of the samples.
+ *Only the producer writes `tail` and only the consumer writes `head`.*/
+static libinput_frame_t libinput_queue[LIBINPUT_QUEUE_SIZE];
+static uint32_t libinput_queue_head;
+static uint32_t libinput_queue_tail;
+static libinput_frame_t libinput_overflow;  /*The newest sample which didn't fit into the queue*/
+static bool libinput_overflowed;
+static uint32_t libinput_batch_left;        /*Samples to report in the current `continue_reading` sequence*/
+static libinput_frame_t libinput_last;      /*The last reported sample*/
+
+#if LIBINPUT_THREAD
+static pthread_t libinput_thread;
+static bool libinput_thread_run;
+static bool libinput_thread_quit;           /*Asks the input thread to return*/
+static int libinput_stop_fd = -1;           /*Wakes the input thread to check `libinput_thread_quit`*/
+static int libinput_wake_fd = -1;           /*Signaled by the input thread if there are new samples*/
+#endif
+
 static struct libinput *libinput_context;
 static struct libinput_device *libinput_device;
 const static struct libinput_interface interface = {
@@ -52,6 +101,11 @@ const static struct libinput_interface interface = {
 /**********************
  *      MACROS
  **********************/
+#define LIBINPUT_QUEUE_NEXT(i) (((i) + 1) % LIBINPUT_QUEUE_SIZE)
+
+/*The samples are written before publishing the new tail and read before releasing the slot*/
+#define LIBINPUT_LOAD_ACQUIRE(v)       __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define LIBINPUT_STORE_RELEASE(v, x)   __atomic_store_n(&(v), (x), __ATOMIC_RELEASE)
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -65,6 +119,11 @@ const static struct libinput_interface interface = {
  */
 bool libinput_set_file(char* dev_name)
 {
+#if LIBINPUT_THREAD
+  /*The context is used by the input thread*/
+  libinput_thread_stop();
+#endif
+
   // This check *should* not be necessary, yet applications crashes even on NULL handles.
   // citing libinput.h:libinput_path_remove_device:
   // > If no matching device exists, this function does nothing.
@@ -84,7 +143,18 @@ bool libinput_set_file(char* dev_name)
     return false;
   }
 
-  libinput_button = LV_INDEV_STATE_REL;
+  uint32_t i;
+  for(i = 0; i < LIBINPUT_SLOT_MAX; i++) libinput_slots[i].id = -1;
+  libinput_slots_changed = false;
+  libinput_queue_head = 0;
+  libinput_queue_tail = 0;
+  libinput_overflowed = false;
+  libinput_batch_left = 0;
+  libinput_last.state = LV_INDEV_STATE_REL;
+
+#if LIBINPUT_THREAD
+  if(libinput_fd >= 0) libinput_thread_start();
+#endif
 
   return true;
 }
@@ -95,6 +165,13 @@ bool libinput_set_file(char* dev_name)
 void libinput_init(void)
 {
   libinput_device = NULL;
+  libinput_fd = -1;
+
+#if LIBINPUT_THREAD
+  /*Can be polled even if the device is added later*/
+  libinput_wake_init();
+#endif
+
   libinput_context = libinput_path_create_context(&interface, NULL);
   if(!libinput_set_file(LIBINPUT_NAME)) {
       perror("unable to add device \"" LIBINPUT_NAME "\" to libinput context:");
@@ -102,74 +179,292 @@ void libinput_init(void)
   }
   libinput_fd = libinput_get_fd(libinput_context);
 
-  /* prepare poll */
-  fds[0].fd = libinput_fd;
-  fds[0].events = POLLIN;
-  fds[0].revents = 0;
+#if LIBINPUT_THREAD
+  libinput_thread_start();
+#endif
 }
 
 /**
- * Get the current position and state of the libinput
+ * Get the buffered samples of libinput one by one with their time stamps
  * @param indev_drv driver object itself
- * @param data store the libinput data here
- * @return false: because the points are not buffered, so no more data to be read
+ * @param data store the libinput data here. `continue_reading` is set if there are more samples.
  */
-bool libinput_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+void libinput_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
 {
-  struct libinput_event *event;
-  struct libinput_event_touch *touch_event = NULL;
-  int rc = 0;
-
-  rc = poll(fds, nfds, timeout);
-  switch (rc){
-    case -1:
-      perror(NULL);
-    case 0:
-      goto report_most_recent_state;
-    default:
-      break;
+  /*Report only the samples which were queued when the reading started to not read forever*/
+  if(libinput_batch_left == 0) {
+#if LIBINPUT_THREAD == 0
+    /*libinput's fd is non-blocking so dispatching doesn't wait*/
+    libinput_poll();
+#endif
+    uint32_t tail = LIBINPUT_LOAD_ACQUIRE(libinput_queue_tail);
+    libinput_batch_left = (tail + LIBINPUT_QUEUE_SIZE - libinput_queue_head) % LIBINPUT_QUEUE_SIZE;
   }
+
+  if(libinput_batch_left) {
+    libinput_last = libinput_queue[libinput_queue_head];
+    LIBINPUT_STORE_RELEASE(libinput_queue_head, LIBINPUT_QUEUE_NEXT(libinput_queue_head));
+    libinput_batch_left--;
+    data->timestamp = libinput_last.timestamp;
+    data->continue_reading = libinput_batch_left != 0;
+  }
+  else {
+    /*No new sample: report the last state at the time of reading*/
+    data->timestamp = 0;
+    data->continue_reading = false;
+  }
+
+  data->point = libinput_last.point;
+  data->state = libinput_last.state;
+
+  if(indev_drv->type == LV_INDEV_TYPE_MULTI_POINTER) {
+    uint8_t cnt = LV_MIN(libinput_last.touch_cnt, LV_INDEV_TOUCH_MAX);
+    lv_memcpy(data->touches, libinput_last.touches, cnt * sizeof(lv_indev_touch_t));
+    data->touch_cnt = cnt;
+  }
+}
+
+/**
+ * Get the file descriptor which becomes readable when the input thread has new samples.
+ * Poll it in the main loop to process the input without waiting for the read period.
+ * @return the file descriptor or -1 if the events are not read on a separate thread
+ */
+int libinput_get_wake_fd(void)
+{
+#if LIBINPUT_THREAD
+  return libinput_wake_fd;
+#else
+  return -1;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int open_restricted(const char *path, int flags, void *user_data)
+{
+  int fd = open(path, flags);
+  return fd < 0 ? -errno : fd;
+}
+
+static void close_restricted(int fd, void *user_data)
+{
+  close(fd);
+}
+
+/**
+ * Process the pending events of libinput and queue the samples
+ * @return true: new samples were queued
+ */
+static bool libinput_poll(void)
+{
+  struct libinput_event *event;
+  struct libinput_event_touch *touch_event;
+  bool queued = libinput_queue_flush();
+  uint32_t i;
+
   libinput_dispatch(libinput_context);
   while((event = libinput_get_event(libinput_context)) != NULL) {
     enum libinput_event_type type = libinput_event_get_type(event);
+    int32_t slot;
     switch (type) {
       case LIBINPUT_EVENT_TOUCH_MOTION:
       case LIBINPUT_EVENT_TOUCH_DOWN:
         touch_event = libinput_event_get_touch_event(event);
-        most_recent_touch_point.x = libinput_event_touch_get_x_transformed(touch_event, LV_HOR_RES);
-        most_recent_touch_point.y = libinput_event_touch_get_y_transformed(touch_event, LV_VER_RES);
-        libinput_button = LV_INDEV_STATE_PR;
+        /*Single touch devices have no slots*/
+        slot = libinput_event_touch_get_slot(touch_event);
+        if(slot < 0) slot = 0;
+        if(slot < LIBINPUT_SLOT_MAX) {
+          libinput_slots[slot].id = slot;
+          libinput_slots[slot].point.x = libinput_event_touch_get_x_transformed(touch_event, LV_HOR_RES);
+          libinput_slots[slot].point.y = libinput_event_touch_get_y_transformed(touch_event, LV_VER_RES);
+          libinput_slots_changed = true;
+        }
         break;
       case LIBINPUT_EVENT_TOUCH_UP:
-        libinput_button = LV_INDEV_STATE_REL;
+        touch_event = libinput_event_get_touch_event(event);
+        slot = libinput_event_touch_get_slot(touch_event);
+        if(slot < 0) slot = 0;
+        if(slot < LIBINPUT_SLOT_MAX) {
+          libinput_slots[slot].id = -1;
+          libinput_slots_changed = true;
+        }
+        break;
+      case LIBINPUT_EVENT_TOUCH_CANCEL:
+        /*The touches are taken away (e.g. by the compositor): release all of them*/
+        for(i = 0; i < LIBINPUT_SLOT_MAX; i++) libinput_slots[i].id = -1;
+        libinput_slots_changed = true;
+        /*Fall through*/
+      case LIBINPUT_EVENT_TOUCH_FRAME:
+        /*The slots changed together are one sample*/
+        touch_event = libinput_event_get_touch_event(event);
+        if(libinput_slots_changed) {
+          if(libinput_push(libinput_time_to_tick(libinput_event_touch_get_time(touch_event)))) queued = true;
+          libinput_slots_changed = false;
+        }
         break;
       default:
         break;
     }
+
     libinput_event_destroy(event);
   }
-report_most_recent_state:
-  data->point.x = most_recent_touch_point.x;
-  data->point.y = most_recent_touch_point.y;
-  data->state = libinput_button;
 
-  return false;
+  return queued;
 }
 
+/**
+ * Queue the current state of the touches. If the queue is full the sample is kept aside
+ * and replaced by the newer samples until the consumer makes room for it.
+ * @param timestamp the time of the sample in ticks
+ * @return true: the sample was queued
+ */
+static bool libinput_push(uint32_t timestamp)
+{
+  uint8_t cnt = 0;
+  uint32_t i;
+  for(i = 0; i < LIBINPUT_SLOT_MAX; i++) {
+    if(libinput_slots[i].id == -1) continue;
+    libinput_overflow.touches[cnt] = libinput_slots[i];
+    cnt++;
+  }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+  /*The pointer follows the first touch and stays at its last position after releasing*/
+  if(cnt) most_recent_touch_point = libinput_overflow.touches[0].point;
+  libinput_overflow.touch_cnt = cnt;
+  libinput_overflow.point = most_recent_touch_point;
+  libinput_overflow.state = cnt ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  libinput_overflow.timestamp = timestamp;
+  libinput_overflowed = true;
 
-static int open_restricted(const char *path, int flags, void *user_data)
+  return libinput_queue_flush();
+}
+
+/**
+ * Move the sample kept aside into the queue if there is room for it
+ * @return true: the sample was queued
+ */
+static bool libinput_queue_flush(void)
 {
-  int fd = open(path, flags);
-  return fd < 0 ? -errno : fd;
+  if(!libinput_overflowed) return false;
+
+  uint32_t next = LIBINPUT_QUEUE_NEXT(libinput_queue_tail);
+  if(next == LIBINPUT_LOAD_ACQUIRE(libinput_queue_head)) return false;
+
+  libinput_queue[libinput_queue_tail] = libinput_overflow;
+  libinput_overflowed = false;
+  LIBINPUT_STORE_RELEASE(libinput_queue_tail, next);
+  return true;
 }
 
-static void close_restricted(int fd, void *user_data)
+/**
+ * Convert the time of a libinput event to the time base of `lv_tick_get()`
+ * @param time_ms the time of the event in milliseconds of CLOCK_MONOTONIC
+ * @return the tick of the event (never 0 which means "no time stamp")
+ */
+static uint32_t libinput_time_to_tick(uint32_t time_ms)
 {
-  close(fd);
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint32_t now_ms = (uint32_t)((uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+
+  int32_t age_ms = (int32_t)(now_ms - time_ms);
+  if(age_ms < 0) age_ms = 0;
+  if(age_ms > 1000) age_ms = 1000;
+
+  uint32_t tick = lv_tick_get() - (uint32_t)age_ms;
+  return tick ? tick : 1;
+}
+
+#if LIBINPUT_THREAD
+/**
+ * Create the eventfd signaled by the input thread
+ */
+static void libinput_wake_init(void)
+{
+  if(libinput_wake_fd != -1) return;
+
+  libinput_wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if(libinput_wake_fd == -1) perror("unable to create libinput eventfd:");
+}
+
+/**
+ * Start processing the events of libinput on a separate thread
+ */
+static void libinput_thread_start(void)
+{
+  if(libinput_thread_run) return;
+
+  libinput_wake_init();
+  if(libinput_wake_fd == -1) return;
+
+  if(libinput_stop_fd == -1) {
+    libinput_stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(libinput_stop_fd == -1) {
+      perror("unable to create libinput eventfd:");
+      return;
+    }
+  }
+
+  LIBINPUT_STORE_RELEASE(libinput_thread_quit, false);
+  if(pthread_create(&libinput_thread, NULL, libinput_thread_main, NULL) != 0) {
+    perror("unable to start libinput thread:");
+    return;
+  }
+  libinput_thread_run = true;
+}
+
+/**
+ * Stop the input thread to not use the context while it's changed.
+ * The thread is not cancelled because libinput's functions are not cancellation safe,
+ * it returns when it sees the request between two dispatches.
+ */
+static void libinput_thread_stop(void)
+{
+  if(!libinput_thread_run) return;
+
+  LIBINPUT_STORE_RELEASE(libinput_thread_quit, true);
+  eventfd_write(libinput_stop_fd, 1);
+  pthread_join(libinput_thread, NULL);
+  libinput_thread_run = false;
+
+  /*Clear the request*/
+  eventfd_t cnt;
+  eventfd_read(libinput_stop_fd, &cnt);
+}
+
+/**
+ * Wait for the events of libinput and queue the samples
+ * @param arg unused
+ * @return NULL
+ */
+static void * libinput_thread_main(void * arg)
+{
+  LV_UNUSED(arg);
+
+  struct pollfd pfd[2];
+  pfd[0].fd = libinput_fd;
+  pfd[0].events = POLLIN;
+  pfd[1].fd = libinput_stop_fd;
+  pfd[1].events = POLLIN;
+
+  while(!LIBINPUT_LOAD_ACQUIRE(libinput_thread_quit)) {
+    /*Retry soon to queue the sample kept aside when the queue was full*/
+    int timeout = libinput_overflowed ? 5 : -1;
+    if(poll(pfd, 2, timeout) < 0) {
+      if(errno == EINTR) continue;
+      perror("libinput poll:");
+      break;
+    }
+
+    if(LIBINPUT_LOAD_ACQUIRE(libinput_thread_quit)) break;
+
+    if(libinput_poll()) eventfd_write(libinput_wake_fd, 1);
+  }
+
+  return NULL;
 }
+#endif /*LIBINPUT_THREAD*/
 
 #endif
@@ -53,12 +53,17 @@ void libinput_init(void);
  */
 bool libinput_set_file(char* dev_name);
 /**
- * Get the current position and state of the libinput
+ * Get the buffered samples of libinput one by one with their time stamps
  * @param indev_drv driver object itself
- * @param data store the libinput data here
- * @return false: because the points are not buffered, so no more data to be read
+ * @param data store the libinput data here. `continue_reading` is set if there are more samples.
  */
-bool libinput_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
+void libinput_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
+/**
+ * Get the file descriptor which becomes readable when the input thread has new samples.
+ * Poll it in the main loop to process the input without waiting for the read period.
+ * @return the file descriptor or -1 if the events are not read on a separate thread
+ */
+int libinput_get_wake_fd(void);
 
 
 /**********************
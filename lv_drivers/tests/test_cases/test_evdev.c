@@ -0,0 +1,410 @@
+#if LV_BUILD_TEST
+#include "lvgl/lvgl.h"
+
+#include "unity/unity.h"
+
+void test_evdev_wake_fd_at_init(void);
+void test_evdev_queue_order(void);
+void test_evdev_queue_full(void);
+void test_evdev_thread_stop(void);
+void test_evdev_resync_touch(void);
+void test_evdev_resync_key(void);
+void test_evdev_encoder_rel_x(void);
+void test_evdev_pointer_rel_x(void);
+
+#if LV_COLOR_DEPTH == 32
+
+#include <stdarg.h>
+#include <sys/ioctl.h>
+
+/*Answer the capability and state queries of the driver as the device would*/
+static int test_ioctl(int fd, unsigned long req, ...);
+
+/*Build the driver with its own settings and a pipe in place of the device*/
+#define LV_DRV_NO_CONF
+#define USE_EVDEV           1
+#define USE_BSD_EVDEV       0
+#define EVDEV_NAME          "/nonexistent/event0"
+#define EVDEV_HOTPLUG       0
+#define EVDEV_SWAP_AXES     0
+#define EVDEV_QUEUE_SIZE    32
+#define EVDEV_FILTER        0
+#define EVDEV_THREAD        1
+#define EVDEV_CALIBRATE     0
+#define EVDEV_IOCTL         test_ioctl
+#include "../../indev/evdev.c"
+
+static int pipe_fd[2] = {-1, -1};
+static lv_indev_drv_t drv;
+
+/*The capabilities and the current state of the fake device*/
+static struct {
+  unsigned long ev[EVDEV_BITS_SIZE(EV_MAX)];
+  unsigned long key[EVDEV_BITS_SIZE(KEY_MAX)];
+  unsigned long rel[EVDEV_BITS_SIZE(REL_MAX)];
+  unsigned long abs[EVDEV_BITS_SIZE(ABS_MAX)];
+  unsigned long key_state[EVDEV_BITS_SIZE(KEY_MAX)];
+  int32_t abs_value[ABS_CNT];
+} fake;
+
+static int test_ioctl(int fd, unsigned long req, ...)
+{
+  LV_UNUSED(fd);
+
+  va_list args;
+  va_start(args, req);
+  void * arg = va_arg(args, void *);
+  va_end(args);
+
+  if(_IOC_TYPE(req) != 'E') {
+    errno = ENOTTY;
+    return -1;
+  }
+
+  unsigned long nr = _IOC_NR(req);
+  const void * src = NULL;
+  size_t src_size = 0;
+  if(nr == _IOC_NR(EVIOCGKEY(0))) {
+    src = fake.key_state;
+    src_size = sizeof(fake.key_state);
+  }
+  else if(nr == _IOC_NR(EVIOCGBIT(0, 0))) {
+    src = fake.ev;
+    src_size = sizeof(fake.ev);
+  }
+  else if(nr == _IOC_NR(EVIOCGBIT(EV_KEY, 0))) {
+    src = fake.key;
+    src_size = sizeof(fake.key);
+  }
+  else if(nr == _IOC_NR(EVIOCGBIT(EV_REL, 0))) {
+    src = fake.rel;
+    src_size = sizeof(fake.rel);
+  }
+  else if(nr == _IOC_NR(EVIOCGBIT(EV_ABS, 0))) {
+    src = fake.abs;
+    src_size = sizeof(fake.abs);
+  }
+  else if(nr >= _IOC_NR(EVIOCGABS(0)) && nr < _IOC_NR(EVIOCGABS(0)) + ABS_CNT) {
+    uint32_t code = nr - _IOC_NR(EVIOCGABS(0));
+    if(EVDEV_BIT_TEST(fake.abs, code)) {
+      struct input_absinfo * info = arg;
+      lv_memset_00(info, sizeof(*info));
+      info->value = fake.abs_value[code];
+      return 0;
+    }
+  }
+
+  /*E.g. EVIOCSCLOCKID and EVIOCGMTSLOTS are not supported*/
+  if(src == NULL) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  size_t size = _IOC_SIZE(req);
+  lv_memset_00(arg, size);
+  lv_memcpy(arg, src, LV_MIN(size, src_size));
+  return (int)LV_MIN(size, src_size);
+}
+
+static void fake_set(unsigned long * bits, uint32_t b, bool v)
+{
+  if(v) bits[b / EVDEV_LONG_BITS] |= 1UL << (b % EVDEV_LONG_BITS);
+  else bits[b / EVDEV_LONG_BITS] &= ~(1UL << (b % EVDEV_LONG_BITS));
+}
+
+void setUp(void)
+{
+  TEST_ASSERT_EQUAL(0, pipe(pipe_fd));
+  lv_memset_00(&fake, sizeof(fake));
+
+  lv_indev_drv_init(&drv);
+  drv.type = LV_INDEV_TYPE_POINTER;
+  drv.disp = lv_disp_get_default();
+}
+
+void tearDown(void)
+{
+  evdev_close(&evdev_default);
+  close(pipe_fd[0]);
+  close(pipe_fd[1]);
+}
+
+static void open_pipe(void)
+{
+  char path[32];
+  lv_snprintf(path, sizeof(path), "/proc/self/fd/%d", pipe_fd[0]);
+  TEST_ASSERT_TRUE(evdev_set_file(path));
+}
+
+/*Write touch frames with x = first..first + cnt - 1*/
+static void write_frames(int first, int cnt)
+{
+  static struct input_event ev[3 * 64];
+  TEST_ASSERT_LESS_OR_EQUAL(64, cnt);
+
+  lv_memset_00(ev, sizeof(ev));
+  int i;
+  for(i = 0; i < cnt; i++) {
+    ev[i * 3].type = EV_KEY;
+    ev[i * 3].code = BTN_TOUCH;
+    ev[i * 3].value = 1;
+    ev[i * 3 + 1].type = EV_ABS;
+    ev[i * 3 + 1].code = ABS_X;
+    ev[i * 3 + 1].value = first + i;
+    ev[i * 3 + 2].type = EV_SYN;
+    ev[i * 3 + 2].code = SYN_REPORT;
+  }
+
+  size_t len = (size_t)cnt * 3 * sizeof(struct input_event);
+  TEST_ASSERT_EQUAL((ssize_t)len, write(pipe_fd[1], ev, len));
+}
+
+static void write_event(uint16_t type, uint16_t code, int32_t value)
+{
+  struct input_event ev;
+  lv_memset_00(&ev, sizeof(ev));
+  ev.type = type;
+  ev.code = code;
+  ev.value = value;
+  TEST_ASSERT_EQUAL(sizeof(ev), write(pipe_fd[1], &ev, sizeof(ev)));
+}
+
+/*Wait for the wake fd and read the queued samples until the last*/
+static bool read_last(lv_indev_data_t * data)
+{
+  struct pollfd pfd;
+  pfd.fd = evdev_get_wake_fd();
+  pfd.events = POLLIN;
+  if(poll(&pfd, 1, 1000) != 1) return false;
+
+  eventfd_t v;
+  eventfd_read(pfd.fd, &v);
+
+  do {
+    lv_memset_00(data, sizeof(*data));
+    evdev_read(&drv, data);
+  } while(data->continue_reading);
+
+  return true;
+}
+
+/*Wait for the wake fd and read the queued samples into `x`*/
+static uint32_t read_samples(int32_t * x, uint32_t max)
+{
+  struct pollfd pfd;
+  pfd.fd = evdev_get_wake_fd();
+  pfd.events = POLLIN;
+  if(poll(&pfd, 1, 1000) != 1) return 0;
+
+  eventfd_t v;
+  eventfd_read(pfd.fd, &v);
+
+  uint32_t cnt = 0;
+  lv_indev_data_t data;
+  do {
+    lv_memset_00(&data, sizeof(data));
+    evdev_read(&drv, &data);
+    if(data.timestamp == 0) break;
+    if(cnt < max) x[cnt] = data.point.x;
+    cnt++;
+  } while(data.continue_reading);
+
+  return cnt;
+}
+
+void test_evdev_wake_fd_at_init(void)
+{
+  /*Polled by the main loop even if the device can't be opened yet*/
+  evdev_init();
+  TEST_ASSERT_EQUAL(-1, evdev_default.fd);
+  TEST_ASSERT_NOT_EQUAL(-1, evdev_get_wake_fd());
+}
+
+void test_evdev_queue_order(void)
+{
+  open_pipe();
+  write_frames(0, 10);
+
+  int32_t x[64];
+  uint32_t cnt = 0;
+  uint32_t i;
+  for(i = 0; i < 10 && cnt < 10; i++) cnt += read_samples(&x[cnt], 64 - cnt);
+
+  /*Every frame is reported once in order*/
+  TEST_ASSERT_EQUAL(10, cnt);
+  for(i = 0; i < cnt; i++) TEST_ASSERT_EQUAL(i, x[i]);
+}
+
+void test_evdev_queue_full(void)
+{
+  open_pipe();
+  write_frames(0, 50);
+
+  /*Let the thread fill the queue before reading*/
+  usleep(50000);
+
+  int32_t x[64];
+  uint32_t cnt = 0;
+  uint32_t i;
+  for(i = 0; i < 10 && (cnt == 0 || x[cnt - 1] != 49); i++) cnt += read_samples(&x[cnt], 64 - cnt);
+
+  /*The queue holds one less than its size, then only the newest frame is kept aside*/
+  TEST_ASSERT_EQUAL(EVDEV_QUEUE_SIZE, cnt);
+  for(i = 0; i < EVDEV_QUEUE_SIZE - 1; i++) TEST_ASSERT_EQUAL(i, x[i]);
+  TEST_ASSERT_EQUAL(49, x[cnt - 1]);
+}
+
+void test_evdev_thread_stop(void)
+{
+  open_pipe();
+  TEST_ASSERT_TRUE(evdev_default.thread_run);
+
+  /*The thread blocked in poll() returns and is joined*/
+  evdev_close(&evdev_default);
+  TEST_ASSERT_FALSE(evdev_default.thread_run);
+  TEST_ASSERT_EQUAL(-1, evdev_default.fd);
+
+  /*The events written while stopped are read by the next thread*/
+  write_frames(7, 1);
+  open_pipe();
+  int32_t x[1];
+  TEST_ASSERT_EQUAL(1, read_samples(x, 1));
+  TEST_ASSERT_EQUAL(7, x[0]);
+}
+
+void test_evdev_resync_touch(void)
+{
+  fake_set(fake.ev, EV_KEY, true);
+  fake_set(fake.ev, EV_ABS, true);
+  fake_set(fake.key, BTN_TOUCH, true);
+  fake_set(fake.abs, ABS_X, true);
+  fake_set(fake.abs, ABS_Y, true);
+  open_pipe();
+  TEST_ASSERT_EQUAL(LV_INDEV_TYPE_POINTER, evdev_default.type);
+
+  lv_indev_data_t data;
+  write_event(EV_KEY, BTN_TOUCH, 1);
+  write_event(EV_ABS, ABS_X, 10);
+  write_event(EV_ABS, ABS_Y, 20);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+  TEST_ASSERT_EQUAL(10, data.point.x);
+  TEST_ASSERT_EQUAL(20, data.point.y);
+
+  /*The release was dropped by the kernel, the state is read from the device*/
+  fake.abs_value[ABS_X] = 30;
+  fake.abs_value[ABS_Y] = 40;
+  write_event(EV_SYN, SYN_DROPPED, 0);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_REL, data.state);
+  TEST_ASSERT_EQUAL(30, data.point.x);
+  TEST_ASSERT_EQUAL(40, data.point.y);
+}
+
+void test_evdev_resync_key(void)
+{
+  fake_set(fake.ev, EV_KEY, true);
+  fake_set(fake.key, KEY_A, true);
+  open_pipe();
+  TEST_ASSERT_EQUAL(LV_INDEV_TYPE_KEYPAD, evdev_default.type);
+  drv.type = LV_INDEV_TYPE_KEYPAD;
+
+  lv_indev_data_t data;
+  fake_set(fake.key_state, KEY_A, true);
+  write_event(EV_KEY, KEY_A, 1);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+  TEST_ASSERT_EQUAL('a', data.key);
+
+  /*The key isn't stuck if its release was dropped*/
+  fake_set(fake.key_state, KEY_A, false);
+  write_event(EV_SYN, SYN_DROPPED, 0);
+  write_event(EV_KEY, KEY_A, 0);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_REL, data.state);
+  TEST_ASSERT_EQUAL('a', data.key);
+}
+
+void test_evdev_encoder_rel_x(void)
+{
+  fake_set(fake.ev, EV_REL, true);
+  fake_set(fake.rel, REL_X, true);
+  open_pipe();
+  TEST_ASSERT_EQUAL(LV_INDEV_TYPE_ENCODER, evdev_default.type);
+  drv.type = LV_INDEV_TYPE_ENCODER;
+
+  lv_indev_data_t data;
+  write_event(EV_REL, REL_X, 3);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(3, data.enc_diff);
+}
+
+void test_evdev_pointer_rel_x(void)
+{
+  fake_set(fake.ev, EV_REL, true);
+  fake_set(fake.ev, EV_KEY, true);
+  fake_set(fake.rel, REL_X, true);
+  fake_set(fake.rel, REL_Y, true);
+  fake_set(fake.key, BTN_LEFT, true);
+  open_pipe();
+  TEST_ASSERT_EQUAL(LV_INDEV_TYPE_POINTER, evdev_default.type);
+
+  /*A mouse moves only the pointer*/
+  lv_indev_data_t data;
+  write_event(EV_REL, REL_X, 3);
+  write_event(EV_SYN, SYN_REPORT, 0);
+  TEST_ASSERT_TRUE(read_last(&data));
+  TEST_ASSERT_EQUAL(3, data.point.x);
+  TEST_ASSERT_EQUAL(0, evdev_default.last.enc_diff);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_evdev_wake_fd_at_init(void)
+{
+}
+
+void test_evdev_queue_order(void)
+{
+}
+
+void test_evdev_queue_full(void)
+{
+}
+
+void test_evdev_thread_stop(void)
+{
+}
+
+void test_evdev_resync_touch(void)
+{
+}
+
+void test_evdev_resync_key(void)
+{
+}
+
+void test_evdev_encoder_rel_x(void)
+{
+}
+
+void test_evdev_pointer_rel_x(void)
+{
+}
+
+#endif
+
+#endif
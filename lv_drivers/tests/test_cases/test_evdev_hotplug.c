@@ -0,0 +1,140 @@
+#if LV_BUILD_TEST
+#include "lvgl/lvgl.h"
+
+#include "unity/unity.h"
+
+void test_evdev_hotplug_uinput(void);
+
+#if LV_COLOR_DEPTH == 32
+
+/*Build the driver with its own settings to follow the devices of /dev/input*/
+#define LV_DRV_NO_CONF
+#define USE_EVDEV           1
+#define USE_BSD_EVDEV       0
+#define EVDEV_NAME          "/nonexistent/event0"
+#define EVDEV_HOTPLUG       1
+#define EVDEV_SWAP_AXES     0
+#define EVDEV_QUEUE_SIZE    32
+#define EVDEV_FILTER        0
+#define EVDEV_THREAD        1
+#define EVDEV_CALIBRATE     0
+#include "../../indev/evdev.c"
+
+#include <linux/uinput.h>
+
+static int uinput_fd = -1;
+
+void setUp(void)
+{
+  /*Needs the uinput module and the permission to create devices*/
+  uinput_fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+}
+
+void tearDown(void)
+{
+  if(uinput_fd != -1) close(uinput_fd);
+}
+
+static void uinput_emit(uint16_t type, uint16_t code, int32_t value)
+{
+  struct input_event ev;
+  lv_memset_00(&ev, sizeof(ev));
+  ev.type = type;
+  ev.code = code;
+  ev.value = value;
+  TEST_ASSERT_EQUAL(sizeof(ev), write(uinput_fd, &ev, sizeof(ev)));
+}
+
+/*Run the hotplug timer until a device is opened or closed*/
+static evdev_dev_t * wait_for_change(bool * opened)
+{
+  uint32_t i;
+  uint32_t t;
+  for(t = 0; t < 100; t++) {
+    lv_tick_inc(EVDEV_HOTPLUG_PERIOD);
+    lv_timer_handler();
+    for(i = 0; i < EVDEV_DEV_MAX; i++) {
+      if((evdev_devs[i].fd != -1) != opened[i]) return &evdev_devs[i];
+    }
+    usleep(20000);
+  }
+
+  return NULL;
+}
+
+void test_evdev_hotplug_uinput(void)
+{
+  if(uinput_fd == -1) TEST_IGNORE_MESSAGE("/dev/uinput is not available");
+
+  evdev_hotplug_init();
+
+  /*The devices of the system are already used*/
+  bool opened[EVDEV_DEV_MAX];
+  uint32_t i;
+  for(i = 0; i < EVDEV_DEV_MAX; i++) opened[i] = evdev_devs[i].fd != -1;
+
+  /*Plug in a touchscreen*/
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_SET_EVBIT, EV_KEY));
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_SET_EVBIT, EV_ABS));
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_SET_KEYBIT, BTN_TOUCH));
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_SET_ABSBIT, ABS_X));
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_SET_ABSBIT, ABS_Y));
+
+  struct uinput_user_dev udev;
+  lv_memset_00(&udev, sizeof(udev));
+  lv_snprintf(udev.name, sizeof(udev.name), "lvgl test touchscreen");
+  udev.id.bustype = BUS_VIRTUAL;
+  udev.absmax[ABS_X] = 799;
+  udev.absmax[ABS_Y] = 479;
+  TEST_ASSERT_EQUAL(sizeof(udev), write(uinput_fd, &udev, sizeof(udev)));
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_DEV_CREATE));
+
+  evdev_dev_t * dev = wait_for_change(opened);
+  TEST_ASSERT_NOT_NULL(dev);
+  TEST_ASSERT_EQUAL(LV_INDEV_TYPE_POINTER, dev->drv.type);
+  TEST_ASSERT_NOT_NULL(dev->indev);
+  TEST_ASSERT_FALSE(dev->indev->proc.disabled);
+  opened[dev - evdev_devs] = true;
+
+  /*Its events are read by its own input device*/
+  uinput_emit(EV_KEY, BTN_TOUCH, 1);
+  uinput_emit(EV_ABS, ABS_X, 10);
+  uinput_emit(EV_ABS, ABS_Y, 20);
+  uinput_emit(EV_SYN, SYN_REPORT, 0);
+
+  struct pollfd pfd;
+  pfd.fd = evdev_get_wake_fd();
+  pfd.events = POLLIN;
+  TEST_ASSERT_EQUAL(1, poll(&pfd, 1, 1000));
+
+  lv_indev_data_t data;
+  lv_memset_00(&data, sizeof(data));
+  evdev_read(&dev->drv, &data);
+  TEST_ASSERT_EQUAL(LV_INDEV_STATE_PR, data.state);
+  TEST_ASSERT_EQUAL(10, data.point.x);
+  TEST_ASSERT_EQUAL(20, data.point.y);
+
+  /*Unplug it: the input device is kept but disabled*/
+  TEST_ASSERT_EQUAL(0, ioctl(uinput_fd, UI_DEV_DESTROY));
+  TEST_ASSERT_EQUAL_PTR(dev, wait_for_change(opened));
+  TEST_ASSERT_EQUAL(-1, dev->fd);
+  TEST_ASSERT_TRUE(dev->indev->proc.disabled);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_evdev_hotplug_uinput(void)
+{
+}
+
+#endif
+
+#endif
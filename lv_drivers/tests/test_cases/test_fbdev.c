@@ -0,0 +1,414 @@
+#if LV_BUILD_TEST
+#include "lvgl/lvgl.h"
+
+#include "unity/unity.h"
+
+void test_fbdev_select_conv(void);
+void test_fbdev_conv_channels(void);
+void test_fbdev_dither_bounds(void);
+void test_fbdev_rotate(void);
+void test_fbdev_rotate_flush(void);
+void test_fbdev_rotate_1bpp(void);
+
+#if LV_COLOR_DEPTH == 32
+
+/*Build the driver with its own settings. Only the conversions are tested, no device is opened.*/
+#define LV_DRV_NO_CONF
+#define USE_FBDEV           1
+#define USE_BSD_FBDEV       0
+#define USE_DRM             0
+#define USE_FLUSH_THREAD    0
+#define FBDEV_PATH          "/nonexistent/fb0"
+#define FBDEV_VSYNC         0
+#define FBDEV_DITHER        1
+#include "../../display/flush_rotate.c"
+#include "../../display/fbdev.c"
+
+typedef struct {
+  uint32_t bpp;
+  uint8_t r_ofs, r_len;
+  uint8_t g_ofs, g_len;
+  uint8_t b_ofs, b_len;
+} fb_format_t;
+
+static void set_format(const fb_format_t * f)
+{
+  lv_memset_00(&vinfo, sizeof(vinfo));
+  vinfo.bits_per_pixel = f->bpp;
+  vinfo.red.offset = f->r_ofs;
+  vinfo.red.length = f->r_len;
+  vinfo.green.offset = f->g_ofs;
+  vinfo.green.length = f->g_len;
+  vinfo.blue.offset = f->b_ofs;
+  vinfo.blue.length = f->b_len;
+  fbdev_select_conv();
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_fbdev_select_conv(void)
+{
+  static const struct {
+    fb_format_t format;
+    fbdev_conv_t conv;
+    uint32_t px_size;
+  } cases[] = {
+    {{32, 16, 8, 8, 8, 0, 8}, conv_copy, 4},        /*ARGB8888*/
+    {{32, 0, 8, 8, 8, 16, 8}, conv_xbgr8888, 4},    /*ABGR8888*/
+    {{32, 24, 8, 16, 8, 8, 8}, conv_generic, 4},    /*RGBX8888*/
+    {{24, 16, 8, 8, 8, 0, 8}, conv_rgb888, 3},
+    {{24, 0, 8, 8, 8, 16, 8}, conv_bgr888, 3},
+    {{16, 11, 5, 5, 6, 0, 5}, conv_rgb565, 2},
+    {{16, 0, 5, 5, 6, 11, 5}, conv_bgr565, 2},
+    {{16, 10, 5, 5, 5, 0, 5}, conv_generic, 2},     /*RGB555*/
+    {{8, 0, 8, 0, 8, 0, 8}, NULL, 1},
+    {{1, 0, 1, 0, 1, 0, 1}, NULL, 0},
+  };
+
+  uint32_t i;
+  for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    set_format(&cases[i].format);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(cases[i].conv, px_conv, "conversion");
+    TEST_ASSERT_EQUAL_MESSAGE(cases[i].px_size, px_size, "pixel size");
+  }
+}
+
+void test_fbdev_conv_channels(void)
+{
+  static const fb_format_t argb8888 = {32, 16, 8, 8, 8, 0, 8};
+  static const fb_format_t abgr8888 = {32, 0, 8, 8, 8, 16, 8};
+  static const fb_format_t rgbx8888 = {32, 24, 8, 16, 8, 8, 8};
+  static const fb_format_t rgb888 = {24, 16, 8, 8, 8, 0, 8};
+  static const fb_format_t bgr888 = {24, 0, 8, 8, 8, 16, 8};
+  static const fb_format_t rgb565 = {16, 11, 5, 5, 6, 0, 5};
+  static const fb_format_t bgr565 = {16, 0, 5, 5, 6, 11, 5};
+  static const fb_format_t rgb555 = {16, 10, 5, 5, 5, 0, 5};
+
+  /*Red, green, blue and a mixed color in the byte order of the frame buffer*/
+  static const struct {
+    const fb_format_t * format;
+    uint8_t bytes[4][4];
+  } cases[] = {
+    {&argb8888, {{0x00, 0x00, 0xFF, 0xFF}, {0x00, 0xFF, 0x00, 0xFF}, {0xFF, 0x00, 0x00, 0xFF}, {0x56, 0x34, 0x12, 0xFF}}},
+    {&abgr8888, {{0xFF, 0x00, 0x00, 0xFF}, {0x00, 0xFF, 0x00, 0xFF}, {0x00, 0x00, 0xFF, 0xFF}, {0x12, 0x34, 0x56, 0xFF}}},
+    {&rgbx8888, {{0x00, 0x00, 0x00, 0xFF}, {0x00, 0x00, 0xFF, 0x00}, {0x00, 0xFF, 0x00, 0x00}, {0x00, 0x56, 0x34, 0x12}}},
+    {&rgb888, {{0x00, 0x00, 0xFF}, {0x00, 0xFF, 0x00}, {0xFF, 0x00, 0x00}, {0x56, 0x34, 0x12}}},
+    {&bgr888, {{0xFF, 0x00, 0x00}, {0x00, 0xFF, 0x00}, {0x00, 0x00, 0xFF}, {0x12, 0x34, 0x56}}},
+    {&rgb565, {{0x00, 0xF8}, {0xE0, 0x07}, {0x1F, 0x00}, {0xAA, 0x11}}},
+    {&bgr565, {{0x1F, 0x00}, {0xE0, 0x07}, {0x00, 0xF8}, {0xA2, 0x51}}},
+    {&rgb555, {{0x00, 0x7C}, {0xE0, 0x03}, {0x1F, 0x00}, {0xCA, 0x08}}},
+  };
+
+  lv_color_t colors[4];
+  colors[0] = lv_color_make(0xFF, 0x00, 0x00);
+  colors[1] = lv_color_make(0x00, 0xFF, 0x00);
+  colors[2] = lv_color_make(0x00, 0x00, 0xFF);
+  colors[3] = lv_color_make(0x12, 0x34, 0x56);
+
+  uint32_t i;
+  uint32_t c;
+  for(i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    set_format(cases[i].format);
+    TEST_ASSERT_NOT_NULL(px_conv);
+    for(c = 0; c < 4; c++) {
+      /*On the first pixel of the dither matrix the threshold is 0, i.e. the channels are truncated*/
+      uint8_t dest[8];
+      lv_memset_ff(dest, sizeof(dest));
+      px_conv(dest, &colors[c], 1, 0, 0);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(cases[i].bytes[c], dest, px_size);
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE(0xFF, dest[px_size], "written past the pixel");
+    }
+  }
+}
+
+void test_fbdev_dither_bounds(void)
+{
+  static const fb_format_t rgb565 = {16, 11, 5, 5, 6, 0, 5};
+  set_format(&rgb565);
+
+  /*Every value of the channels on every position of the 4x4 matrix*/
+  uint32_t v;
+  for(v = 0; v <= 0xFF; v++) {
+    lv_color_t line[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) line[i] = lv_color_make(v, v, v);
+
+    uint32_t r_sum = 0;
+    uint32_t g_sum = 0;
+    uint32_t b_sum = 0;
+    int32_t y;
+    for(y = 0; y < 4; y++) {
+      uint16_t px[4];
+      conv_rgb565((uint8_t *)px, line, 4, 0, y);
+      for(i = 0; i < 4; i++) {
+        uint32_t r = px[i] >> 11;
+        uint32_t g = (px[i] >> 5) & 0x3F;
+        uint32_t b = px[i] & 0x1F;
+
+        /*At most one step above the truncated value and never wrapped around*/
+        TEST_ASSERT_TRUE(r == v >> 3 || r == (v >> 3) + 1);
+        TEST_ASSERT_TRUE(g == v >> 2 || g == (v >> 2) + 1);
+        TEST_ASSERT_EQUAL(r, b);
+        r_sum += r;
+        g_sum += g;
+        b_sum += b;
+      }
+    }
+
+    /*The average of the matrix is the exact value unless the channel saturates*/
+    if(v <= 0xFF - 7) TEST_ASSERT_EQUAL(2 * v, r_sum);
+    if(v <= 0xFF - 3) TEST_ASSERT_EQUAL(4 * v, g_sum);
+    TEST_ASSERT_EQUAL(r_sum, b_sum);
+  }
+
+  /*The highest values saturate*/
+  lv_color_t white = lv_color_make(0xFF, 0xFF, 0xFF);
+  int32_t x;
+  int32_t y;
+  for(y = 0; y < 4; y++) {
+    for(x = 0; x < 4; x++) {
+      uint16_t px;
+      conv_rgb565((uint8_t *)&px, &white, 1, x, y);
+      TEST_ASSERT_EQUAL_HEX16(0xFFFF, px);
+    }
+  }
+}
+
+/*A display of 100x120 pixels in its native orientation and an area which doesn't fill whole tiles*/
+#define SCR_W   100
+#define SCR_H   120
+#define AREA_W  45
+#define AREA_H  70
+
+static lv_color_t screen[SCR_H][SCR_W];
+static lv_color_t area_px[AREA_W * AREA_H];
+static uint32_t written_cnt;
+
+static void rotated_drv_init(lv_disp_drv_t * drv, lv_disp_draw_buf_t * draw_buf, lv_disp_rot_t rot)
+{
+  lv_memset_00(drv, sizeof(*drv));
+  drv->hor_res = SCR_W;
+  drv->ver_res = SCR_H;
+  drv->rotated = rot;
+  drv->sw_rotate = 0;
+  drv->draw_buf = draw_buf;
+}
+
+/*Where a pixel of LVGL is on the display, like the software rotation of LVGL*/
+static void rotate_point(lv_disp_rot_t rot, int32_t x, int32_t y, int32_t * dx, int32_t * dy)
+{
+  switch(rot) {
+    case LV_DISP_ROT_90:
+      *dx = y;
+      *dy = SCR_H - 1 - x;
+      break;
+    case LV_DISP_ROT_180:
+      *dx = SCR_W - 1 - x;
+      *dy = SCR_H - 1 - y;
+      break;
+    case LV_DISP_ROT_270:
+      *dx = SCR_W - 1 - y;
+      *dy = x;
+      break;
+    default:
+      *dx = x;
+      *dy = y;
+      break;
+  }
+}
+
+/*Every pixel of the area gets a different color*/
+static void area_px_init(const lv_area_t * area)
+{
+  int32_t x;
+  int32_t y;
+  for(y = 0; y < AREA_H; y++) {
+    for(x = 0; x < AREA_W; x++) {
+      area_px[y * AREA_W + x].full = 0xFF000000 | ((area->x1 + x) << 8) | (area->y1 + y);
+    }
+  }
+}
+
+static void write_line_cb(void * user_data, int32_t x, int32_t y, const lv_color_t * color_p, uint32_t px_cnt)
+{
+  LV_UNUSED(user_data);
+
+  TEST_ASSERT_TRUE(x >= 0 && x + (int32_t)px_cnt <= SCR_W);
+  TEST_ASSERT_TRUE(y >= 0 && y < SCR_H);
+  lv_memcpy(&screen[y][x], color_p, px_cnt * sizeof(lv_color_t));
+  written_cnt += px_cnt;
+}
+
+/*The area is on the rotated place of the display and nothing else is written*/
+static void check_screen(lv_disp_rot_t rot, const lv_area_t * area)
+{
+  static lv_color_t expected[SCR_H][SCR_W];
+  lv_memset_00(expected, sizeof(expected));
+
+  int32_t x;
+  int32_t y;
+  for(y = 0; y < AREA_H; y++) {
+    for(x = 0; x < AREA_W; x++) {
+      int32_t dx;
+      int32_t dy;
+      rotate_point(rot, area->x1 + x, area->y1 + y, &dx, &dy);
+      expected[dy][dx] = area_px[y * AREA_W + x];
+    }
+  }
+
+  for(y = 0; y < SCR_H; y++) {
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected[y], screen[y], SCR_W);
+  }
+}
+
+void test_fbdev_rotate(void)
+{
+  static const lv_disp_rot_t rots[] = {LV_DISP_ROT_90, LV_DISP_ROT_180, LV_DISP_ROT_270};
+  lv_disp_drv_t drv;
+  lv_disp_draw_buf_t draw_buf;
+
+  uint32_t i;
+  for(i = 0; i < sizeof(rots) / sizeof(rots[0]); i++) {
+    rotated_drv_init(&drv, &draw_buf, rots[i]);
+    TEST_ASSERT_TRUE(flush_rotate_is_needed(&drv));
+
+    /*In the rotated coordinates of LVGL the display is 120x100 at 90 and 270 degrees*/
+    lv_area_t area;
+    lv_area_set(&area, 7, 11, 7 + AREA_W - 1, 11 + AREA_H - 1);
+    area_px_init(&area);
+    lv_memset_00(screen, sizeof(screen));
+    written_cnt = 0;
+
+    flush_rotate(&drv, &area, area_px, write_line_cb, NULL);
+    TEST_ASSERT_EQUAL(AREA_W * AREA_H, written_cnt);
+    check_screen(rots[i], &area);
+  }
+}
+
+void test_fbdev_rotate_flush(void)
+{
+  static const fb_format_t argb8888 = {32, 16, 8, 8, 8, 0, 8};
+  static const lv_disp_rot_t rots[] = {LV_DISP_ROT_90, LV_DISP_ROT_180, LV_DISP_ROT_270};
+  lv_disp_drv_t drv;
+  lv_disp_draw_buf_t draw_buf;
+
+  /*Write to the frame buffer on the pixels of the screen*/
+  set_format(&argb8888);
+  vinfo.xres = SCR_W;
+  vinfo.yres = SCR_H;
+  finfo.line_length = SCR_W * sizeof(lv_color_t);
+  fbp = (char *)screen;
+
+  uint32_t i;
+  for(i = 0; i < sizeof(rots) / sizeof(rots[0]); i++) {
+    rotated_drv_init(&drv, &draw_buf, rots[i]);
+    lv_area_t area;
+    lv_area_set(&area, 50, 3, 50 + AREA_W - 1, 3 + AREA_H - 1);
+    area_px_init(&area);
+    lv_memset_00(screen, sizeof(screen));
+
+    fbdev_flush(&drv, &area, area_px);
+    check_screen(rots[i], &area);
+  }
+
+  fbp = NULL;
+}
+
+void test_fbdev_rotate_1bpp(void)
+{
+  static const fb_format_t mono = {1, 0, 1, 0, 1, 0, 1};
+  static const lv_disp_rot_t rots[] = {LV_DISP_ROT_90, LV_DISP_ROT_180, LV_DISP_ROT_270};
+  static uint8_t fb_mono[SCR_W * SCR_H / 8];
+  lv_disp_drv_t drv;
+  lv_disp_draw_buf_t draw_buf;
+
+  /*No conversion for 1 bpp, the pixels are still rotated instead of dropped*/
+  set_format(&mono);
+  TEST_ASSERT_NULL(px_conv);
+  vinfo.xres = SCR_W;
+  vinfo.yres = SCR_H;
+  fbp = (char *)fb_mono;
+
+  uint32_t i;
+  for(i = 0; i < sizeof(rots) / sizeof(rots[0]); i++) {
+    rotated_drv_init(&drv, &draw_buf, rots[i]);
+    lv_area_t area;
+    lv_area_set(&area, 7, 11, 7 + AREA_W - 1, 11 + AREA_H - 1);
+
+    /*A checkerboard pattern which is different on every rotation*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < AREA_H; y++) {
+      for(x = 0; x < AREA_W; x++) {
+        area_px[y * AREA_W + x].full = ((x / 3) + (y / 5)) & 0x1;
+      }
+    }
+    lv_memset_00(fb_mono, sizeof(fb_mono));
+
+    fbdev_flush(&drv, &area, area_px);
+
+    uint32_t set_cnt = 0;
+    for(y = 0; y < AREA_H; y++) {
+      for(x = 0; x < AREA_W; x++) {
+        int32_t dx;
+        int32_t dy;
+        rotate_point(rots[i], area.x1 + x, area.y1 + y, &dx, &dy);
+        int32_t location = dy * SCR_W + dx;
+        uint32_t bit = (fb_mono[location / 8] >> (location % 8)) & 0x1;
+        TEST_ASSERT_EQUAL(area_px[y * AREA_W + x].full, bit);
+        set_cnt += bit;
+      }
+    }
+
+    /*Nothing is set outside of the area*/
+    uint32_t total_cnt = 0;
+    for(x = 0; x < SCR_W * SCR_H; x++) total_cnt += (fb_mono[x / 8] >> (x % 8)) & 0x1;
+    TEST_ASSERT_EQUAL(set_cnt, total_cnt);
+  }
+
+  fbp = NULL;
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_fbdev_select_conv(void)
+{
+}
+
+void test_fbdev_conv_channels(void)
+{
+}
+
+void test_fbdev_dither_bounds(void)
+{
+}
+
+void test_fbdev_rotate(void)
+{
+}
+
+void test_fbdev_rotate_flush(void)
+{
+}
+
+void test_fbdev_rotate_1bpp(void)
+{
+}
+
+#endif
+
+#endif
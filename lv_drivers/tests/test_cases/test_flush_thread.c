@@ -0,0 +1,126 @@
+#if LV_BUILD_TEST
+#include "lvgl/lvgl.h"
+
+#include "unity/unity.h"
+
+void test_flush_thread_sync_before_init(void);
+void test_flush_thread_order(void);
+void test_flush_thread_present(void);
+
+#if LV_COLOR_DEPTH == 32
+
+/*Build the flush thread of the drivers with its own settings*/
+#define LV_DRV_NO_CONF
+#define USE_FLUSH_THREAD        1
+#include "../../display/flush_thread.c"
+
+#define AREA_CNT    10
+
+static lv_area_t flushed[AREA_CNT];
+static uint32_t flushed_cnt;
+static pthread_t flush_thread;
+static bool report_present;
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+  LV_UNUSED(color_p);
+
+  if(flushed_cnt < AREA_CNT) flushed[flushed_cnt] = *area;
+  flushed_cnt++;
+  flush_thread = pthread_self();
+
+  if(report_present) lv_disp_report_present(drv, lv_tick_get());
+  lv_disp_flush_ready(drv);
+}
+
+void setUp(void)
+{
+  flushed_cnt = 0;
+  report_present = false;
+}
+
+void tearDown(void)
+{
+}
+
+void test_flush_thread_sync_before_init(void)
+{
+  lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+  lv_area_t area = {0, 0, 9, 9};
+
+  /*Without the thread the areas are flushed immediately*/
+  flush_thread_submit(flush_cb, drv, &area, NULL);
+  TEST_ASSERT_EQUAL(1, flushed_cnt);
+  TEST_ASSERT_TRUE(pthread_equal(pthread_self(), flush_thread));
+}
+
+void test_flush_thread_order(void)
+{
+  lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+  flush_thread_init();
+
+  /*Without waiting for the flushing, each area is reused after submitting it*/
+  lv_area_t area;
+  uint32_t i;
+  for(i = 0; i < AREA_CNT; i++) {
+    lv_area_set(&area, 0, i, 9, i);
+    flush_thread_submit(flush_cb, drv, &area, NULL);
+    lv_area_set(&area, 0, 0, 0, 0);
+  }
+  flush_thread_wait(drv);
+
+  TEST_ASSERT_EQUAL(AREA_CNT, flushed_cnt);
+  for(i = 0; i < AREA_CNT; i++) TEST_ASSERT_EQUAL(i, flushed[i].y1);
+  TEST_ASSERT_FALSE(pthread_equal(pthread_self(), flush_thread));
+}
+
+void test_flush_thread_present(void)
+{
+  lv_disp_t * disp = lv_disp_get_default();
+  flush_thread_init();
+
+  /*The presentations are reported on the flush thread and processed on this thread*/
+  report_present = true;
+  lv_area_t area = {0, 0, 9, 9};
+  uint32_t i;
+  for(i = 0; i < 5; i++) {
+    lv_tick_inc(20);
+    flush_thread_submit(flush_cb, disp->driver, &area, NULL);
+    flush_thread_wait(disp->driver);
+    TEST_ASSERT_NOT_EQUAL(0, disp->driver->present_tick);
+
+    lv_disp_get_next_present_time(disp);
+    TEST_ASSERT_EQUAL(0, disp->driver->present_tick);
+    TEST_ASSERT_EQUAL(lv_tick_get(), disp->present_last);
+  }
+  TEST_ASSERT_EQUAL(20 * 16, disp->present_period);
+
+  disp->present_period = 0;
+  disp->present_reported = 0;
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_flush_thread_sync_before_init(void)
+{
+}
+
+void test_flush_thread_order(void)
+{
+}
+
+void test_flush_thread_present(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+#if LV_BUILD_TEST
+#include "lvgl/lvgl.h"
+
+#include "unity/unity.h"
+
+void test_spidev_window_and_pixels(void);
+void test_spidev_pixel_order(void);
+
+#if LV_COLOR_DEPTH == 32
+
+#include <stdarg.h>
+#include <sys/ioctl.h>
+
+/*Record the SPI messages instead of sending them*/
+static int test_ioctl(int fd, unsigned long req, ...);
+
+/*Build the backend with its own settings on a fake device without GPIOs*/
+#define LV_DRV_NO_CONF
+#define USE_SPIDEV          1
+#define SPIDEV_PATH         "/dev/null"
+#define SPIDEV_DC_LINE      -1
+#define SPIDEV_RST_LINE     -1
+#define SPIDEV_BATCH_SIZE   4096
+#define SPIDEV_IOCTL        test_ioctl
+#include "../../display/spidev.c"
+
+#define MSG_MAX     32
+#define LOG_SIZE    (16 * 1024)
+
+static uint32_t msg_len[MSG_MAX];
+static uint32_t msg_cnt;
+static uint8_t log_bytes[LOG_SIZE];
+static uint32_t log_len;
+
+static int test_ioctl(int fd, unsigned long req, ...)
+{
+  LV_UNUSED(fd);
+
+  va_list args;
+  va_start(args, req);
+  void * arg = va_arg(args, void *);
+  va_end(args);
+
+  if(req != SPI_IOC_MESSAGE(1)) return 0;
+
+  const struct spi_ioc_transfer * tr = arg;
+  if(msg_cnt < MSG_MAX) msg_len[msg_cnt] = tr->len;
+  msg_cnt++;
+  if(log_len + tr->len <= LOG_SIZE) {
+    lv_memcpy(log_bytes + log_len, (const void *)(uintptr_t)tr->tx_buf, tr->len);
+    log_len += tr->len;
+  }
+
+  return (int)tr->len;
+}
+
+void setUp(void)
+{
+  spidev_init();
+  msg_cnt = 0;
+  log_len = 0;
+}
+
+void tearDown(void)
+{
+  spidev_exit();
+}
+
+/*Set a window of ILI9341 like panels*/
+static void write_window(uint8_t cmd, uint16_t start, uint16_t end)
+{
+  spidev_cmd_data(0);
+  spidev_write_byte(cmd);
+  spidev_cmd_data(1);
+  spidev_write_byte(start >> 8);
+  spidev_write_byte(start & 0xFF);
+  spidev_write_byte(end >> 8);
+  spidev_write_byte(end & 0xFF);
+}
+
+void test_spidev_window_and_pixels(void)
+{
+  static lv_color_t px[3000];
+  uint32_t i;
+  for(i = 0; i < 3000; i++) px[i] = lv_color_make(0xFF, 0xFF, 0xFF);
+
+  spidev_cs(0);
+  write_window(0x2A, 0, 99);
+  write_window(0x2B, 0, 29);
+  spidev_cmd_data(0);
+  spidev_write_byte(0x2C);
+  spidev_cmd_data(1);
+  spidev_write_pixels(px, 3000);
+  spidev_cs(1);
+
+  /*A message for each D/C level, the pixels fill whole messages*/
+  uint32_t px_msg_cnt = (3000 * 2 + batch_size - 1) / batch_size;
+  TEST_ASSERT_EQUAL(5 + px_msg_cnt, msg_cnt);
+  TEST_ASSERT_EQUAL(1, msg_len[0]);
+  TEST_ASSERT_EQUAL(4, msg_len[1]);
+  TEST_ASSERT_EQUAL(1, msg_len[2]);
+  TEST_ASSERT_EQUAL(4, msg_len[3]);
+  TEST_ASSERT_EQUAL(1, msg_len[4]);
+  for(i = 5; i < msg_cnt - 1; i++) TEST_ASSERT_EQUAL(batch_size, msg_len[i]);
+
+  static const uint8_t window[] = {0x2A, 0, 0, 0, 99, 0x2B, 0, 0, 0, 29, 0x2C};
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(window, log_bytes, sizeof(window));
+  TEST_ASSERT_EQUAL(sizeof(window) + 3000 * 2, log_len);
+}
+
+void test_spidev_pixel_order(void)
+{
+  lv_color_t px[4];
+  px[0] = lv_color_make(0xFF, 0x00, 0x00);
+  px[1] = lv_color_make(0x00, 0xFF, 0x00);
+  px[2] = lv_color_make(0x00, 0x00, 0xFF);
+  px[3] = lv_color_make(0x12, 0x34, 0x56);
+
+  spidev_cmd_data(1);
+  spidev_write_pixels(px, 4);
+  spidev_sync();
+
+  /*RGB565 in big endian*/
+  static const uint8_t expected[] = {0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x11, 0xAA};
+  TEST_ASSERT_EQUAL(1, msg_cnt);
+  TEST_ASSERT_EQUAL(sizeof(expected), log_len);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, log_bytes, sizeof(expected));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_spidev_window_and_pixels(void)
+{
+}
+
+void test_spidev_pixel_order(void)
+{
+}
+
+#endif
+
+#endif
@@ -48,6 +48,32 @@
 #define LV_DRV_DISP_PAR_WR_WORD(data)    /*par_wr(data)*/      /*Write a word to the parallel port*/
 #define LV_DRV_DISP_PAR_WR_ARRAY(adr, n) /*par_wr_mem(adr,n)*/ /*Write 'n' bytes to Parallel ports from 'adr'*/
 
+/*-----------------
+ *  Flush thread
+ *-----------------*/
+/*1: fbdev, DRM, ILI9341 and SSD1963 flush in a separate thread (needs pthreads).
+ *   With two draw buffers LVGL renders the next area while the previous one is being flushed.*/
+#define USE_FLUSH_THREAD            1
+
+/*-------------------------------------
+ *  Linux SPI device (/dev/spidevX.Y)
+ *-------------------------------------*/
+/*1: Drive the SPI panels (ILI9341, GC9A01, ST7565) through spidev instead of the macros above.
+ *   The bytes are collected and sent in as few transfers as possible. Call `spidev_init()` before the init of the panel.*/
+#ifndef USE_SPIDEV
+#  define USE_SPIDEV                0
+#endif
+
+#if USE_SPIDEV
+#  define SPIDEV_PATH               "/dev/spidev0.0"
+#  define SPIDEV_SPEED_HZ           32000000
+#  define SPIDEV_MODE               0
+#  define SPIDEV_GPIO_CHIP          "/dev/gpiochip0"
+#  define SPIDEV_DC_LINE            25              /*GPIO line of the data/command pin, -1 if not used*/
+#  define SPIDEV_RST_LINE           24              /*GPIO line of the reset pin, -1 if not used*/
+#  define SPIDEV_BATCH_SIZE         (64 * 1024)     /*Max. bytes per transfer. Also limited by the `bufsiz` parameter of spidev.*/
+#endif
+
 /***************************
  * INPUT DEVICE INTERFACE
  ***************************/
@@ -277,6 +303,11 @@
 
 #if USE_FBDEV
 #  define FBDEV_PATH          "/dev/fb0"
+/*1: Wait for the vertical sync after flushing and report the presentation time to LVGL.
+ *   The animations will be synchronized to the frames but flushing takes up to one more frame.*/
+#  define FBDEV_VSYNC         0
+/*1: Use ordered dithering if the colors are converted to a frame buffer with less bits (e.g. 32 bit to RGB565)*/
+#  define FBDEV_DITHER        1
 #endif
 
 /*-----------------------------------------
@@ -380,6 +411,8 @@
 
 #if USE_LIBINPUT
 #  define LIBINPUT_NAME   "/dev/input/event0"        /*You can use the "evtest" Linux tool to get the list of devices and test them*/
+#  define LIBINPUT_QUEUE_SIZE    32               /*Number of touch samples buffered between two reads*/
+#  define LIBINPUT_THREAD         0               /*Process the events on a separate thread (needs pthread and eventfd). See `libinput_get_wake_fd()`*/
 #endif  /*USE_LIBINPUT*/
 
 /*-------------------------------------------------
@@ -395,7 +428,20 @@
 
 #if USE_EVDEV || USE_BSD_EVDEV
 #  define EVDEV_NAME   "/dev/input/event0"        /*You can use the "evtest" Linux tool to get the list of devices and test them*/
+#  define EVDEV_HOTPLUG           1               /*Use every device of EVDEV_DIR and follow the plugged and removed devices. See `evdev_hotplug_init()`*/
+#  if EVDEV_HOTPLUG
+#    define EVDEV_DIR    "/dev/input"
+#    define EVDEV_DEV_MAX         8               /*Max. number of the used devices*/
+#  endif
 #  define EVDEV_SWAP_AXES         0               /*Swap the x and y axes of the touchscreen*/
+#  define EVDEV_QUEUE_SIZE       32               /*Number of samples (SYN_REPORT frames or key events) buffered between two reads*/
+#  define EVDEV_FILTER            1               /*Smooth the pointers and extrapolate them to the display time. See `filter_min_cutoff` and `predict_time` of `lv_indev_drv_t`*/
+#  if EVDEV_FILTER
+#    define EVDEV_FILTER_MIN_CUTOFF 10           /*Used by `evdev_indev_drv_init()` for every evdev input device*/
+#    define EVDEV_FILTER_BETA     70
+#    define EVDEV_PREDICT_TIME    30
+#  endif
+#  define EVDEV_THREAD            1               /*Read the device on a separate thread (needs pthread and eventfd). See `evdev_get_wake_fd()`*/
 
 #  define EVDEV_CALIBRATE         0               /*Scale and offset the touchscreen coordinates by using maximum and minimum values for each axis*/
 
@@ -122,6 +122,8 @@ void lv_example_textarea_3(void);
 
 void lv_example_tileview_1(void);
 
+void lv_example_vlist_1(void);
+
 void lv_example_win_1(void);
 
 void lv_example_span_1(void);
@@ -0,0 +1,38 @@
+#include "../../lv_examples.h"
+#if LV_USE_VLIST && LV_BUILD_EXAMPLES
+
+static lv_obj_t * row_create_cb(lv_obj_t * vlist)
+{
+    lv_obj_t * row = lv_obj_create(vlist);
+    lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_label_create(row);
+    return row;
+}
+
+static void row_bind_cb(lv_obj_t * vlist, lv_obj_t * row, uint32_t id)
+{
+    LV_UNUSED(vlist);
+    lv_obj_t * label = lv_obj_get_child(row, 0);
+
+    /*Every 7th alarm has a longer, two line description*/
+    if(id % 7 == 0) lv_label_set_text_fmt(label, "Alarm %d\nSensor disconnected", (int)id);
+    else lv_label_set_text_fmt(label, "Alarm %d", (int)id);
+}
+
+/**
+ * Show a long list by creating objects only for the visible rows
+ */
+void lv_example_vlist_1(void)
+{
+    lv_obj_t * vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 180, 220);
+    lv_obj_center(vlist);
+
+    lv_vlist_set_create_cb(vlist, row_create_cb);
+    lv_vlist_set_bind_cb(vlist, row_bind_cb);
+    lv_vlist_set_row_height(vlist, 50);
+    lv_vlist_set_row_cnt(vlist, 5000);
+}
+
+#endif
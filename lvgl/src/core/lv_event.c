@@ -14,6 +14,9 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*The event codes from 63 (e.g. the registered ones) share the last bit of the event mask*/
+#define EVENT_MASK_BIT(code)    ((uint64_t)1 << ((code) < 63 ? (code) : 63))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -26,9 +29,10 @@ typedef struct _lv_event_dsc_t{
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_code_t e);
+static uint64_t event_filter_mask(lv_event_code_t filter);
+static void event_mask_update(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -159,6 +163,7 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    obj->spec_attr->event_mask |= event_filter_mask(filter);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -178,6 +183,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc_cnt--;
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc, obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -201,6 +207,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc_cnt--;
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc, obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            event_mask_update(obj);
             return true;
         }
     }
@@ -209,6 +216,27 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
     return false;
 }
 
+void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(obj->spec_attr == NULL) return NULL;
+
+    int32_t i = 0;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        if(obj->spec_attr->event_dsc[i].cb == event_cb) return obj->spec_attr->event_dsc[i].user_data;
+    }
+
+    return NULL;
+}
+
+bool lv_obj_has_event_cb(const lv_obj_t * obj, lv_event_code_t code)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(obj->spec_attr == NULL) return false;
+
+    return (obj->spec_attr->event_mask & EVENT_MASK_BIT(code)) ? true : false;
+}
+
 lv_indev_t * lv_event_get_indev(lv_event_t * e)
 {
 
@@ -224,6 +252,8 @@ lv_indev_t * lv_event_get_indev(lv_event_t * e)
         e->code == LV_EVENT_SCROLL_END ||
         e->code == LV_EVENT_SCROLL ||
         e->code == LV_EVENT_GESTURE ||
+        e->code == LV_EVENT_PINCH ||
+        e->code == LV_EVENT_ROTATE ||
         e->code == LV_EVENT_KEY ||
         e->code == LV_EVENT_FOCUSED ||
         e->code == LV_EVENT_DEFOCUSED ||
@@ -351,16 +381,6 @@ void lv_event_set_cover_res(lv_event_t * e, lv_cover_res_t res)
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id)
-{
-    LV_ASSERT_OBJ(obj, MY_CLASS);
-
-    if(!obj->spec_attr) return NULL;
-    if(id >= obj->spec_attr->event_dsc_cnt) return NULL;
-
-    return &obj->spec_attr->event_dsc[id];
-}
-
 static lv_res_t event_send_core(lv_event_t * e)
 {
     EVENT_TRACE("Sending event %d to %p with %p param", e->code, e->current_target, e->param);
@@ -371,22 +391,24 @@ static lv_res_t event_send_core(lv_event_t * e)
         if(indev_act->driver->feedback_cb) indev_act->driver->feedback_cb(indev_act->driver, e->code);
     }
 
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
     lv_res_t res = LV_RES_OK;
     res = lv_obj_event_base(NULL, e);
 
-    uint32_t i = 0;
-    while(event_dsc && res == LV_RES_OK) {
-        if(event_dsc->cb && (event_dsc->filter == LV_EVENT_ALL || event_dsc->filter == e->code)) {
-            e->user_data = event_dsc->user_data;
-            event_dsc->cb(e);
-
-            /*Stop if the object is deleted*/
-            if(e->deleted) return LV_RES_INV;
+    /*Go through the event callbacks only if any of them is interested in this event.
+     *The array is read again in every iteration as a callback might add or remove callbacks.*/
+    _lv_obj_spec_attr_t * spec_attr = e->current_target->spec_attr;
+    if(res == LV_RES_OK && spec_attr && (spec_attr->event_mask & EVENT_MASK_BIT(e->code))) {
+        uint32_t i;
+        for(i = 0; i < spec_attr->event_dsc_cnt; i++) {
+            lv_event_dsc_t * event_dsc = &spec_attr->event_dsc[i];
+            if(event_dsc->cb && (event_dsc->filter == LV_EVENT_ALL || event_dsc->filter == e->code)) {
+                e->user_data = event_dsc->user_data;
+                event_dsc->cb(e);
+
+                /*Stop if the object is deleted*/
+                if(e->deleted) return LV_RES_INV;
+            }
         }
-
-        i++;
-        event_dsc = lv_obj_get_event_dsc(e->current_target, i);
     }
 
     if(res == LV_RES_OK && event_is_bubbled(e->code)) {
@@ -425,3 +447,24 @@ static bool event_is_bubbled(lv_event_code_t e)
         return true;
     }
 }
+
+static uint64_t event_filter_mask(lv_event_code_t filter)
+{
+    if(filter == LV_EVENT_ALL) return UINT64_MAX;
+    else return EVENT_MASK_BIT(filter);
+}
+
+/**
+ * Collect the event codes of the remaining callbacks after a callback was removed
+ * @param obj       pointer to an object
+ */
+static void event_mask_update(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        mask |= event_filter_mask(obj->spec_attr->event_dsc[i].filter);
+    }
+
+    obj->spec_attr->event_mask = mask;
+}
@@ -45,6 +45,8 @@ typedef enum {
     LV_EVENT_SCROLL_END,          /**< Scrolling ends*/
     LV_EVENT_SCROLL,              /**< Scrolling*/
     LV_EVENT_GESTURE,             /**< A gesture is detected. Get the gesture with `lv_indev_get_gesture_dir(lv_indev_get_act());` */
+    LV_EVENT_PINCH,               /**< Two fingers are moved closer or farther. Get the scale with `lv_indev_get_pinch_scale(lv_indev_get_act());` */
+    LV_EVENT_ROTATE,              /**< Two fingers are rotated. Get the angle with `lv_indev_get_rotation(lv_indev_get_act());` */
     LV_EVENT_KEY,                 /**< A key is sent to the object. Get the key with `lv_indev_get_key(lv_indev_get_act());`*/
     LV_EVENT_FOCUSED,             /**< The object is focused*/
     LV_EVENT_DEFOCUSED,           /**< The object is defocused*/
@@ -227,6 +229,22 @@ bool lv_obj_remove_event_cb(struct _lv_obj_t * obj, lv_event_cb_t event_cb);
  */
 bool lv_obj_remove_event_dsc(struct _lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc);
 
+/**
+ * Get the user_data passed when the event was registered on the object
+ * @param obj       pointer to an object
+ * @param event_cb  the event function
+ * @return          the user_data of the first handler with `event_cb` or NULL if not found
+ */
+void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb);
+
+/**
+ * Tell if an event callback of the object listens to an event
+ * @param obj       pointer to an object
+ * @param code      the event code
+ * @return          true: there is a callback whose filter includes `code`
+ */
+bool lv_obj_has_event_cb(const struct _lv_obj_t * obj, lv_event_code_t code);
+
 /**
  * Get the input device passed as parameter to indev related events.
  * @param e     pointer to an event
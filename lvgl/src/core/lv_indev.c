@@ -24,6 +24,9 @@
     #warning "LV_INDEV_DRAG_THROW must be greater than 0"
 #endif
 
+/*Cut-off frequency of the speed in the pointer filter [0.1 Hz]*/
+#define INDEV_FILTER_SPEED_CUTOFF   50
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +35,14 @@
  *  STATIC PROTOTYPES
  **********************/
 static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data);
+static void indev_pointer_filter(lv_indev_t * i, lv_indev_data_t * data);
+static int32_t indev_filter_alpha(uint32_t cutoff, uint32_t dt);
+static void indev_multi_touch_to_pointer(lv_indev_t * i, lv_indev_data_t * data);
+static void indev_multi_gesture(lv_indev_t * i, lv_indev_data_t * data);
+static const lv_indev_touch_t * indev_find_touch(const lv_indev_data_t * data, int32_t id);
+static uint32_t indev_touch_dist(const lv_point_t p[2]);
+static uint16_t indev_touch_angle(const lv_point_t p[2]);
+static void indev_rotate_point(const lv_disp_t * disp, lv_point_t * point);
 static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data);
 static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data);
 static void indev_button_proc(lv_indev_t * i, lv_indev_data_t * data);
@@ -41,6 +52,7 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(_lv_indev_proc_t * proc);
 static void indev_gesture(_lv_indev_proc_t * proc);
 static bool indev_reset_check(_lv_indev_proc_t * proc);
+static uint32_t indev_elaps(const _lv_indev_proc_t * proc, uint32_t prev_tick);
 
 /**********************
  *  STATIC VARIABLES
@@ -86,8 +98,24 @@ void lv_indev_read_timer_cb(lv_timer_t * timer)
         indev_proc_reset_query_handler(indev_act);
         indev_obj_act = NULL;
 
+        /*The first touch works as a pointer*/
+        if(indev_act->driver->type == LV_INDEV_TYPE_MULTI_POINTER) {
+            indev_multi_touch_to_pointer(indev_act, &data);
+        }
+
         indev_act->proc.state = data.state;
 
+        /*The timing (e.g. long press, scroll throw) uses the time of the sample*/
+        if(data.timestamp) {
+            int32_t elaps = (int32_t)(data.timestamp - indev_act->proc.timestamp);
+            indev_act->proc.timestamp_elaps = elaps > 0 ? (uint32_t)elaps : 0;
+            indev_act->proc.timestamp = data.timestamp;
+        }
+        else {
+            indev_act->proc.timestamp_elaps = timer->period;
+            indev_act->proc.timestamp = lv_tick_get();
+        }
+
         /*Save the last activity time*/
         if(indev_act->proc.state == LV_INDEV_STATE_PRESSED) {
             indev_act->driver->disp->last_activity_time = lv_tick_get();
@@ -99,6 +127,10 @@ void lv_indev_read_timer_cb(lv_timer_t * timer)
         if(indev_act->driver->type == LV_INDEV_TYPE_POINTER) {
             indev_pointer_proc(indev_act, &data);
         }
+        else if(indev_act->driver->type == LV_INDEV_TYPE_MULTI_POINTER) {
+            indev_pointer_proc(indev_act, &data);
+            if(!indev_act->proc.reset_query) indev_multi_gesture(indev_act, &data);
+        }
         else if(indev_act->driver->type == LV_INDEV_TYPE_KEYPAD) {
             indev_keypad_proc(indev_act, &data);
         }
@@ -157,7 +189,8 @@ void lv_indev_reset(lv_indev_t * indev, lv_obj_t * obj)
         lv_indev_t * i = lv_indev_get_next(NULL);
         while(i) {
             i->proc.reset_query = 1;
-            if((i->driver->type == LV_INDEV_TYPE_POINTER || i->driver->type == LV_INDEV_TYPE_KEYPAD) &&
+            if((i->driver->type == LV_INDEV_TYPE_POINTER || i->driver->type == LV_INDEV_TYPE_MULTI_POINTER ||
+                i->driver->type == LV_INDEV_TYPE_KEYPAD) &&
                (obj == NULL || i->proc.types.pointer.last_pressed == obj)) {
                 i->proc.types.pointer.last_pressed = NULL;
             }
@@ -182,7 +215,7 @@ void lv_indev_reset_long_press(lv_indev_t * indev)
 
 void lv_indev_set_cursor(lv_indev_t * indev, lv_obj_t * cur_obj)
 {
-    if(indev->driver->type != LV_INDEV_TYPE_POINTER) return;
+    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER) return;
 
     indev->cursor = cur_obj;
     lv_obj_set_parent(indev->cursor, lv_disp_get_layer_sys(indev->driver->disp));
@@ -212,7 +245,8 @@ void lv_indev_get_point(const lv_indev_t * indev, lv_point_t * point)
         point->y = 0;
         return;
     }
-    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_BUTTON) {
+    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER &&
+       indev->driver->type != LV_INDEV_TYPE_BUTTON) {
         point->x = -1;
         point->y = -1;
     }
@@ -227,6 +261,33 @@ lv_dir_t lv_indev_get_gesture_dir(const lv_indev_t * indev)
     return indev->proc.types.pointer.gesture_dir;
 }
 
+uint16_t lv_indev_get_pinch_scale(const lv_indev_t * indev)
+{
+    if(indev == NULL || indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER) return LV_IMG_ZOOM_NONE;
+    if((indev->proc.types.pointer.touch_valid & 0x2) == 0) return LV_IMG_ZOOM_NONE;
+    return indev->proc.types.pointer.pinch_scale;
+}
+
+int16_t lv_indev_get_rotation(const lv_indev_t * indev)
+{
+    if(indev == NULL || indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER) return 0;
+    if((indev->proc.types.pointer.touch_valid & 0x2) == 0) return 0;
+    return indev->proc.types.pointer.rotation;
+}
+
+void lv_indev_get_pinch_center(const lv_indev_t * indev, lv_point_t * point)
+{
+    if(indev == NULL || indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER ||
+       (indev->proc.types.pointer.touch_valid & 0x2) == 0) {
+        lv_indev_get_point(indev, point);
+        return;
+    }
+
+    const lv_point_t * p = indev->proc.types.pointer.touch_point;
+    point->x = (p[0].x + p[1].x) / 2;
+    point->y = (p[0].y + p[1].y) / 2;
+}
+
 uint32_t lv_indev_get_key(const lv_indev_t * indev)
 {
     if(indev->driver->type != LV_INDEV_TYPE_KEYPAD)
@@ -238,14 +299,16 @@ uint32_t lv_indev_get_key(const lv_indev_t * indev)
 lv_dir_t lv_indev_get_scroll_dir(const lv_indev_t * indev)
 {
     if(indev == NULL) return false;
-    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_BUTTON) return false;
+    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER &&
+       indev->driver->type != LV_INDEV_TYPE_BUTTON) return false;
     return indev->proc.types.pointer.scroll_dir;
 }
 
 lv_obj_t * lv_indev_get_scroll_obj(const lv_indev_t * indev)
 {
     if(indev == NULL) return NULL;
-    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_BUTTON) return NULL;
+    if(indev->driver->type != LV_INDEV_TYPE_POINTER && indev->driver->type != LV_INDEV_TYPE_MULTI_POINTER &&
+       indev->driver->type != LV_INDEV_TYPE_BUTTON) return NULL;
     return indev->proc.types.pointer.scroll_obj;
 }
 
@@ -256,7 +319,8 @@ void lv_indev_get_vect(const lv_indev_t * indev, lv_point_t * point)
 
     if(indev == NULL) return;
 
-    if(indev->driver->type == LV_INDEV_TYPE_POINTER || indev->driver->type == LV_INDEV_TYPE_BUTTON) {
+    if(indev->driver->type == LV_INDEV_TYPE_POINTER || indev->driver->type == LV_INDEV_TYPE_MULTI_POINTER ||
+       indev->driver->type == LV_INDEV_TYPE_BUTTON) {
         point->x = indev->proc.types.pointer.vect.x;
         point->y = indev->proc.types.pointer.vect.y;
     }
@@ -289,10 +353,16 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 
     /*If the point is on this object check its children too*/
     if(lv_obj_hit_test(obj, point)) {
-        int32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-        for(i = child_cnt - 1; i >= 0; i--) {
-            lv_obj_t * child = obj->spec_attr->children[i];
+        lv_area_t point_area;
+        point_area.x1 = point->x;
+        point_area.y1 = point->y;
+        point_area.x2 = point->x;
+        point_area.y2 = point->y;
+
+        _lv_obj_child_iter_t iter;
+        _lv_obj_child_iter_init(&iter, obj, &point_area, true);
+        lv_obj_t * child;
+        while((child = _lv_obj_child_iter_next(&iter)) != NULL) {
             found_p = lv_indev_search_obj(child, point);
 
             /*If a child was found then break*/
@@ -327,20 +397,18 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
 {
     lv_disp_t *disp = i->driver->disp;
-    /*Save the raw points so they can be used again in _lv_indev_read*/
-    i->proc.types.pointer.last_raw_point.x = data->point.x;
-    i->proc.types.pointer.last_raw_point.y = data->point.y;
+    lv_point_t raw_point = data->point;
 
-    if(disp->driver->rotated == LV_DISP_ROT_180 || disp->driver->rotated == LV_DISP_ROT_270) {
-        data->point.x = disp->driver->hor_res - data->point.x - 1;
-        data->point.y = disp->driver->ver_res - data->point.y - 1;
-    }
-    if(disp->driver->rotated == LV_DISP_ROT_90 || disp->driver->rotated == LV_DISP_ROT_270) {
-        lv_coord_t tmp = data->point.y;
-        data->point.y = data->point.x;
-        data->point.x = disp->driver->ver_res - tmp - 1;
+    if(i->driver->filter_min_cutoff || i->driver->predict_time) {
+        indev_pointer_filter(i, data);
     }
 
+    /*Save the raw points so they can be used again in _lv_indev_read*/
+    i->proc.types.pointer.last_raw_point.x = raw_point.x;
+    i->proc.types.pointer.last_raw_point.y = raw_point.y;
+
+    indev_rotate_point(disp, &data->point);
+
     /*Simple sanity check*/
     if(data->point.x < 0) LV_LOG_WARN("X is %d which is smaller than zero", data->point.x);
     if(data->point.x >= lv_disp_get_hor_res(i->driver->disp)) LV_LOG_WARN("X is %d which is greater than hor. res", data->point.x);
@@ -367,6 +435,272 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
     i->proc.types.pointer.last_point.y = i->proc.types.pointer.act_point.y;
 }
 
+/**
+ * Smooth the jitter of the pointer with a 1-euro filter and extrapolate it to the time when the
+ * result is expected to be displayed. The filter follows slow moves with low cut-off frequency to
+ * remove the jitter and fast moves with high cut-off frequency to not lag behind the finger.
+ * @param i pointer to an input device
+ * @param data pointer to the data read from the input device. The point is updated.
+ *             `last_raw_point` should be still the point of the previous sample.
+ */
+static void indev_pointer_filter(lv_indev_t * i, lv_indev_data_t * data)
+{
+    _lv_indev_proc_t * proc = &i->proc;
+    int32_t * pos = proc->types.pointer.filter_pos;
+    int32_t * vel = proc->types.pointer.filter_vel;
+    int32_t raw[2] = {(int32_t)data->point.x << 8, (int32_t)data->point.y << 8};
+    int32_t raw_prev[2] = {(int32_t)proc->types.pointer.last_raw_point.x << 8, (int32_t)proc->types.pointer.last_raw_point.y << 8};
+
+    /*Start again on every press with the first sample*/
+    if(proc->state != LV_INDEV_STATE_PRESSED || !proc->types.pointer.filter_valid) {
+        pos[0] = raw[0];
+        pos[1] = raw[1];
+        vel[0] = 0;
+        vel[1] = 0;
+        proc->types.pointer.filter_valid = proc->state == LV_INDEV_STATE_PRESSED;
+        return;
+    }
+
+    uint32_t dt = LV_MAX(proc->timestamp_elaps, 1);
+    uint32_t k;
+    for(k = 0; k < 2; k++) {
+        /*Speed from the previous sample*/
+        int32_t vel_raw = (int32_t)(((int64_t)raw[k] - raw_prev[k]) * 1000 / (int32_t)dt);
+        int32_t a = indev_filter_alpha(INDEV_FILTER_SPEED_CUTOFF, dt);
+        vel[k] += (int32_t)(((int64_t)vel_raw - vel[k]) * a >> 16);
+
+        if(i->driver->filter_min_cutoff) {
+            /*Faster moves are filtered less*/
+            uint32_t speed = LV_ABS(vel[k]) >> 8;
+            uint32_t cutoff = i->driver->filter_min_cutoff + (uint32_t)((uint64_t)i->driver->filter_beta * speed / 1000);
+            a = indev_filter_alpha(cutoff, dt);
+            pos[k] += (int32_t)(((int64_t)raw[k] - pos[k]) * a >> 16);
+        }
+        else {
+            pos[k] = raw[k];
+        }
+    }
+
+    /*Continue the move until the expected display time, measured from the time of the sample*/
+    int32_t ahead = 0;
+    if(i->driver->predict_time) {
+        uint32_t target = LV_MAX(lv_disp_get_next_present_time(i->driver->disp), lv_tick_get());
+        ahead = (int32_t)(target - proc->timestamp);
+        ahead = LV_CLAMP(0, ahead, i->driver->predict_time);
+    }
+
+    data->point.x = (lv_coord_t)((pos[0] + (int32_t)((int64_t)vel[0] * ahead / 1000) + 128) >> 8);
+    data->point.y = (lv_coord_t)((pos[1] + (int32_t)((int64_t)vel[1] * ahead / 1000) + 128) >> 8);
+
+    /*Don't leave the display by the extrapolation*/
+    data->point.x = LV_CLAMP(0, data->point.x, i->driver->disp->driver->hor_res - 1);
+    data->point.y = LV_CLAMP(0, data->point.y, i->driver->disp->driver->ver_res - 1);
+}
+
+/**
+ * Get the smoothing factor of an exponential low-pass filter
+ * @param cutoff the cut-off frequency [0.1 Hz]
+ * @param dt time since the previous sample [ms]
+ * @return the weight of the new sample [1/65536]
+ */
+static int32_t indev_filter_alpha(uint32_t cutoff, uint32_t dt)
+{
+    /*alpha = 1 / (1 + tau / dt) where tau = 1 / (2 * pi * cutoff)*/
+    uint64_t w = (uint64_t)cutoff * dt * 6283;   /*2 * pi * 1000, in units of 1 / (10 * 1000 * 1000)*/
+    return (int32_t)((w << 16) / (w + 10000000));
+}
+
+/**
+ * Report the first touch of LV_INDEV_TYPE_MULTI_POINTER input devices as a pointer.
+ * If the first finger is released the pointer stays released until all fingers are released.
+ * @param i pointer to an input device
+ * @param data pointer to the data read from the input device
+ */
+static void indev_multi_touch_to_pointer(lv_indev_t * i, lv_indev_data_t * data)
+{
+    if(data->touch_cnt > LV_INDEV_TOUCH_MAX) data->touch_cnt = LV_INDEV_TOUCH_MAX;
+
+    const lv_indev_touch_t * first = NULL;
+    if(i->proc.types.pointer.touch_valid & 0x1) {
+        first = indev_find_touch(data, i->proc.types.pointer.touch_id[0]);
+        if(first == NULL && data->touch_cnt == 0) i->proc.types.pointer.touch_valid = 0;
+    }
+    else if(data->touch_cnt > 0) {
+        first = &data->touches[0];
+        i->proc.types.pointer.touch_id[0] = first->id;
+        i->proc.types.pointer.touch_valid = 0x1;
+    }
+
+    if(first) {
+        data->point = first->point;
+        data->state = LV_INDEV_STATE_PRESSED;
+    }
+    else {
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+}
+
+/**
+ * Recognize pinch and rotation from the first two touches of LV_INDEV_TYPE_MULTI_POINTER input devices
+ * @param i pointer to an input device
+ * @param data pointer to the data read from the input device
+ */
+static void indev_multi_gesture(lv_indev_t * i, lv_indev_data_t * data)
+{
+    _lv_indev_proc_t * proc = &i->proc;
+    const lv_indev_touch_t * first = NULL;
+    const lv_indev_touch_t * second = NULL;
+    if(proc->types.pointer.touch_valid & 0x1) first = indev_find_touch(data, proc->types.pointer.touch_id[0]);
+    if(proc->types.pointer.touch_valid & 0x2) second = indev_find_touch(data, proc->types.pointer.touch_id[1]);
+
+    /*The gesture ends if any of its fingers is released*/
+    if(first == NULL || second == NULL) {
+        proc->types.pointer.touch_valid &= 0x1;
+        proc->types.pointer.pinch_sent = 0;
+        proc->types.pointer.rotate_sent = 0;
+        if(first == NULL) return;
+    }
+
+    lv_point_t p[2];
+    p[0] = first->point;
+    indev_rotate_point(i->driver->disp, &p[0]);
+
+    /*Begin a new gesture with an other finger*/
+    if(second == NULL) {
+        uint8_t t;
+        for(t = 0; t < data->touch_cnt; t++) {
+            if(data->touches[t].id != first->id) {
+                second = &data->touches[t];
+                break;
+            }
+        }
+        if(second == NULL) return;
+
+        p[1] = second->point;
+        indev_rotate_point(i->driver->disp, &p[1]);
+
+        proc->types.pointer.touch_id[1] = second->id;
+        proc->types.pointer.touch_valid |= 0x2;
+        proc->types.pointer.touch_point[0] = p[0];
+        proc->types.pointer.touch_point[1] = p[1];
+        proc->types.pointer.pinch_dist_start = LV_MAX(indev_touch_dist(p), 1);
+        proc->types.pointer.pinch_angle_start = indev_touch_angle(p);
+        proc->types.pointer.pinch_scale = LV_IMG_ZOOM_NONE;
+        proc->types.pointer.rotation = 0;
+        return;
+    }
+
+    p[1] = second->point;
+    indev_rotate_point(i->driver->disp, &p[1]);
+    proc->types.pointer.touch_point[0] = p[0];
+    proc->types.pointer.touch_point[1] = p[1];
+
+    uint32_t dist = indev_touch_dist(p);
+    uint32_t scale = (dist << 8) / proc->types.pointer.pinch_dist_start;
+    if(scale > UINT16_MAX) scale = UINT16_MAX;
+
+    /*The angle of `lv_atan2` grows counter-clockwise on the screen (Y grows downwards) but the rotation is clockwise*/
+    int32_t rotation = proc->types.pointer.rotation;
+    if(p[0].x != p[1].x || p[0].y != p[1].y) {
+        rotation = ((int32_t)proc->types.pointer.pinch_angle_start - indev_touch_angle(p)) * 10;
+        if(rotation > 1800) rotation -= 3600;
+        else if(rotation <= -1800) rotation += 3600;
+    }
+
+    /*Send the events to the pressed object or to the parent which handles the gestures*/
+    lv_obj_t * gesture_obj = proc->types.pointer.act_obj;
+    while(gesture_obj && lv_obj_has_flag(gesture_obj, LV_OBJ_FLAG_GESTURE_BUBBLE)) {
+        gesture_obj = lv_obj_get_parent(gesture_obj);
+    }
+
+    if(proc->types.pointer.pinch_sent == 0 &&
+       LV_ABS((int32_t)dist - (int32_t)proc->types.pointer.pinch_dist_start) > LV_INDEV_DEF_PINCH_LIMIT) {
+        proc->types.pointer.pinch_sent = 1;
+        proc->types.pointer.pinch_scale = 0; /*Be sure to send the first event*/
+    }
+
+    if(proc->types.pointer.pinch_sent && proc->types.pointer.pinch_scale != scale) {
+        proc->types.pointer.pinch_scale = scale;
+        proc->types.pointer.multi_gesture_sent = 1;
+        if(gesture_obj) {
+            lv_event_send(gesture_obj, LV_EVENT_PINCH, indev_act);
+            if(indev_reset_check(proc)) return;
+        }
+    }
+
+    if(proc->types.pointer.rotate_sent == 0 && LV_ABS(rotation) > LV_INDEV_DEF_ROTATE_LIMIT) {
+        proc->types.pointer.rotate_sent = 1;
+        proc->types.pointer.rotation = 0;
+    }
+
+    if(proc->types.pointer.rotate_sent && proc->types.pointer.rotation != rotation) {
+        proc->types.pointer.rotation = rotation;
+        proc->types.pointer.multi_gesture_sent = 1;
+        if(gesture_obj) {
+            lv_event_send(gesture_obj, LV_EVENT_ROTATE, indev_act);
+            if(indev_reset_check(proc)) return;
+        }
+    }
+}
+
+/**
+ * Find a touch by its ID
+ * @param data pointer to the data read from the input device
+ * @param id the ID of the touch
+ * @return pointer to the touch or NULL if the finger is not touching
+ */
+static const lv_indev_touch_t * indev_find_touch(const lv_indev_data_t * data, int32_t id)
+{
+    uint8_t t;
+    for(t = 0; t < data->touch_cnt; t++) {
+        if(data->touches[t].id == id) return &data->touches[t];
+    }
+    return NULL;
+}
+
+/**
+ * Get the distance of two touches
+ * @param p the two points
+ * @return the distance in pixels
+ */
+static uint32_t indev_touch_dist(const lv_point_t p[2])
+{
+    int32_t dx = p[1].x - p[0].x;
+    int32_t dy = p[1].y - p[0].y;
+    lv_sqrt_res_t res;
+    lv_sqrt((uint32_t)(dx * dx + dy * dy), &res, 0x8000);
+    return res.i;
+}
+
+/**
+ * Get the angle of the line between two touches
+ * @param p the two points
+ * @return the angle in degrees [0..360]
+ */
+static uint16_t indev_touch_angle(const lv_point_t p[2])
+{
+    if(p[0].x == p[1].x && p[0].y == p[1].y) return 0;
+    return lv_atan2(p[1].x - p[0].x, p[1].y - p[0].y);
+}
+
+/**
+ * Convert a point read from an input device to the rotation of its display
+ * @param disp the display of the input device
+ * @param point a point to convert
+ */
+static void indev_rotate_point(const lv_disp_t * disp, lv_point_t * point)
+{
+    if(disp->driver->rotated == LV_DISP_ROT_180 || disp->driver->rotated == LV_DISP_ROT_270) {
+        point->x = disp->driver->hor_res - point->x - 1;
+        point->y = disp->driver->ver_res - point->y - 1;
+    }
+    if(disp->driver->rotated == LV_DISP_ROT_90 || disp->driver->rotated == LV_DISP_ROT_270) {
+        lv_coord_t tmp = point->y;
+        point->y = point->x;
+        point->x = disp->driver->ver_res - tmp - 1;
+    }
+}
+
 /**
  * Process a new point from LV_INDEV_TYPE_KEYPAD input device
  * @param i pointer to an input device
@@ -405,7 +739,7 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
     /*Key press happened*/
     if(data->state == LV_INDEV_STATE_PRESSED && prev_state == LV_INDEV_STATE_RELEASED) {
         LV_LOG_INFO("%d key is pressed", data->key);
-        i->proc.pr_timestamp = lv_tick_get();
+        i->proc.pr_timestamp = i->proc.timestamp;
 
         /*Simulate a press on the object if ENTER was pressed*/
         if(data->key == LV_KEY_ENTER) {
@@ -448,19 +782,19 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
         }
 
         /*Long press time has elapsed?*/
-        if(i->proc.long_pr_sent == 0 && lv_tick_elaps(i->proc.pr_timestamp) > i->driver->long_press_time) {
+        if(i->proc.long_pr_sent == 0 && indev_elaps(&i->proc, i->proc.pr_timestamp) > i->driver->long_press_time) {
             i->proc.long_pr_sent = 1;
             if(data->key == LV_KEY_ENTER) {
-                i->proc.longpr_rep_timestamp = lv_tick_get();
+                i->proc.longpr_rep_timestamp = i->proc.timestamp;
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, indev_act);
                 if(indev_reset_check(&i->proc)) return;
             }
         }
         /*Long press repeated time has elapsed?*/
         else if(i->proc.long_pr_sent != 0 &&
-                lv_tick_elaps(i->proc.longpr_rep_timestamp) > i->driver->long_press_repeat_time) {
+                indev_elaps(&i->proc, i->proc.longpr_rep_timestamp) > i->driver->long_press_repeat_time) {
 
-            i->proc.longpr_rep_timestamp = lv_tick_get();
+            i->proc.longpr_rep_timestamp = i->proc.timestamp;
 
             /*Send LONG_PRESS_REP on ENTER*/
             if(data->key == LV_KEY_ENTER) {
@@ -552,7 +886,7 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
     if(data->state == LV_INDEV_STATE_PRESSED && last_state == LV_INDEV_STATE_RELEASED) {
         LV_LOG_INFO("pressed");
 
-        i->proc.pr_timestamp = lv_tick_get();
+        i->proc.pr_timestamp = i->proc.timestamp;
 
         if(data->key == LV_KEY_ENTER) {
             bool editable_or_scrollable = lv_obj_is_editable(indev_obj_act) ||
@@ -585,10 +919,10 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
     /*Pressing*/
     else if(data->state == LV_INDEV_STATE_PRESSED && last_state == LV_INDEV_STATE_PRESSED) {
         /*Long press*/
-        if(i->proc.long_pr_sent == 0 && lv_tick_elaps(i->proc.pr_timestamp) > i->driver->long_press_time) {
+        if(i->proc.long_pr_sent == 0 && indev_elaps(&i->proc, i->proc.pr_timestamp) > i->driver->long_press_time) {
 
             i->proc.long_pr_sent = 1;
-            i->proc.longpr_rep_timestamp = lv_tick_get();
+            i->proc.longpr_rep_timestamp = i->proc.timestamp;
 
             if(data->key == LV_KEY_ENTER) {
                 bool editable_or_scrollable = lv_obj_is_editable(indev_obj_act) ||
@@ -613,9 +947,9 @@ static void indev_encoder_proc(lv_indev_t * i, lv_indev_data_t * data)
             i->proc.long_pr_sent = 1;
         }
         /*Long press repeated time has elapsed?*/
-        else if(i->proc.long_pr_sent != 0 && lv_tick_elaps(i->proc.longpr_rep_timestamp) > i->driver->long_press_repeat_time) {
+        else if(i->proc.long_pr_sent != 0 && indev_elaps(&i->proc, i->proc.longpr_rep_timestamp) > i->driver->long_press_repeat_time) {
 
-            i->proc.longpr_rep_timestamp = lv_tick_get();
+            i->proc.longpr_rep_timestamp = i->proc.timestamp;
 
             if(data->key == LV_KEY_ENTER) {
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED_REPEAT, indev_act);
@@ -828,7 +1162,7 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
 
         if(indev_obj_act != NULL) {
             /*Save the time when the obj pressed to count long press time.*/
-            proc->pr_timestamp                 = lv_tick_get();
+            proc->pr_timestamp                 = proc->timestamp;
             proc->long_pr_sent                 = 0;
             proc->types.pointer.scroll_sum.x     = 0;
             proc->types.pointer.scroll_sum.y     = 0;
@@ -837,6 +1171,7 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
             proc->types.pointer.gesture_sent   = 0;
             proc->types.pointer.gesture_sum.x  = 0;
             proc->types.pointer.gesture_sum.y  = 0;
+            proc->types.pointer.multi_gesture_sent = 0;
             proc->types.pointer.vect.x         = 0;
             proc->types.pointer.vect.y         = 0;
 
@@ -860,8 +1195,20 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
     proc->types.pointer.scroll_throw_vect.x = (proc->types.pointer.scroll_throw_vect.x * 4) >> 3;
     proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y * 4) >> 3;
 
-    proc->types.pointer.scroll_throw_vect.x += (proc->types.pointer.vect.x * 4) >> 3;
-    proc->types.pointer.scroll_throw_vect.y += (proc->types.pointer.vect.y * 4) >> 3;
+    /*The throw is applied once in every read period so scale the vector of the samples
+     *which were taken closer to or farther from each other (e.g. buffered by the driver)*/
+    lv_point_t throw_vect = proc->types.pointer.vect;
+    uint32_t period = indev_act->driver->read_timer ? indev_act->driver->read_timer->period : 0;
+    uint32_t dt = proc->timestamp_elaps;
+    if(period && dt && dt != period) {
+        if(dt > period * 4) dt = period * 4;
+        if(dt < period / 4) dt = LV_MAX(period / 4, 1);
+        throw_vect.x = (int32_t)throw_vect.x * (int32_t)period / (int32_t)dt;
+        throw_vect.y = (int32_t)throw_vect.y * (int32_t)period / (int32_t)dt;
+    }
+
+    proc->types.pointer.scroll_throw_vect.x += (throw_vect.x * 4) >> 3;
+    proc->types.pointer.scroll_throw_vect.y += (throw_vect.y * 4) >> 3;
 
     proc->types.pointer.scroll_throw_vect_ori = proc->types.pointer.scroll_throw_vect;
 
@@ -876,10 +1223,11 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
         indev_gesture(proc);
         if(indev_reset_check(proc)) return;
 
-        /*If there is no scrolling then check for long press time*/
-        if(proc->types.pointer.scroll_obj == NULL && proc->long_pr_sent == 0) {
+        /*If there is no scrolling or pinching then check for long press time*/
+        if(proc->types.pointer.scroll_obj == NULL && proc->types.pointer.multi_gesture_sent == 0 &&
+           proc->long_pr_sent == 0) {
             /*Call the ancestor's event handler about the long press if enough time elapsed*/
-            if(lv_tick_elaps(proc->pr_timestamp) > indev_act->driver->long_press_time) {
+            if(indev_elaps(proc, proc->pr_timestamp) > indev_act->driver->long_press_time) {
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED, indev_act);
                 if(indev_reset_check(proc)) return;
 
@@ -887,17 +1235,17 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
                 proc->long_pr_sent = 1;
 
                 /*Save the long press time stamp for the long press repeat handler*/
-                proc->longpr_rep_timestamp = lv_tick_get();
+                proc->longpr_rep_timestamp = proc->timestamp;
             }
         }
 
         /*Send long press repeated Call the ancestor's event handler*/
         if(proc->types.pointer.scroll_obj == NULL && proc->long_pr_sent == 1) {
             /*Call the ancestor's event handler about the long press repeat if enough time elapsed*/
-            if(lv_tick_elaps(proc->longpr_rep_timestamp) > indev_act->driver->long_press_repeat_time) {
+            if(indev_elaps(proc, proc->longpr_rep_timestamp) > indev_act->driver->long_press_repeat_time) {
                 lv_event_send(indev_obj_act, LV_EVENT_LONG_PRESSED_REPEAT, indev_act);
                 if(indev_reset_check(proc)) return;
-                proc->longpr_rep_timestamp = lv_tick_get();
+                proc->longpr_rep_timestamp = proc->timestamp;
             }
         }
     }
@@ -927,8 +1275,8 @@ static void indev_proc_release(_lv_indev_proc_t * proc)
         lv_event_send(indev_obj_act, LV_EVENT_RELEASED, indev_act);
         if(indev_reset_check(proc)) return;
 
-        /*Send CLICK if no scrolling*/
-        if(scroll_obj == NULL) {
+        /*Send CLICK if no scrolling and pinching*/
+        if(scroll_obj == NULL && proc->types.pointer.multi_gesture_sent == 0) {
             if(proc->long_pr_sent == 0) {
                 lv_event_send(indev_obj_act, LV_EVENT_SHORT_CLICKED, indev_act);
                 if(indev_reset_check(proc)) return;
@@ -1114,3 +1462,15 @@ static bool indev_reset_check(_lv_indev_proc_t * proc)
 
     return proc->reset_query ? true : false;
 }
+
+/**
+ * Get the time elapsed since a time stamp until the time of the processed sample
+ * @param proc pointer to an input device 'proc'
+ * @param prev_tick a previous time stamp
+ * @return the elapsed time or 0 if `prev_tick` is not earlier than the sample
+ */
+static uint32_t indev_elaps(const _lv_indev_proc_t * proc, uint32_t prev_tick)
+{
+    int32_t elaps = (int32_t)(proc->timestamp - prev_tick);
+    return elaps > 0 ? (uint32_t)elaps : 0;
+}
@@ -101,6 +101,31 @@ void lv_indev_get_point(const lv_indev_t * indev, lv_point_t * point);
 */
 lv_dir_t lv_indev_get_gesture_dir(const lv_indev_t * indev);
 
+/**
+ * Get the scale of the pinch gesture of a LV_INDEV_TYPE_MULTI_POINTER input device.
+ * Can be used in `LV_EVENT_PINCH`.
+ * @param indev pointer to an input device
+ * @return the scale relative to the distance of the fingers when the second finger touched.
+ *         256 (`LV_IMG_ZOOM_NONE`) means no change, 512 double distance.
+ */
+uint16_t lv_indev_get_pinch_scale(const lv_indev_t * indev);
+
+/**
+ * Get the rotation of the two fingers of a LV_INDEV_TYPE_MULTI_POINTER input device.
+ * Can be used in `LV_EVENT_ROTATE`.
+ * @param indev pointer to an input device
+ * @return the rotation since the second finger touched in 0.1 degree units. Positive values are clockwise.
+ */
+int16_t lv_indev_get_rotation(const lv_indev_t * indev);
+
+/**
+ * Get the middle point of the two fingers of a LV_INDEV_TYPE_MULTI_POINTER input device.
+ * It's the pivot of the pinch and rotation.
+ * @param indev pointer to an input device
+ * @param point pointer to a point to store the result
+ */
+void lv_indev_get_pinch_center(const lv_indev_t * indev, lv_point_t * point);
+
 /**
  * Get the last pressed key of an input device (for LV_INDEV_TYPE_KEYPAD)
  * @param indev pointer to an input device
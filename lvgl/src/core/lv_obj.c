@@ -104,6 +104,10 @@ void lv_init(void)
 
     _lv_timer_core_init();
 
+#if LV_USE_ASYNC_QUEUE
+    _lv_async_queue_init();
+#endif
+
     _lv_fs_init();
 
     _lv_anim_core_init();
@@ -225,6 +229,9 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
+
+    /*Floating children are not scrolled so they are not indexed by the parent*/
+    if(f & LV_OBJ_FLAG_FLOATING) _lv_obj_child_index_invalidate(lv_obj_get_parent(obj));
 }
 
 void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
@@ -245,6 +252,8 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
+
+    if(f & LV_OBJ_FLAG_FLOATING) _lv_obj_child_index_invalidate(lv_obj_get_parent(obj));
 }
 
 void lv_obj_add_state(lv_obj_t * obj, lv_state_t state)
@@ -425,6 +434,9 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             lv_mem_free(obj->spec_attr->children);
             obj->spec_attr->children = NULL;
         }
+        if(obj->spec_attr->child_index) {
+            _lv_obj_child_index_free(obj);
+        }
         if(obj->spec_attr->event_dsc) {
             lv_mem_free(obj->spec_attr->event_dsc);
             obj->spec_attr->event_dsc = NULL;
@@ -104,6 +104,7 @@ enum {
     LV_OBJ_FLAG_ADV_HITTEST     = (1 << 14), /**< Allow performing more accurate hit (click) test. E.g. consider rounded corners.*/
     LV_OBJ_FLAG_IGNORE_LAYOUT   = (1 << 15), /**< Make the object position-able by the layouts*/
     LV_OBJ_FLAG_FLOATING        = (1 << 16), /**< Do not scroll the object when the parent scrolls and ignore layout*/
+    LV_OBJ_FLAG_LAYER           = (1 << 17), /**< Draw the object and its children from a cached layer. Set by `lv_snapshot_layer_add()`*/
 
     LV_OBJ_FLAG_LAYOUT_1        = (1 << 23), /**< Custom flag, free to use by layouts*/
     LV_OBJ_FLAG_LAYOUT_2        = (1 << 24), /**< Custom flag, free to use by layouts*/
@@ -149,9 +150,11 @@ extern const lv_obj_class_t lv_obj_class;
 typedef struct {
     struct _lv_obj_t ** children;       /**< Store the pointer of the children in an array.*/
     uint32_t child_cnt;                 /**< Number of children*/
+    struct _lv_obj_child_index_t * child_index;  /**< Index of the children by their position (if there are many children)*/
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint64_t event_mask;                /**< A bit for each event code having a callback in `event_dsc`*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -177,6 +180,7 @@ typedef struct _lv_obj_t {
     lv_state_t state;
     uint16_t layout_inv :1;
     uint16_t scr_layout_inv :1;
+    uint16_t child_layout_inv :1;
     uint16_t skip_trans :1;
     uint16_t style_cnt  :6;
     uint16_t h_layout   :1;
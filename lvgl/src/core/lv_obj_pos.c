@@ -10,6 +10,7 @@
 #include "lv_disp.h"
 #include "lv_refr.h"
 #include "../misc/lv_gc.h"
+#include "../extra/others/snapshot/lv_snapshot.h"
 
 /*********************
  *      DEFINES
@@ -25,11 +26,13 @@
  **********************/
 static void calc_auto_size(lv_obj_t * obj, lv_coord_t * w_out, lv_coord_t * h_out);
 static void layout_update_core(lv_obj_t * obj);
+static void invalidate_area_core(const lv_obj_t * obj, const lv_area_t * area, bool moved);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+static uint32_t layout_visit_cnt;
 
 /**********************
  *      MACROS
@@ -152,7 +155,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     if(lv_obj_get_width(obj) == w && lv_obj_get_height(obj) == h) return false;
 
     /*Invalidate the original area*/
-    lv_obj_invalidate(obj);
+    _lv_obj_invalidate_moved(obj);
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -176,6 +179,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    _lv_obj_child_index_invalidate(parent);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_event_send(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -184,7 +188,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
 
     /*Invalidate the new area*/
-    lv_obj_invalidate(obj);
+    _lv_obj_invalidate_moved(obj);
 
     lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
 
@@ -277,8 +281,13 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
+    /*Mark the parents too to visit only the invalid branches on layout update.
+     *Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = obj;
+    while(scr->parent) {
+        scr = scr->parent;
+        scr->child_layout_inv = 1;
+    }
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
@@ -319,6 +328,11 @@ uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
     return layout_cnt;  /*No -1 to skip 0th index*/
 }
 
+uint32_t lv_layout_get_visit_cnt(void)
+{
+    return layout_visit_cnt;
+}
+
 void lv_obj_set_align(lv_obj_t * obj, lv_align_t align)
 {
     lv_obj_set_style_align(obj, align, 0);
@@ -714,7 +728,7 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     if(diff.x == 0 && diff.y == 0) return;
 
     /*Invalidate the original area*/
-    lv_obj_invalidate(obj);
+    _lv_obj_invalidate_moved(obj);
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -738,12 +752,13 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     obj->coords.y2 += diff.y;
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
+    _lv_obj_child_index_invalidate(parent);
 
     /*Call the ancestor's event handler to the parent too*/
     if(parent) lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
 
     /*Invalidate the new area*/
-    lv_obj_invalidate(obj);
+    _lv_obj_invalidate_moved(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the srollbars*/
@@ -774,11 +789,7 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    lv_area_t area_tmp;
-    lv_area_copy(&area_tmp, area);
-    bool visible = lv_obj_area_is_visible(obj, &area_tmp);
-
-    if(visible) _lv_inv_area(lv_obj_get_disp(obj), &area_tmp);
+    invalidate_area_core(obj, area, false);
 }
 
 void lv_obj_invalidate(const lv_obj_t * obj)
@@ -798,6 +809,19 @@ void lv_obj_invalidate(const lv_obj_t * obj)
 
 }
 
+void _lv_obj_invalidate_moved(const lv_obj_t * obj)
+{
+    lv_area_t obj_coords;
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_copy(&obj_coords, &obj->coords);
+    obj_coords.x1 -= ext_size;
+    obj_coords.y1 -= ext_size;
+    obj_coords.x2 += ext_size;
+    obj_coords.y2 += ext_size;
+
+    invalidate_area_core(obj, &obj_coords, true);
+}
+
 bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
@@ -862,6 +886,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    _lv_obj_child_index_invalidate(lv_obj_get_parent(obj));
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -938,11 +963,18 @@ static void calc_auto_size(lv_obj_t * obj, lv_coord_t * w_out, lv_coord_t * h_ou
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    layout_visit_cnt++;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    /*Update the children first because the size of this object can depend on them.
+     *Skip the children which have no invalid layout in their branch.*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->child_layout_inv) layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv == 0) return;
@@ -955,8 +987,33 @@ static void layout_update_core(lv_obj_t * obj)
     if(child_cnt > 0) {
         uint32_t layout_id = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout_id > 0 && layout_id <= layout_cnt) {
+            /*The layouts set the coordinates of the children directly*/
+            _lv_obj_child_index_invalidate(obj);
             void  * user_data = LV_GC_ROOT(_lv_layout_list)[layout_id -1].user_data;
             LV_GC_ROOT(_lv_layout_list)[layout_id -1].cb(obj, user_data);
         }
     }
 }
+
+/**
+ * Invalidate an area of an object
+ * @param obj pointer to an object
+ * @param area the area to redraw
+ * @param moved true: `obj` is invalidated because it was moved so only its position has changed
+ */
+static void invalidate_area_core(const lv_obj_t * obj, const lv_area_t * area, bool moved)
+{
+    lv_area_t area_tmp;
+    lv_area_copy(&area_tmp, area);
+
+#if LV_USE_SNAPSHOT
+    /*Update the layers and get where the change can be seen*/
+    obj = _lv_snapshot_layer_invalidate(obj, &area_tmp, moved);
+#else
+    LV_UNUSED(moved);
+#endif
+
+    bool visible = lv_obj_area_is_visible(obj, &area_tmp);
+
+    if(visible) _lv_inv_area(lv_obj_get_disp(obj), &area_tmp);
+}
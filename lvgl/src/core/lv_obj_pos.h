@@ -148,6 +148,14 @@ void lv_obj_update_layout(const struct _lv_obj_t * obj);
  */
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data);
 
+/**
+ * Get the number of objects visited by the layout updates.
+ * Only the objects with invalid layout and their parents are visited,
+ * so it shows the cost of the layout updates. E.g. check it before and after `lv_obj_update_layout()`.
+ * @return          the number of visited objects since the start
+ */
+uint32_t lv_layout_get_visit_cnt(void);
+
 /**
  * Change the alignment of an object.
  * @param obj       pointer to an object to align
@@ -335,6 +343,13 @@ void lv_obj_invalidate_area(const struct _lv_obj_t * obj, const lv_area_t * area
  */
 void lv_obj_invalidate(const struct _lv_obj_t * obj);
 
+/**
+ * Mark the area of an object as invalid because it's moved. Unlike `lv_obj_invalidate()`
+ * it keeps the cache of the object if it's a layer as only its position changes.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_invalidate_moved(const struct _lv_obj_t * obj);
+
 /**
  * Tell whether an area of an object is visible (even partially) now or not
  * @param obj       pointer to an object
@@ -11,6 +11,7 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -32,6 +33,9 @@
  *  STATIC PROTOTYPES
  **********************/
 static void scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y);
+static bool scroll_get_copy_area(lv_obj_t * obj, lv_area_t * area);
+static bool scroll_area_is_covered(lv_obj_t * parent, uint32_t start_id, const lv_area_t * area);
+static void scroll_invalidate_frame(lv_obj_t * obj, const lv_area_t * area);
 static void scroll_x_anim(void * obj, int32_t v);
 static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_anim_ready_cb(lv_anim_t * a);
@@ -606,13 +610,155 @@ static void scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+    /*If possible, move the already drawn content on the display and redraw only the uncovered parts*/
+    lv_area_t copy_area;
+    bool copy = scroll_get_copy_area(obj, &copy_area);
+    if(copy) lv_obj_scrollbar_invalidate(obj);
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
+
+    if(copy) {
+        _lv_inv_area_scroll(lv_obj_get_disp(obj), &copy_area, x, y);
+        scroll_invalidate_frame(obj, &copy_area);
+        lv_obj_scrollbar_invalidate(obj);
+    }
+
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return;
-    lv_obj_invalidate(obj);
+    if(!copy) lv_obj_invalidate(obj);
+}
+
+/**
+ * Get the area of an object whose pixels can be simply moved on the display when the object is scrolled.
+ * Only a plain background can be under the children and nothing else can be drawn on them.
+ * @param obj pointer to an object
+ * @param area store the visible part of the movable area here
+ * @return true: the pixels can be moved; false: the object needs to be redrawn
+ */
+static bool scroll_get_copy_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp == NULL || disp->driver->copy_cb == NULL) return false;
+    if(disp->prev_scr || disp->scr_to_load) return false;   /*A screen load animation is in progress*/
+
+    /*The widgets might draw something which doesn't move with the children*/
+    if(obj->class_p != &lv_obj_class) return false;
+    if(lv_obj_has_event_cb(obj, LV_EVENT_DRAW_MAIN_BEGIN) || lv_obj_has_event_cb(obj, LV_EVENT_DRAW_MAIN) ||
+       lv_obj_has_event_cb(obj, LV_EVENT_DRAW_MAIN_END)) return false;
+
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) != LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return false;
+
+    /*The floating children stay in place*/
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) && !lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) return false;
+    }
+
+    /*Leave out the border and the rounded corners*/
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t bw = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t frame = LV_MAX(r, bw);
+    if(frame > lv_obj_get_width(obj) / 2 || frame > lv_obj_get_height(obj) / 2) return false;
+
+    lv_area_copy(area, &obj->coords);
+    lv_area_increase(area, -frame, -frame);
+    if(lv_obj_area_is_visible(obj, area) == false) return false;
+
+    /*Nothing else can be drawn on the area: neither the later siblings of the object or its parents,
+     *nor the scrollbars of the parents*/
+    lv_obj_t * o = obj;
+    while(o) {
+        if(lv_obj_has_flag(o, LV_OBJ_FLAG_LAYER)) return false;
+        if(lv_obj_get_style_opa(o, LV_PART_MAIN) != LV_OPA_COVER) return false;
+        if(lv_obj_has_event_cb(o, LV_EVENT_DRAW_POST_BEGIN) || lv_obj_has_event_cb(o, LV_EVENT_DRAW_POST) ||
+           lv_obj_has_event_cb(o, LV_EVENT_DRAW_POST_END)) return false;
+
+        lv_obj_t * parent = lv_obj_get_parent(o);
+        if(parent) {
+            if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN)) return false;
+
+            lv_area_t hor_area;
+            lv_area_t ver_area;
+            lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+            if(lv_area_get_size(&hor_area) > 0 && _lv_area_is_on(&hor_area, area)) return false;
+            if(lv_area_get_size(&ver_area) > 0 && _lv_area_is_on(&ver_area, area)) return false;
+
+            if(scroll_area_is_covered(parent, lv_obj_get_child_id(o) + 1, area)) return false;
+        }
+        else {
+            /*The top and system layers are drawn on the screen*/
+            if(o == lv_disp_get_scr_act(disp)) {
+                if(scroll_area_is_covered(lv_disp_get_layer_top(disp), 0, area)) return false;
+            }
+            if(o != lv_disp_get_layer_sys(disp)) {
+                if(scroll_area_is_covered(lv_disp_get_layer_sys(disp), 0, area)) return false;
+            }
+        }
+        o = parent;
+    }
+
+    return true;
+}
+
+/**
+ * Tell if any children of an object are drawn on an area
+ * @param parent pointer to an object
+ * @param start_id check the children from this index
+ * @param area the area to check
+ * @return true: a visible child is drawn on the area
+ */
+static bool scroll_area_is_covered(lv_obj_t * parent, uint32_t start_id, const lv_area_t * area)
+{
+    _lv_obj_child_iter_t iter;
+    _lv_obj_child_iter_init(&iter, parent, area, true);
+    lv_obj_t * child;
+    while((child = _lv_obj_child_iter_next(&iter)) != NULL) {
+        if(iter.last_id < start_id) break;
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t child_area;
+        lv_area_copy(&child_area, &child->coords);
+        lv_coord_t ext_size = _lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&child_area, ext_size, ext_size);
+        if(_lv_area_is_on(&child_area, area)) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Invalidate the part of an object around the area whose pixels are moved.
+ * The children are drawn there too but they are not moved.
+ * @param obj pointer to an object
+ * @param area the area whose pixels are moved
+ */
+static void scroll_invalidate_frame(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_area_t a;
+    if(area->y1 > obj->coords.y1) {
+        lv_area_set(&a, obj->coords.x1, obj->coords.y1, obj->coords.x2, area->y1 - 1);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    if(area->y2 < obj->coords.y2) {
+        lv_area_set(&a, obj->coords.x1, area->y2 + 1, obj->coords.x2, obj->coords.y2);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    if(area->x1 > obj->coords.x1) {
+        lv_area_set(&a, obj->coords.x1, area->y1, area->x1 - 1, area->y2);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    if(area->x2 < obj->coords.x2) {
+        lv_area_set(&a, area->x2 + 1, area->y1, obj->coords.x2, area->y2);
+        lv_obj_invalidate_area(obj, &a);
+    }
 }
 
 static void scroll_x_anim(void * obj, int32_t v)
@@ -171,7 +171,13 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 
     if(!style_refr) return;
 
-    lv_obj_invalidate(obj);
+    /*These properties only move the object. Invalidate the current position as moved to keep the cached layers,
+     *the new position is invalidated by `lv_obj_move_to()` on the layout update.*/
+    bool pos_only = prop == LV_STYLE_X || prop == LV_STYLE_Y || prop == LV_STYLE_ALIGN ||
+                    prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y;
+
+    if(pos_only) _lv_obj_invalidate_moved(obj);
+    else lv_obj_invalidate(obj);
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
@@ -193,7 +199,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     if(prop == LV_STYLE_PROP_ANY || (prop & LV_STYLE_PROP_EXT_DRAW)) {
         lv_obj_refresh_ext_draw_size(obj);
     }
-    lv_obj_invalidate(obj);
+    if(!pos_only) lv_obj_invalidate(obj);
 
     if(prop == LV_STYLE_PROP_ANY ||
       ((prop & LV_STYLE_PROP_INHERIT) && ((prop & LV_STYLE_PROP_EXT_DRAW) || (prop & LV_STYLE_PROP_LAYOUT_REFR))))
@@ -25,12 +25,35 @@
  *      TYPEDEFS
  **********************/
 
+/**
+ * The children which are placed in order along an axis are sorted by their start coordinate.
+ * The coordinates are relative to the parent and its scroll position so moving and scrolling the parent
+ * doesn't change them. The floating and the too large children are not indexed; they are always visited.
+ */
+typedef struct _lv_obj_child_index_t {
+    uint32_t * ids;         /*IDs of the indexed children from the start and IDs of the others from the end*/
+    int32_t * keys;         /*Start coordinates of the indexed children*/
+    uint32_t size;          /*Length of the arrays*/
+    uint32_t indexed_cnt;
+    uint32_t other_cnt;
+    uint32_t stamp;         /*Incremented on every rebuild*/
+    lv_coord_t max_len;     /*Largest width or height of the indexed children*/
+    lv_coord_t max_ext;     /*Largest extra draw or click area of the indexed children*/
+    uint8_t valid : 1;
+    uint8_t usable : 1;     /*0: the children are not in order, visit all of them*/
+    uint8_t hor : 1;        /*1: the children are in order along the X axis*/
+} lv_obj_child_index_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_obj_del_async_cb(void * obj);
 static void obj_del_core(lv_obj_t * obj);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
+static lv_obj_child_index_t * child_index_get(lv_obj_t * obj);
+static bool child_index_build(lv_obj_t * obj, lv_obj_child_index_t * index, bool hor, int32_t * span);
+static int32_t child_index_ofs(const lv_obj_t * obj, bool hor);
+static uint32_t child_index_search(const lv_obj_child_index_t * index, int32_t key);
 
 /**********************
  *  STATIC VARIABLES
@@ -170,10 +193,13 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
         old_parent->spec_attr->children = NULL;
     }
 
+    _lv_obj_child_index_invalidate(old_parent);
+
     /*Add the child to the new parent as the last (newest child)*/
     parent->spec_attr->child_cnt++;
     parent->spec_attr->children = lv_mem_realloc(parent->spec_attr->children, parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
+    _lv_obj_child_index_invalidate(parent);
 
     obj->parent = parent;
 
@@ -206,6 +232,7 @@ void lv_obj_move_foreground(lv_obj_t * obj)
         parent->spec_attr->children[i] = parent->spec_attr->children[i + 1];
     }
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
+    _lv_obj_child_index_invalidate(parent);
 
     /*Notify the new parent about the child*/
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -224,6 +251,7 @@ void lv_obj_move_background(lv_obj_t * obj)
         parent->spec_attr->children[i] = parent->spec_attr->children[i-1];
     }
     parent->spec_attr->children[0] = obj;
+    _lv_obj_child_index_invalidate(parent);
 
     /*Notify the new parent about the child*/
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -244,6 +272,8 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     parent->spec_attr->children[index1] = obj2;
     parent2->spec_attr->children[index2] = obj1;
+    _lv_obj_child_index_invalidate(parent);
+    _lv_obj_child_index_invalidate(parent2);
 
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_event_send(parent2, LV_EVENT_CHILD_CHANGED, obj1);
@@ -268,6 +298,7 @@ void lv_obj_move_up(lv_obj_t * obj)
         lv_obj_t* obj2 = parent->spec_attr->children[index - 1];
         parent->spec_attr->children[index - 1] = obj;
         parent->spec_attr->children[index] = obj2;
+        _lv_obj_child_index_invalidate(parent);
 
         lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
         lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj2);
@@ -290,6 +321,7 @@ void lv_obj_move_down(lv_obj_t* obj)
         lv_obj_t* obj2 = parent->spec_attr->children[index + 1];
         parent->spec_attr->children[index + 1] = obj;
         parent->spec_attr->children[index] = obj2;
+        _lv_obj_child_index_invalidate(parent);
 
         lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
         lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj2);
@@ -391,6 +423,110 @@ void lv_obj_tree_walk(lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * use
     walk_core(start_obj, cb, user_data);
 }
 
+void _lv_obj_child_iter_init(_lv_obj_child_iter_t * iter, lv_obj_t * obj, const lv_area_t * area, bool reverse)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+
+    iter->obj = obj;
+    iter->reverse = reverse;
+    iter->indexed = 0;
+    iter->pos = reverse ? child_cnt - 1 : 0;
+    iter->cnt = child_cnt;
+
+    uint32_t index_min = LV_OBJ_CHILD_INDEX_MIN;
+    if(index_min == 0 || child_cnt < index_min) return;
+
+    lv_obj_child_index_t * index = child_index_get(obj);
+    if(index == NULL || !index->usable) return;
+
+    int32_t ofs = child_index_ofs(obj, index->hor);
+    int32_t q1 = (index->hor ? area->x1 : area->y1) - ofs;
+    int32_t q2 = (index->hor ? area->x2 : area->y2) - ofs;
+
+    /*The indexed children start in order so the ones on the area are next to each other*/
+    uint32_t first = child_index_search(index, q1 - index->max_len - index->max_ext + 1);
+    uint32_t last = child_index_search(index, q2 + index->max_ext + 1);
+
+    iter->indexed = 1;
+    iter->stamp = index->stamp;
+    iter->cnt = last - first;
+    iter->pos = reverse ? last - 1 : first;
+    iter->other_cnt = index->other_cnt;
+    iter->other_pos = reverse ? index->other_cnt - 1 : 0;
+}
+
+lv_obj_t * _lv_obj_child_iter_next(_lv_obj_child_iter_t * iter)
+{
+    lv_obj_t * obj = iter->obj;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+
+    if(iter->indexed) {
+        lv_obj_child_index_t * index = obj->spec_attr->child_index;
+        if(index && index->valid && index->stamp == iter->stamp) {
+            uint32_t id;
+            bool other;
+            if(iter->cnt == 0 && iter->other_cnt == 0) return NULL;
+            else if(iter->cnt == 0) other = true;
+            else if(iter->other_cnt == 0) other = false;
+            else {
+                /*Both parts are in child order so merge them*/
+                uint32_t id_ind = index->ids[iter->pos];
+                uint32_t id_other = index->ids[index->size - 1 - iter->other_pos];
+                other = iter->reverse ? id_other > id_ind : id_other < id_ind;
+            }
+
+            if(other) {
+                id = index->ids[index->size - 1 - iter->other_pos];
+                iter->other_pos = iter->reverse ? iter->other_pos - 1 : iter->other_pos + 1;
+                iter->other_cnt--;
+            }
+            else {
+                id = index->ids[iter->pos];
+                iter->pos = iter->reverse ? iter->pos - 1 : iter->pos + 1;
+                iter->cnt--;
+            }
+
+            iter->last_id = id;
+            return obj->spec_attr->children[id];
+        }
+
+        /*The children have changed during the iteration. Continue with the rest of the children.*/
+        iter->indexed = 0;
+        if(iter->reverse) {
+            iter->pos = iter->last_id - 1;
+            iter->cnt = iter->last_id;
+        }
+        else {
+            iter->pos = iter->last_id + 1;
+            iter->cnt = iter->pos < child_cnt ? child_cnt - iter->pos : 0;
+        }
+    }
+
+    if(iter->cnt == 0 || iter->pos >= child_cnt) return NULL;
+
+    uint32_t id = iter->pos;
+    iter->pos = iter->reverse ? iter->pos - 1 : iter->pos + 1;
+    iter->cnt--;
+    iter->last_id = id;
+    return obj->spec_attr->children[id];
+}
+
+void _lv_obj_child_index_invalidate(lv_obj_t * obj)
+{
+    if(obj && obj->spec_attr && obj->spec_attr->child_index) obj->spec_attr->child_index->valid = 0;
+}
+
+void _lv_obj_child_index_free(lv_obj_t * obj)
+{
+    lv_obj_child_index_t * index = obj->spec_attr->child_index;
+    if(index == NULL) return;
+
+    lv_mem_free(index->ids);
+    lv_mem_free(index->keys);
+    lv_mem_free(index);
+    obj->spec_attr->child_index = NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -415,6 +551,11 @@ static void obj_del_core(lv_obj_t * obj)
         child = lv_obj_get_child(obj, 0);
     }
 
+#if LV_USE_ASYNC_QUEUE
+    /*Don't apply the posted updates on the deleted object*/
+    lv_async_post_cancel(obj);
+#endif
+
     lv_group_t * group = lv_obj_get_group(obj);
 
     /*Reset all input devices if the object to delete is used*/
@@ -461,6 +602,7 @@ static void obj_del_core(lv_obj_t * obj)
         }
         obj->parent->spec_attr->child_cnt--;
         obj->parent->spec_attr->children = lv_mem_realloc(obj->parent->spec_attr->children, obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        _lv_obj_child_index_invalidate(obj->parent);
     }
 
     /*Free the object itself*/
@@ -497,3 +639,136 @@ static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb
     }
     return LV_OBJ_TREE_WALK_NEXT;
 }
+
+/**
+ * Get the up-to-date index of the children of an object. Rebuild it if required.
+ * @param obj       pointer to an object
+ * @return          pointer to the index or NULL on out of memory
+ */
+static lv_obj_child_index_t * child_index_get(lv_obj_t * obj)
+{
+    lv_obj_child_index_t * index = obj->spec_attr->child_index;
+    if(index == NULL) {
+        index = lv_mem_alloc(sizeof(lv_obj_child_index_t));
+        LV_ASSERT_MALLOC(index);
+        if(index == NULL) return NULL;
+        lv_memset_00(index, sizeof(lv_obj_child_index_t));
+        obj->spec_attr->child_index = index;
+    }
+
+    if(index->valid) return index;
+
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    if(index->size != child_cnt) {
+        index->ids = lv_mem_realloc(index->ids, child_cnt * sizeof(uint32_t));
+        index->keys = lv_mem_realloc(index->keys, child_cnt * sizeof(int32_t));
+        LV_ASSERT_MALLOC(index->ids);
+        LV_ASSERT_MALLOC(index->keys);
+        if(index->ids == NULL || index->keys == NULL) {
+            _lv_obj_child_index_free(obj);
+            return NULL;
+        }
+        index->size = child_cnt;
+    }
+
+    index->stamp++;
+    index->valid = 1;
+
+    /*Prefer the vertical order but e.g. in a single row only the horizontal order is useful*/
+    int32_t span;
+    index->hor = 0;
+    index->usable = child_index_build(obj, index, false, &span) && span > 0;
+    if(index->usable == 0) {
+        index->hor = 1;
+        index->usable = child_index_build(obj, index, true, &span) && span > 0;
+    }
+
+    return index;
+}
+
+/**
+ * Collect the children sorted along an axis
+ * @param obj       pointer to an object
+ * @param index     the index to fill
+ * @param hor       true: use the X axis; false: use the Y axis
+ * @param span      store the distance between the first and last indexed children here
+ * @return          true: the indexed children are in order along the axis
+ */
+static bool child_index_build(lv_obj_t * obj, lv_obj_child_index_t * index, bool hor, int32_t * span)
+{
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    lv_obj_t ** children = obj->spec_attr->children;
+    uint32_t i;
+
+    /*Children larger than twice the average are not indexed to keep the search range small*/
+    int32_t len_sum = 0;
+    uint32_t len_cnt = 0;
+    for(i = 0; i < child_cnt; i++) {
+        if(lv_obj_has_flag(children[i], LV_OBJ_FLAG_FLOATING)) continue;
+        len_sum += hor ? lv_area_get_width(&children[i]->coords) : lv_area_get_height(&children[i]->coords);
+        len_cnt++;
+    }
+    int32_t len_limit = len_cnt ? (2 * len_sum) / len_cnt : 0;
+
+    int32_t ofs = child_index_ofs(obj, hor);
+    index->indexed_cnt = 0;
+    index->other_cnt = 0;
+    index->max_len = 0;
+    index->max_ext = 0;
+    *span = 0;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = children[i];
+        lv_coord_t len = hor ? lv_area_get_width(&child->coords) : lv_area_get_height(&child->coords);
+        if(len > len_limit || lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) {
+            index->ids[index->size - 1 - index->other_cnt] = i;
+            index->other_cnt++;
+            continue;
+        }
+
+        int32_t key = (hor ? child->coords.x1 : child->coords.y1) - ofs;
+        if(index->indexed_cnt && key < index->keys[index->indexed_cnt - 1]) return false;
+
+        lv_coord_t ext = _lv_obj_get_ext_draw_size(child);
+        if(child->spec_attr) ext = LV_MAX(ext, child->spec_attr->ext_click_pad);
+
+        index->ids[index->indexed_cnt] = i;
+        index->keys[index->indexed_cnt] = key;
+        index->indexed_cnt++;
+        index->max_len = LV_MAX(index->max_len, len);
+        index->max_ext = LV_MAX(index->max_ext, ext);
+    }
+
+    if(index->indexed_cnt) *span = index->keys[index->indexed_cnt - 1] - index->keys[0];
+    return true;
+}
+
+/**
+ * Get the offset of the keys in the index. Moving or scrolling the object changes
+ * the coordinates of the children and the offset with the same value.
+ * @param obj       pointer to an object
+ * @param hor       true: offset on the X axis; false: on the Y axis
+ * @return          the offset
+ */
+static int32_t child_index_ofs(const lv_obj_t * obj, bool hor)
+{
+    if(hor) return obj->coords.x1 + obj->spec_attr->scroll.x;
+    else return obj->coords.y1 + obj->spec_attr->scroll.y;
+}
+
+/**
+ * Find the first indexed child which starts at or after a coordinate
+ * @param index     pointer to an index
+ * @param key       a coordinate relative to the offset of the index
+ * @return          position in the index or the number of indexed children if there is no such child
+ */
+static uint32_t child_index_search(const lv_obj_child_index_t * index, int32_t key)
+{
+    uint32_t lo = 0;
+    uint32_t hi = index->indexed_cnt;
+    while(lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if(index->keys[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
@@ -15,11 +15,16 @@ extern "C" {
  *********************/
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /*********************
  *      DEFINES
  *********************/
 
+/*Index the children of an object if it has at least this many children. 0: don't index the children*/
+#ifndef LV_OBJ_CHILD_INDEX_MIN
+#define LV_OBJ_CHILD_INDEX_MIN    32
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -36,6 +41,22 @@ typedef enum {
 
 typedef lv_obj_tree_walk_res_t (*lv_obj_tree_walk_cb_t)(struct _lv_obj_t *, void *);
 
+/**
+ * Iterates over the children of an object which might be on an area.
+ * Initialize it with `_lv_obj_child_iter_init()`.
+ */
+typedef struct {
+    struct _lv_obj_t * obj;
+    uint32_t pos;           /**< Next position in the index or next child ID*/
+    uint32_t cnt;           /**< Remaining children in the index or in the child list*/
+    uint32_t other_pos;     /**< Next position among the not indexed children*/
+    uint32_t other_cnt;     /**< Remaining not indexed children*/
+    uint32_t last_id;       /**< ID of the last returned child*/
+    uint32_t stamp;         /**< Build stamp of the index when the iteration started*/
+    uint8_t reverse : 1;
+    uint8_t indexed : 1;
+} _lv_obj_child_iter_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -180,6 +201,40 @@ uint32_t lv_obj_get_child_id(const struct _lv_obj_t * obj);
  */
 void lv_obj_tree_walk(struct _lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 
+/**
+ * Start iterating over the children of an object which might be on an area.
+ * If the object has at least `LV_OBJ_CHILD_INDEX_MIN` children and they are placed in order
+ * (e.g. in a list or in rows) only the children around `area` are visited. Else all children are visited.
+ * The children are returned in child order, so the caller still needs to check their coordinates.
+ * @param iter      pointer to an iterator to initialize
+ * @param obj       pointer to an object
+ * @param area      the area to look for the children. The extra draw and click area is taken into account.
+ * @param reverse   true: start from the youngest child
+ */
+void _lv_obj_child_iter_init(_lv_obj_child_iter_t * iter, struct _lv_obj_t * obj, const lv_area_t * area,
+                             bool reverse);
+
+/**
+ * Get the next child of an iteration
+ * @param iter      pointer to an iterator initialized with `_lv_obj_child_iter_init()`
+ * @return          the next child or NULL if there are no more children
+ */
+struct _lv_obj_t * _lv_obj_child_iter_next(_lv_obj_child_iter_t * iter);
+
+/**
+ * Mark the index of the children of an object as outdated.
+ * Should be called if the order, position, size, extra draw or click area of the children changes
+ * not only because the object itself was moved or scrolled.
+ * @param obj       pointer to an object, can be NULL
+ */
+void _lv_obj_child_index_invalidate(struct _lv_obj_t * obj);
+
+/**
+ * Free the index of the children of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_child_index_free(struct _lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
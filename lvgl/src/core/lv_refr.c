@@ -17,6 +17,7 @@
 #include "../misc/lv_gc.h"
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
+#include "../extra/others/snapshot/lv_snapshot.h"
 
 #if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
     #include "../widgets/lv_label.h"
@@ -33,7 +34,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void inv_area_add(lv_disp_t * disp, const lv_area_t * area_p);
+static void inv_pending_flush(void);
+static void refr_copy(void);
 static void lv_refr_join_area(void);
+static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p);
+static uint32_t inv_area_join_cost(const lv_area_t * a1_p, const lv_area_t * a2_p);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
 static void lv_refr_area_part(const lv_area_t * area_p);
@@ -48,6 +54,9 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static uint32_t inv_batch_cnt;
+static lv_disp_t * inv_pending_disp; /*Display of `inv_pending` or NULL if there is no pending area*/
+static lv_area_t inv_pending;
 #if LV_USE_PERF_MONITOR
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
@@ -112,49 +121,128 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->copy_pending = 0;
+        if(inv_pending_disp == disp) inv_pending_disp = NULL;
         return;
     }
 
+    /*In a batch join the consecutive areas if it's cheap (e.g. the old and new area of a moved object)
+     *to save them only once*/
+    if(inv_batch_cnt > 0) {
+        if(inv_pending_disp == disp && inv_area_join_cost(&inv_pending, area_p) <= LV_INV_AREA_COST) {
+            _lv_area_join(&inv_pending, &inv_pending, area_p);
+            return;
+        }
+
+        inv_pending_flush();
+        inv_pending_disp = disp;
+        inv_pending = *area_p;
+        return;
+    }
+
+    inv_area_add(disp, area_p);
+}
+
+/**
+ * Invalidate an area whose content was moved by `dx`, `dy`, e.g. by scrolling.
+ * If the display driver can move the already flushed pixels only the uncovered parts are redrawn.
+ * @param disp pointer to display (NULL to use the default display)
+ * @param area_p the area whose content moved
+ * @param dx horizontal movement
+ * @param dy vertical movement
+ */
+void _lv_inv_area_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dx, lv_coord_t dy)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return;
+
+    lv_disp_drv_t * drv = disp->driver;
     lv_area_t scr_area;
     scr_area.x1 = 0;
     scr_area.y1 = 0;
     scr_area.x2 = lv_disp_get_hor_res(disp) - 1;
     scr_area.y2 = lv_disp_get_ver_res(disp) - 1;
 
-    lv_area_t com_area;
-    bool suc;
+    lv_area_t area;
+    if(_lv_area_intersect(&area, area_p, &scr_area) == false) return;
 
-    suc = _lv_area_intersect(&com_area, area_p, &scr_area);
-    if(suc == false)  return; /*Out of the screen*/
+    /*The pixels can't be moved if the whole screen is redrawn anyway, the pixels are rotated
+     *or another area is moved already*/
+    bool copy_en = drv->copy_cb && !drv->full_refresh && !drv->screen_transp && drv->rotated == LV_DISP_ROT_NONE;
+    if(copy_en && disp->copy_pending && !(area.x1 == disp->copy_area.x1 && area.y1 == disp->copy_area.y1 &&
+                                          area.x2 == disp->copy_area.x2 && area.y2 == disp->copy_area.y2)) {
+        copy_en = false;
+    }
 
-    /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
-    if(disp->driver->full_refresh) {
-        disp->inv_areas[0] = scr_area;
-        disp->inv_p = 1;
-        lv_timer_resume(disp->refr_timer);
+    if(!copy_en || LV_ABS(dx) >= lv_area_get_width(&area) || LV_ABS(dy) >= lv_area_get_height(&area)) {
+        _lv_inv_area(disp, &area);
         return;
     }
 
-    if(disp->driver->rounder_cb) disp->driver->rounder_cb(disp->driver, &com_area);
+    if(inv_pending_disp == disp) inv_pending_flush();
 
-    /*Save only if this area is not in one of the saved areas*/
+    /*The not yet redrawn areas are moved too so redraw them on the new position as well*/
+    lv_area_t moved_areas[LV_INV_BUF_SIZE];
+    uint16_t moved_cnt = 0;
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
-        if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
+        if(_lv_area_intersect(&moved_areas[moved_cnt], &disp->inv_areas[i], &area)) {
+            lv_area_move(&moved_areas[moved_cnt], dx, dy);
+            if(_lv_area_intersect(&moved_areas[moved_cnt], &moved_areas[moved_cnt], &area)) moved_cnt++;
+        }
+    }
+    for(i = 0; i < moved_cnt; i++) {
+        inv_area_add(disp, &moved_areas[i]);
     }
 
-    /*Save the area*/
-    if(disp->inv_p < LV_INV_BUF_SIZE) {
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+    /*Redraw the uncovered parts*/
+    lv_area_t strip;
+    if(dx != 0) {
+        strip = area;
+        if(dx > 0) strip.x2 = area.x1 + dx - 1;
+        else strip.x1 = area.x2 + dx + 1;
+        inv_area_add(disp, &strip);
     }
-    else {   /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+    if(dy != 0) {
+        strip = area;
+        if(dy > 0) strip.y2 = area.y1 + dy - 1;
+        else strip.y1 = area.y2 + dy + 1;
+        inv_area_add(disp, &strip);
+    }
+
+    if(disp->copy_pending) {
+        disp->copy_ofs.x += dx;
+        disp->copy_ofs.y += dy;
+    }
+    else {
+        disp->copy_area = area;
+        disp->copy_ofs.x = dx;
+        disp->copy_ofs.y = dy;
+        disp->copy_pending = 1;
     }
-    disp->inv_p++;
+
     lv_timer_resume(disp->refr_timer);
 }
 
+/**
+ * Start a batch of invalidations where the consecutive areas are joined if it's cheap
+ */
+void _lv_inv_batch_start(void)
+{
+    inv_batch_cnt++;
+}
+
+/**
+ * Finish a batch of invalidations and save the collected areas
+ */
+void _lv_inv_batch_end(void)
+{
+    if(inv_batch_cnt == 0) return;
+
+    inv_batch_cnt--;
+    if(inv_batch_cnt == 0) inv_pending_flush();
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -188,6 +276,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     disp_refr = tmr->user_data;
 
+    /*Don't miss an area which is still being collected*/
+    if(inv_pending_disp == disp_refr) inv_pending_flush();
+
 #if LV_USE_PERF_MONITOR == 0 && LV_USE_MEM_MONITOR == 0
     /**
      * Ensure the timer does not run again automatically.
@@ -196,12 +287,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     lv_timer_pause(tmr);
 #endif
 
-    /*Refresh the screen's layout if required*/
+    /*Refresh the screen's layout if required. The moved objects invalidate their old and new areas.*/
+    _lv_inv_batch_start();
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
 
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+    _lv_inv_batch_end();
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
@@ -211,6 +304,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+#if LV_USE_SNAPSHOT
+    /*Update the cache of the changed layers. It uses temporary displays so do it before drawing anything.*/
+    _lv_snapshot_layer_refr(disp_refr);
+#endif
+
+    /*Move the pixels of a scrolled area before redrawing the uncovered parts*/
+    if(disp_refr->copy_pending) refr_copy();
+
     lv_refr_join_area();
 
     lv_refr_areas();
@@ -326,40 +427,238 @@ uint32_t lv_refr_get_fps_avg(void)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Save an invalid area on a display
+ * @param disp pointer to a display
+ * @param area_p the invalid area
+ */
+static void inv_area_add(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    lv_area_t scr_area;
+    scr_area.x1 = 0;
+    scr_area.y1 = 0;
+    scr_area.x2 = lv_disp_get_hor_res(disp) - 1;
+    scr_area.y2 = lv_disp_get_ver_res(disp) - 1;
+
+    lv_area_t com_area;
+    bool suc;
+
+    suc = _lv_area_intersect(&com_area, area_p, &scr_area);
+    if(suc == false)  return; /*Out of the screen*/
+
+    /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
+    if(disp->driver->full_refresh) {
+        disp->inv_areas[0] = scr_area;
+        disp->inv_p = 1;
+        lv_timer_resume(disp->refr_timer);
+        return;
+    }
+
+    if(disp->driver->rounder_cb) disp->driver->rounder_cb(disp->driver, &com_area);
+
+    /*Save only if this area is not in one of the saved areas*/
+    uint16_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
+    }
+
+    /*Forget the saved areas which are in the new area*/
+    uint16_t inv_p = 0;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(_lv_area_is_in(&disp->inv_areas[i], &com_area, 0) == false) {
+            disp->inv_areas[inv_p] = disp->inv_areas[i];
+            disp->inv_area_joined[inv_p] = disp->inv_area_joined[i];
+            inv_p++;
+        }
+    }
+    disp->inv_p = inv_p;
+
+    /*Save the area*/
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
+    }
+    else {   /*If no place for the area join the areas which result in the least extra pixels*/
+        inv_area_join_cheapest(disp, &com_area);
+    }
+    lv_timer_resume(disp->refr_timer);
+}
+
+/**
+ * Save the area collected in a batch
+ */
+static void inv_pending_flush(void)
+{
+    if(inv_pending_disp == NULL) return;
+
+    lv_disp_t * disp = inv_pending_disp;
+    inv_pending_disp = NULL;
+    inv_area_add(disp, &inv_pending);
+}
+
+/**
+ * Move the pixels of `copy_area` on the display being refreshed
+ */
+static void refr_copy(void)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_coord_t dx = disp_refr->copy_ofs.x;
+    lv_coord_t dy = disp_refr->copy_ofs.y;
+    disp_refr->copy_pending = 0;
+
+    /*If the area was scrolled by its size the uncovered parts are already redrawn*/
+    if(dx == 0 && dy == 0) return;
+    if(LV_ABS(dx) >= lv_area_get_width(&disp_refr->copy_area) ||
+       LV_ABS(dy) >= lv_area_get_height(&disp_refr->copy_area)) return;
+
+    /*The display should have the last frame*/
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+    while(draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    if(drv->copy_cb(drv, &disp_refr->copy_area, dx, dy) == false) {
+        inv_area_add(disp_refr, &disp_refr->copy_area);
+    }
+}
+
+/**
+ * Make the invalid areas cheaper to refresh: join the areas if the extra pixels are cheaper than
+ * refreshing one more area and cut the overlapping parts if redrawing them costs more than the new areas.
+ * Finally sort the areas from top to bottom.
  */
 static void lv_refr_join_area(void)
 {
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint32_t inv_p = 0;
+    uint32_t i;
+    uint32_t j;
+
+    /*Remove the areas which were joined before*/
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i] == 0) {
+            areas[inv_p] = areas[i];
+            inv_p++;
+        }
+    }
+
+    /*Join the areas. A joined area can be joined with an earlier area too so repeat until there is no change.
+     *An area in an other one is always joined because it costs nothing.*/
+    bool joined;
+    do {
+        joined = false;
+        for(i = 0; i < inv_p; i++) {
+            for(j = i + 1; j < inv_p; j++) {
+                if(inv_area_join_cost(&areas[i], &areas[j]) > LV_INV_AREA_COST) continue;
+
+                _lv_area_join(&areas[i], &areas[i], &areas[j]);
+                areas[j] = areas[inv_p - 1];
+                inv_p--;
+                j = i;  /*The joined area is larger so check all the others again*/
+                joined = true;
             }
+        }
+    } while(joined);
+
+    /*Cut the common parts from the later areas.
+     *Not possible with `rounder_cb` because the parts could grow on each other again.*/
+    if(disp_refr->driver->rounder_cb == NULL) {
+        for(j = 1; j < inv_p; j++) {
+            for(i = 0; i < j; i++) {
+                lv_area_t com;
+                if(_lv_area_intersect(&com, &areas[i], &areas[j]) == false) continue;
+
+                lv_area_t parts[4];
+                uint32_t part_cnt = _lv_area_diff(parts, &areas[j], &areas[i]);
+
+                /*The area is covered by the other one so it's refreshed anyway. Check the area moved to its place.*/
+                if(part_cnt == 0) {
+                    areas[j] = areas[inv_p - 1];
+                    inv_p--;
+                    j--;
+                    break;
+                }
+
+                if(lv_area_get_size(&com) <= (part_cnt - 1) * LV_INV_AREA_COST) continue;
+                if(inv_p + part_cnt - 1 > LV_INV_BUF_SIZE) continue;
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
+                /*The parts are not on the areas before `i` either so continue with the next area*/
+                areas[j] = parts[0];
+                uint32_t k;
+                for(k = 1; k < part_cnt; k++) {
+                    areas[inv_p] = parts[k];
+                    inv_p++;
+                }
             }
+        }
+    }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+    /*Refresh from top to bottom*/
+    for(i = 1; i < inv_p; i++) {
+        lv_area_t a = areas[i];
+        j = i;
+        while(j > 0 && (areas[j - 1].y1 > a.y1 || (areas[j - 1].y1 == a.y1 && areas[j - 1].x1 > a.x1))) {
+            areas[j] = areas[j - 1];
+            j--;
+        }
+        areas[j] = a;
+    }
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+    lv_memset_00(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    disp_refr->inv_p = inv_p;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+/**
+ * Save a new invalid area if the buffer is full. Join the pair of areas (the new area included)
+ * which results in the least extra pixels.
+ * @param disp pointer to a display with full invalid area buffer
+ * @param area_p the new invalid area
+ */
+static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    lv_area_t * areas = disp->inv_areas;
+    uint32_t n = disp->inv_p;
+    uint32_t best_i = 0;
+    uint32_t best_j = n;
+    uint32_t best_cost = UINT32_MAX;
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < n; i++) {
+        for(j = i + 1; j <= n; j++) {
+            uint32_t cost = inv_area_join_cost(&areas[i], j < n ? &areas[j] : area_p);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_i = i;
+                best_j = j;
             }
         }
     }
+
+    if(best_j < n) {
+        _lv_area_join(&areas[best_i], &areas[best_i], &areas[best_j]);
+        areas[best_j] = *area_p;
+        disp->inv_area_joined[best_j] = 0;
+    }
+    else {
+        _lv_area_join(&areas[best_i], &areas[best_i], area_p);
+    }
+}
+
+/**
+ * Get how many pixels would be refreshed needlessly if two areas were joined
+ * @param a1_p pointer to an area
+ * @param a2_p pointer to an other area
+ * @return number of pixels in the joined area which are on neither areas
+ */
+static uint32_t inv_area_join_cost(const lv_area_t * a1_p, const lv_area_t * a2_p)
+{
+    lv_area_t joined;
+    _lv_area_join(&joined, a1_p, a2_p);
+    uint32_t union_size = lv_area_get_size(a1_p) + lv_area_get_size(a2_p);
+
+    lv_area_t com;
+    if(_lv_area_intersect(&com, a1_p, a2_p)) union_size -= lv_area_get_size(&com);
+
+    return lv_area_get_size(&joined) - union_size;
 }
 
 /**
@@ -587,10 +886,10 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
         lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
         if(info.res == LV_COVER_RES_MASKED) return NULL;
 
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = obj->spec_attr->children[i];
+        _lv_obj_child_iter_t iter;
+        _lv_obj_child_iter_init(&iter, obj, area_p, false);
+        lv_obj_t * child;
+        while((child = _lv_obj_child_iter_next(&iter)) != NULL) {
             found_p = lv_refr_get_top_obj(area_p, child);
 
             /*If a children is ok then break*/
@@ -635,10 +934,10 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
     /*Do until not reach the screen*/
     while(par != NULL) {
         bool go = false;
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(par);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = par->spec_attr->children[i];
+        _lv_obj_child_iter_t iter;
+        _lv_obj_child_iter_init(&iter, par, mask_p, false);
+        lv_obj_t * child;
+        while((child = _lv_obj_child_iter_next(&iter)) != NULL) {
             if(!go) {
                 if(child == border_p) go = true;
             } else {
@@ -686,6 +985,11 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
     /*Draw the parent and its children only if they ore on 'mask_parent'*/
     if(union_ok != false) {
+#if LV_USE_SNAPSHOT
+        /*Draw the layers from their cache*/
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_LAYER) && _lv_snapshot_layer_draw(obj, &obj_ext_mask) == LV_RES_OK) return;
+#endif
+
         /*Redraw the object*/
         lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, &obj_ext_mask);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN, &obj_ext_mask);
@@ -708,10 +1012,10 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
         if(union_ok != false) {
             lv_area_t mask_child; /*Mask from obj and its child*/
             lv_area_t child_area;
-            uint32_t i;
-            uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-            for(i = 0; i < child_cnt; i++) {
-                lv_obj_t * child = obj->spec_attr->children[i];
+            _lv_obj_child_iter_t iter;
+            _lv_obj_child_iter_init(&iter, obj, &obj_mask, false);
+            lv_obj_t * child;
+            while((child = _lv_obj_child_iter_next(&iter)) != NULL) {
                 lv_obj_get_coords(child, &child_area);
                 ext_size = _lv_obj_get_ext_draw_size(child);
                 child_area.x1 -= ext_size;
@@ -64,6 +64,28 @@ void lv_refr_now(lv_disp_t * disp);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+/**
+ * Invalidate an area whose content was moved by `dx`, `dy`, e.g. by scrolling.
+ * If the display driver has `copy_cb` the already flushed pixels are moved and only the uncovered parts are redrawn.
+ * @param disp pointer to display (NULL to use the default display)
+ * @param area_p the area whose content moved
+ * @param dx horizontal movement
+ * @param dy vertical movement
+ */
+void _lv_inv_area_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dx, lv_coord_t dy);
+
+/**
+ * Start a batch of invalidations. Until `_lv_inv_batch_end()` the consecutive invalid areas are joined
+ * if it's cheaper to refresh them together. Useful when many objects are changed at once, e.g. by the animations.
+ * The batches can be nested.
+ */
+void _lv_inv_batch_start(void);
+
+/**
+ * Finish a batch of invalidations and save the collected areas
+ */
+void _lv_inv_batch_end(void);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -9,6 +9,7 @@
 #include "lv_draw_arc.h"
 #include "lv_draw_rect.h"
 #include "lv_draw_mask.h"
+#include "lv_draw_triangle.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_mem.h"
@@ -18,6 +19,7 @@
  *********************/
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+#define ARC_ANGLE_SHIFT 8   /*The vertices of the arcs are calculated with 1/256 degree precision*/
 
 /**********************
  *      TYPEDEFS
@@ -40,6 +42,12 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 #if LV_DRAW_COMPLEX
+static void draw_arc_img(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uint16_t start_angle,
+                         uint16_t end_angle, const lv_area_t * clip_area, const lv_draw_arc_dsc_t * dsc);
+static uint32_t get_seg_cnt(lv_coord_t radius, int32_t span);
+static lv_draw_poly_point_t * add_arc_points(lv_draw_poly_point_t * p, int32_t cx, int32_t cy, int32_t r,
+                                             int32_t a_start, int32_t a_span, uint32_t seg_cnt, bool closing);
+static int32_t get_sin(int32_t a);
 static void draw_quarter_0(quarter_draw_dsc_t * q);
 static void draw_quarter_1(quarter_draw_dsc_t * q);
 static void draw_quarter_2(quarter_draw_dsc_t * q);
@@ -75,20 +83,221 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
     if(dsc->width == 0) return;
     if(start_angle == end_angle) return;
 
+    if(dsc->img_src) {
+        draw_arc_img(center_x, center_y, radius, start_angle, end_angle, clip_area, dsc);
+        return;
+    }
+
     lv_coord_t width = dsc->width;
     if(width > radius) width = radius;
 
+    lv_area_t arc_area;
+    arc_area.x1 = center_x - radius;
+    arc_area.y1 = center_y - radius;
+    arc_area.x2 = center_x + radius - 1;
+    arc_area.y2 = center_y + radius - 1;
+    if(!_lv_area_is_on(&arc_area, clip_area)) return;
+
+    bool full = start_angle + 360 == end_angle || start_angle == end_angle + 360;
+
+    while(start_angle >= 360) start_angle -= 360;
+    while(end_angle >= 360) end_angle -= 360;
+
+    int32_t span = end_angle - start_angle;
+    if(span <= 0) span += 360;
+    if(full) span = 360;
+
+    /*The arc is drawn as a polygon. Sub-pixel vertices on the radii keep the edges smooth
+     *and only the pixels of the arc are touched.*/
+    int32_t cx = (int32_t)center_x << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t cy = (int32_t)center_y << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t r_out = (int32_t)radius << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t r_in = (int32_t)(radius - width) << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t r_cap = (int32_t)width << (LV_DRAW_POLY_SUBPX_SHIFT - 1);
+    int32_t a_start = start_angle << ARC_ANGLE_SHIFT;
+    int32_t a_span = span << ARC_ANGLE_SHIFT;
+
+    uint32_t seg_out = get_seg_cnt(radius, span);
+    uint32_t seg_in = r_in > 0 ? get_seg_cnt(radius - width, span) : 0;
+    uint32_t seg_cap = dsc->rounded && !full ? get_seg_cnt((width + 1) / 2, 360) : 0;
+    uint32_t point_cnt = seg_out + seg_in + 2 + 2 * seg_cap;
+
+    lv_draw_poly_point_t * points = lv_mem_buf_get(point_cnt * sizeof(lv_draw_poly_point_t));
+    if(points == NULL) return;
+
+    uint16_t contour_pcnt[3];
+    uint16_t contour_cnt = 0;
+    lv_draw_poly_point_t * p = points;
+    if(full) {
+        /*Outer circle and the inner circle in the opposite direction to make a hole*/
+        p = add_arc_points(p, cx, cy, r_out, 0, a_span, seg_out, false);
+        contour_pcnt[contour_cnt++] = seg_out;
+        if(seg_in) {
+            p = add_arc_points(p, cx, cy, r_in, a_span, -a_span, seg_in, false);
+            contour_pcnt[contour_cnt++] = seg_in;
+        }
+    }
+    else {
+        /*Outer arc forward and inner arc backward, or to the center for pies*/
+        p = add_arc_points(p, cx, cy, r_out, a_start, a_span, seg_out, true);
+        if(seg_in) {
+            p = add_arc_points(p, cx, cy, r_in, a_start + a_span, -a_span, seg_in, true);
+        }
+        else {
+            p->x = cx;
+            p->y = cy;
+            p++;
+        }
+        contour_pcnt[contour_cnt++] = p - points;
+
+        /*The caps are circles with the same direction as the arc so they are filled only once where they overlap*/
+        if(seg_cap) {
+            int32_t r_mid = r_out - r_cap;
+            int32_t a_ends[2] = {a_start, a_start + a_span};
+            uint32_t i;
+            for(i = 0; i < 2; i++) {
+                int32_t x = cx + (int32_t)(((int64_t)r_mid * get_sin(a_ends[i] + (90 << ARC_ANGLE_SHIFT))) >> LV_TRIGO_SHIFT);
+                int32_t y = cy + (int32_t)(((int64_t)r_mid * get_sin(a_ends[i])) >> LV_TRIGO_SHIFT);
+                p = add_arc_points(p, x, y, r_cap, 0, 360 << ARC_ANGLE_SHIFT, seg_cap, false);
+            }
+            contour_pcnt[contour_cnt++] = seg_cap;
+            contour_pcnt[contour_cnt++] = seg_cap;
+        }
+    }
+
     lv_draw_rect_dsc_t cir_dsc;
     lv_draw_rect_dsc_init(&cir_dsc);
     cir_dsc.blend_mode = dsc->blend_mode;
-    if(dsc->img_src) {
-        cir_dsc.bg_opa = LV_OPA_TRANSP;
-        cir_dsc.bg_img_src = dsc->img_src;
-        cir_dsc.bg_img_opa = dsc->opa;
-    } else {
-        cir_dsc.bg_opa = dsc->opa;
-        cir_dsc.bg_color = dsc->color;
+    cir_dsc.bg_opa = dsc->opa;
+    cir_dsc.bg_color = dsc->color;
+    _lv_draw_polygon_subpx(points, contour_pcnt, contour_cnt, clip_area, &cir_dsc);
+
+    lv_mem_buf_release(points);
+#else
+    LV_LOG_WARN("Can't draw arc with LV_DRAW_COMPLEX == 0");
+    LV_UNUSED(center_x);
+    LV_UNUSED(center_y);
+    LV_UNUSED(radius);
+    LV_UNUSED(start_angle);
+    LV_UNUSED(end_angle);
+    LV_UNUSED(clip_area);
+    LV_UNUSED(dsc);
+#endif /*LV_DRAW_COMPLEX*/
+}
+
+void lv_draw_arc_get_area(lv_coord_t x, lv_coord_t y, uint16_t radius,  uint16_t start_angle, uint16_t end_angle, lv_coord_t w, bool rounded, lv_area_t * area)
+{
+    lv_coord_t rout = radius;
+
+    /*Special case: full arc invalidation */
+    if(end_angle == start_angle + 360) {
+        area->x1 = x - rout;
+        area->y1 = y - rout;
+        area->x2 = x + rout;
+        area->y2 = y + rout;
+        return;
+    }
+
+    if(start_angle > 360) start_angle -= 360;
+    if(end_angle > 360) end_angle -= 360;
+
+    lv_coord_t rin = radius - w;
+    lv_coord_t extra_area = rounded ? w / 2 + 1 : 0;
+    uint8_t start_quarter = start_angle / 90;
+    uint8_t end_quarter = end_angle / 90;
+
+    /*360 deg still counts as quarter 3 (360 / 90 would be 4)*/
+    if(start_quarter == 4) start_quarter = 3;
+    if(end_quarter == 4) end_quarter = 3;
+
+    if(start_quarter == end_quarter && start_angle <= end_angle) {
+        if(start_quarter == 0) {
+            area->y1 = y + ((lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) - extra_area;
+            area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+
+            area->y2 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+            area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rin) >> LV_TRIGO_SHIFT) - extra_area;
+        }
+        else if(start_quarter == 1) {
+            area->y2 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+            area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rin) >> LV_TRIGO_SHIFT) + extra_area;
+
+            area->y1 = y + ((lv_trigo_sin(end_angle) * rin) >> LV_TRIGO_SHIFT) - extra_area;
+            area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+        }
+        else if(start_quarter == 2) {
+            area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+            area->y2 = y + ((lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
+
+            area->y1 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+            area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rin) >> LV_TRIGO_SHIFT) + extra_area;
+        }
+        else if(start_quarter == 3) {
+            area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rin) >> LV_TRIGO_SHIFT) - extra_area;
+            area->y1 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+
+            area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+            area->y2 = y + ((lv_trigo_sin(end_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
+        }
+    }
+    else if(start_quarter == 0 && end_quarter == 1) {
+        area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+        area->y1 = y + ((LV_MIN(lv_trigo_sin(end_angle),
+                                        lv_trigo_sin(start_angle))  * rin) >> LV_TRIGO_SHIFT) - extra_area;
+        area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+        area->y2 = y + rout + extra_area;
+    }
+    else if(start_quarter == 1 && end_quarter == 2) {
+        area->x1 = x - rout - extra_area;
+        area->y1 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+        area->x2 = x + ((LV_MAX(lv_trigo_sin(start_angle + 90),
+                                        lv_trigo_sin(end_angle + 90)) * rin) >> LV_TRIGO_SHIFT) + extra_area;
+        area->y2 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+    }
+    else if(start_quarter == 2 && end_quarter == 3) {
+        area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+        area->y1 = y - rout - extra_area;
+        area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+        area->y2 = y + (LV_MAX(lv_trigo_sin(end_angle) * rin,
+                                       lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
     }
+    else if(start_quarter == 3 && end_quarter == 0) {
+        area->x1 = x + ((LV_MIN(lv_trigo_sin(end_angle + 90),
+                                        lv_trigo_sin(start_angle + 90)) * rin) >> LV_TRIGO_SHIFT) - extra_area;
+        area->y1 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
+        area->x2 = x + rout + extra_area;
+        area->y2 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+
+    }
+    else {
+        area->x1 = x - rout;
+        area->y1 = y - rout;
+        area->x2 = x + rout;
+        area->y2 = y + rout;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_COMPLEX
+/**
+ * Draw an arc filled with an image. The image is drawn as the background image of a rectangle
+ * masked by the ring and the angle.
+ */
+static void draw_arc_img(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uint16_t start_angle,
+                         uint16_t end_angle, const lv_area_t * clip_area, const lv_draw_arc_dsc_t * dsc)
+{
+    lv_coord_t width = dsc->width;
+    if(width > radius) width = radius;
+
+    lv_draw_rect_dsc_t cir_dsc;
+    lv_draw_rect_dsc_init(&cir_dsc);
+    cir_dsc.blend_mode = dsc->blend_mode;
+    cir_dsc.bg_opa = LV_OPA_TRANSP;
+    cir_dsc.bg_img_src = dsc->img_src;
+    cir_dsc.bg_img_opa = dsc->opa;
 
     lv_area_t area_out;
     area_out.x1 = center_x - radius;
@@ -205,115 +414,66 @@ void lv_draw_arc(lv_coord_t center_x, lv_coord_t center_y, uint16_t radius,  uin
             lv_draw_mask_free_param(&mask_end_param);
         }
     }
-#else
-    LV_LOG_WARN("Can't draw arc with LV_DRAW_COMPLEX == 0");
-    LV_UNUSED(center_x);
-    LV_UNUSED(center_y);
-    LV_UNUSED(radius);
-    LV_UNUSED(start_angle);
-    LV_UNUSED(end_angle);
-    LV_UNUSED(clip_area);
-    LV_UNUSED(dsc);
-#endif /*LV_DRAW_COMPLEX*/
 }
 
-void lv_draw_arc_get_area(lv_coord_t x, lv_coord_t y, uint16_t radius,  uint16_t start_angle, uint16_t end_angle, lv_coord_t w, bool rounded, lv_area_t * area)
+/**
+ * Get the number of segments to approximate an arc.
+ * The segments are short enough to keep the distance of their middle from the arc below 1/16 px.
+ * @param radius radius of the arc
+ * @param span angle of the arc in degrees
+ * @return number of segments
+ */
+static uint32_t get_seg_cnt(lv_coord_t radius, int32_t span)
 {
-    lv_coord_t rout = radius;
-
-    /*Special case: full arc invalidation */
-    if(end_angle == start_angle + 360) {
-        area->x1 = x - rout;
-        area->y1 = y - rout;
-        area->x2 = x + rout;
-        area->y2 = y + rout;
-        return;
-    }
-
-    if(start_angle > 360) start_angle -= 360;
-    if(end_angle > 360) end_angle -= 360;
-
-    lv_coord_t rin = radius - w;
-    lv_coord_t extra_area = rounded ? w / 2 + 1 : 0;
-    uint8_t start_quarter = start_angle / 90;
-    uint8_t end_quarter = end_angle / 90;
-
-    /*360 deg still counts as quarter 3 (360 / 90 would be 4)*/
-    if(start_quarter == 4) start_quarter = 3;
-    if(end_quarter == 4) end_quarter = 3;
-
-    if(start_quarter == end_quarter && start_angle <= end_angle) {
-        if(start_quarter == 0) {
-            area->y1 = y + ((lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) - extra_area;
-            area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-
-            area->y2 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-            area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rin) >> LV_TRIGO_SHIFT) - extra_area;
-        }
-        else if(start_quarter == 1) {
-            area->y2 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-            area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-
-            area->y1 = y + ((lv_trigo_sin(end_angle) * rin) >> LV_TRIGO_SHIFT) - extra_area;
-            area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-        }
-        else if(start_quarter == 2) {
-            area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-            area->y2 = y + ((lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-
-            area->y1 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-            area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-        }
-        else if(start_quarter == 3) {
-            area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rin) >> LV_TRIGO_SHIFT) - extra_area;
-            area->y1 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-
-            area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-            area->y2 = y + ((lv_trigo_sin(end_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-        }
-    }
-    else if(start_quarter == 0 && end_quarter == 1) {
-        area->x1 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-        area->y1 = y + ((LV_MIN(lv_trigo_sin(end_angle),
-                                        lv_trigo_sin(start_angle))  * rin) >> LV_TRIGO_SHIFT) - extra_area;
-        area->x2 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-        area->y2 = y + rout + extra_area;
-    }
-    else if(start_quarter == 1 && end_quarter == 2) {
-        area->x1 = x - rout - extra_area;
-        area->y1 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-        area->x2 = x + ((LV_MAX(lv_trigo_sin(start_angle + 90),
-                                        lv_trigo_sin(end_angle + 90)) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-        area->y2 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-    }
-    else if(start_quarter == 2 && end_quarter == 3) {
-        area->x1 = x + ((lv_trigo_sin(start_angle + 90) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-        area->y1 = y - rout - extra_area;
-        area->x2 = x + ((lv_trigo_sin(end_angle + 90) * rout) >> LV_TRIGO_SHIFT) + extra_area;
-        area->y2 = y + (LV_MAX(lv_trigo_sin(end_angle) * rin,
-                                       lv_trigo_sin(start_angle) * rin) >> LV_TRIGO_SHIFT) + extra_area;
-    }
-    else if(start_quarter == 3 && end_quarter == 0) {
-        area->x1 = x + ((LV_MIN(lv_trigo_sin(end_angle + 90),
-                                        lv_trigo_sin(start_angle + 90)) * rin) >> LV_TRIGO_SHIFT) - extra_area;
-        area->y1 = y + ((lv_trigo_sin(start_angle) * rout) >> LV_TRIGO_SHIFT) - extra_area;
-        area->x2 = x + rout + extra_area;
-        area->y2 = y + ((lv_trigo_sin(end_angle) * rout) >> LV_TRIGO_SHIFT) + extra_area;
+    /*The distance is l^2 / (8 * r) for a chord of length l, so the chords can be sqrt(r / 2) long
+     *which is 1 / sqrt(2 * r) radian or ~57.3 / sqrt(2 * r) degree*/
+    lv_sqrt_res_t res;
+    lv_sqrt(2 * (uint32_t)radius, &res, 0x800);
+    int32_t sqrt_8 = (res.i << 8) + res.f;
+    int32_t cnt = (span * sqrt_8 + 57 * 256 - 1) / (57 * 256);
+    return LV_MAX(cnt, 4);
+}
 
+/**
+ * Add the points of an arc
+ * @param p add the points from here
+ * @param cx X coordinate of the center in sub-pixels
+ * @param cy Y coordinate of the center in sub-pixels
+ * @param r radius in sub-pixels
+ * @param a_start start angle in 1/256 degrees
+ * @param a_span span of the arc in 1/256 degrees, negative to go counter-clockwise
+ * @param seg_cnt number of segments
+ * @param closing true: add the end point too; false: the last segment goes back to the first point (full circle)
+ * @return pointer after the last added point
+ */
+static lv_draw_poly_point_t * add_arc_points(lv_draw_poly_point_t * p, int32_t cx, int32_t cy, int32_t r,
+                                             int32_t a_start, int32_t a_span, uint32_t seg_cnt, bool closing)
+{
+    uint32_t cnt = closing ? seg_cnt + 1 : seg_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        int32_t a = a_start + (int32_t)(((int64_t)a_span * i) / (int32_t)seg_cnt);
+        p->x = cx + (int32_t)(((int64_t)r * get_sin(a + (90 << ARC_ANGLE_SHIFT))) >> LV_TRIGO_SHIFT);
+        p->y = cy + (int32_t)(((int64_t)r * get_sin(a)) >> LV_TRIGO_SHIFT);
+        p++;
     }
-    else {
-        area->x1 = x - rout;
-        area->y1 = y - rout;
-        area->x2 = x + rout;
-        area->y2 = y + rout;
-    }
+    return p;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Get the sine of an angle with sub-degree precision by interpolating `lv_trigo_sin`
+ * @param a angle in 1/256 degrees
+ * @return sine of the angle (-32767..32767)
+ */
+static int32_t get_sin(int32_t a)
+{
+    int32_t a_int = a >> ARC_ANGLE_SHIFT;
+    int32_t a_fract = a & ((1 << ARC_ANGLE_SHIFT) - 1);
+    int32_t s1 = lv_trigo_sin(a_int % 360);
+    int32_t s2 = lv_trigo_sin((a_int + 1) % 360);
+    return s1 + (((s2 - s1) * a_fract) >> ARC_ANGLE_SHIFT);
+}
 
-#if LV_DRAW_COMPLEX
 static void draw_quarter_0(quarter_draw_dsc_t * q)
 {
     lv_area_t quarter_area;
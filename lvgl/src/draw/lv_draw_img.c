@@ -525,27 +525,22 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                 int32_t rot_x = disp_area->x1 + draw_area.x1 - map_area->x1;
 #endif
 
-                for(x = 0; x < draw_area_w; x++, map_px += px_size_byte, px_i++) {
-
 #if LV_DRAW_COMPLEX
-                    if(transform) {
-
-                        /*Transform*/
-                        bool ret;
-                        ret = _lv_img_buf_transform(&trans_dsc, rot_x + x, rot_y + y);
-                        if(ret == false) {
-                            mask_buf[px_i] = LV_OPA_TRANSP;
-                            continue;
-                        }
-                        else {
-                            mask_buf[px_i] = trans_dsc.res.opa;
-                            c.full = trans_dsc.res.color.full;
+                /*Transform the whole line at once*/
+                if(transform) {
+                    _lv_img_buf_transform_line(&trans_dsc, rot_x, rot_y + y, draw_area_w, &map2[px_i], &mask_buf[px_i]);
+                    if(draw_dsc->recolor_opa != 0) {
+                        for(x = 0; x < draw_area_w; x++) {
+                            map2[px_i + x] = lv_color_mix_premult(recolor_premult, map2[px_i + x], recolor_opa_inv);
                         }
                     }
-                    /*No transform*/
-                    else
+                    px_i += draw_area_w;
+                }
+                /*No transform*/
+                else
 #endif
-                    {
+                {
+                    for(x = 0; x < draw_area_w; x++, map_px += px_size_byte, px_i++) {
                         if(alpha_byte) {
                             lv_opa_t px_opa = map_px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
                             mask_buf[px_i] = px_opa;
@@ -580,12 +575,12 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
                             }
                         }
 
-                    }
-                    if(draw_dsc->recolor_opa != 0) {
-                        c = lv_color_mix_premult(recolor_premult, c, recolor_opa_inv);
-                    }
+                        if(draw_dsc->recolor_opa != 0) {
+                            c = lv_color_mix_premult(recolor_premult, c, recolor_opa_inv);
+                        }
 
-                    map2[px_i].full = c.full;
+                        map2[px_i].full = c.full;
+                    }
                 }
 #if LV_DRAW_COMPLEX
                 /*Apply the masks if any*/
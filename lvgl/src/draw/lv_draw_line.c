@@ -9,16 +9,36 @@
 #include <stdbool.h>
 #include "lv_draw_mask.h"
 #include "lv_draw_blend.h"
+#include "lv_draw_triangle.h"
 #include "../core/lv_refr.h"
 #include "../misc/lv_math.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define POLYLINE_OUTLINE_PCNT_MAX   256     /*Rasterize at most this many outline points together*/
+#define POLYLINE_CHUNK_SEG_MAX      64      /*Draw at most this many segments together*/
+#define POLYLINE_MITER_LIMIT        2       /*Bevel the joins whose miter would be longer than this times the half width*/
+#define POLYLINE_CIRCLE_PCNT_MAX    60
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_COMPLEX
+typedef struct {
+    lv_draw_poly_point_t * points;  /*Points of the outline*/
+    uint32_t point_cnt;
+    lv_draw_poly_point_t * pts;     /*Points of the current chunk of the line*/
+    lv_draw_poly_point_t * normals; /*Normal vectors of the segments of the chunk*/
+    uint32_t arc_pcnt;              /*Max number of points of a half circle*/
+    int32_t ofs;                    /*Offset of the points in sub-pixel units*/
+    int32_t r;                      /*Half width of the line in sub-pixel units*/
+    lv_coord_t ext;                 /*The line can be this far from its points*/
+    int16_t arc_step;               /*Angle between the points of the round parts in degrees*/
+    uint8_t round_join : 1;
+    lv_draw_rect_dsc_t rect_dsc;
+} polyline_outline_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -35,6 +55,18 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(const lv_point_t * point1, const
                                                 const lv_area_t * clip,
                                                 const lv_draw_line_dsc_t * dsc);
 
+#if LV_DRAW_COMPLEX
+static void polyline_draw(polyline_outline_t * outline, const lv_point_t points[], uint32_t point_cnt,
+                          const lv_area_t * clip, bool round_start, bool round_end, bool stripes);
+static void polyline_add_point(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                               const lv_draw_poly_point_t * n);
+static void polyline_add_join(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                              const lv_draw_poly_point_t * n_in, const lv_draw_poly_point_t * n_out);
+static void polyline_add_arc(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                             const lv_draw_poly_point_t * n_from, const lv_draw_poly_point_t * n_to);
+static bool polyline_get_normal(const lv_point_t * p1, const lv_point_t * p2, int32_t r, lv_draw_poly_point_t * n);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -113,6 +145,83 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_poin
     }
 }
 
+/**
+ * Draw lines through the points in one pass.
+ * Unlike drawing the segments one by one with `lv_draw_line` the overlapping parts are blended only once
+ * and the segments are connected with joins: round joins if `round_end` is set, else miter joins.
+ * Dashed lines are drawn segment by segment with `lv_draw_line`.
+ * @param points array of points
+ * @param point_cnt number of points
+ * @param clip the line will be drawn only in this area
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable
+ */
+void lv_draw_polyline(const lv_point_t points[], uint16_t point_cnt, const lv_area_t * clip,
+                      const lv_draw_line_dsc_t * dsc)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(point_cnt < 2) return;
+
+    bool dashed = dsc->dash_gap && dsc->dash_width ? true : false;
+
+#if LV_DRAW_COMPLEX
+    if(!dashed) {
+        polyline_outline_t outline;
+        /*The points of the line are on the center of the pixels if the width is odd, else on the corner
+         *to keep the horizontal and vertical lines sharp*/
+        outline.ofs = (dsc->width & 1) ? (1 << (LV_DRAW_POLY_SUBPX_SHIFT - 1)) : 0;
+        outline.r = dsc->width << (LV_DRAW_POLY_SUBPX_SHIFT - 1);
+        /*The miters can be longer than the half width*/
+        outline.ext = (dsc->round_end ? dsc->width : dsc->width * POLYLINE_MITER_LIMIT) / 2 + 1;
+        outline.round_join = dsc->round_end;
+
+        /*Keep the chord error of the round parts around 1/16 px*/
+        lv_sqrt_res_t res;
+        lv_sqrt(dsc->width, &res, 0x800);
+        uint32_t circle_pcnt = (((res.i << 8) + res.f) * 7) >> 8;
+        circle_pcnt = LV_CLAMP(8, circle_pcnt, POLYLINE_CIRCLE_PCNT_MAX);
+        outline.arc_step = 360 / circle_pcnt;
+
+        outline.arc_pcnt = (dsc->round_start || dsc->round_end) ? 180 / outline.arc_step : 1;
+
+        outline.pts = lv_mem_buf_get((POLYLINE_CHUNK_SEG_MAX + 1) * sizeof(lv_draw_poly_point_t));
+        outline.normals = lv_mem_buf_get(POLYLINE_CHUNK_SEG_MAX * sizeof(lv_draw_poly_point_t));
+        outline.points = lv_mem_buf_get(POLYLINE_OUTLINE_PCNT_MAX * sizeof(lv_draw_poly_point_t));
+
+        lv_draw_rect_dsc_init(&outline.rect_dsc);
+        outline.rect_dsc.bg_color = dsc->color;
+        outline.rect_dsc.bg_opa = dsc->opa;
+        outline.rect_dsc.blend_mode = dsc->blend_mode;
+
+        /*Lines going from left to right (e.g. on charts) can be drawn in stripes*/
+        bool x_inc = true;
+        uint32_t i;
+        for(i = 1; i < point_cnt && x_inc; i++) {
+            if(points[i].x < points[i - 1].x) x_inc = false;
+        }
+
+        polyline_draw(&outline, points, point_cnt, clip, dsc->round_start, dsc->round_end, x_inc);
+
+        lv_mem_buf_release(outline.points);
+        lv_mem_buf_release(outline.normals);
+        lv_mem_buf_release(outline.pts);
+        return;
+    }
+#else
+    LV_UNUSED(dashed);
+#endif /*LV_DRAW_COMPLEX*/
+
+    /*Draw the segments one by one with round endings on the inner points too to hide the gaps*/
+    lv_draw_line_dsc_t seg_dsc;
+    lv_memcpy_small(&seg_dsc, dsc, sizeof(lv_draw_line_dsc_t));
+    uint16_t i;
+    for(i = 0; i < point_cnt - 1; i++) {
+        seg_dsc.round_start = i == 0 ? dsc->round_start : 0;
+        seg_dsc.round_end = dsc->round_end;
+        lv_draw_line(&points[i], &points[i + 1], clip, &seg_dsc);
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -491,3 +600,251 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(const lv_point_t * point1, cons
 #endif /*LV_DRAW_COMPLEX*/
 }
 
+#if LV_DRAW_COMPLEX
+
+/**
+ * Draw a line in chunks. Every chunk is one closed outline: the left side forward, the end,
+ * the right side backward and the start. The non-zero winding rule fills the self overlapping parts
+ * only once.
+ * If the points go from left to right every chunk is drawn only in a vertical stripe and the chunks
+ * overlap with the segments close to the border of the stripes. This way there are no seams between the chunks
+ * and the translucent lines are blended only once. Else the chunks overlap by one segment.
+ * @param outline the prepared outline descriptor
+ * @param points array of points
+ * @param point_cnt number of points
+ * @param clip the line will be drawn only in this area
+ * @param round_start true: draw round ending on the first point
+ * @param round_end true: draw round ending on the last point
+ * @param stripes true: the X coordinates of the points are increasing, draw the chunks in stripes
+ */
+static void polyline_draw(polyline_outline_t * outline, const lv_point_t points[], uint32_t point_cnt,
+                          const lv_area_t * clip, bool round_start, bool round_end, bool stripes)
+{
+    lv_draw_poly_point_t * pts = outline->pts;
+    lv_draw_poly_point_t * normals = outline->normals;
+
+    /*A join needs the points of the two sides and a temporary place for the right side.
+     *The endings need the arcs and their first and last points.*/
+    uint32_t join_pcnt = outline->arc_pcnt + 2;
+    uint32_t reserved_pcnt = 3 * join_pcnt + 2 * outline->arc_pcnt + 4;
+
+    lv_area_t stripe = *clip;
+    uint32_t start = 0;
+    while(1) {
+        if(stripes) {
+            while(start + 2 < point_cnt && points[start + 1].x < stripe.x1 - outline->ext) start++;
+            if(points[start].x - outline->ext > clip->x2) break;
+        }
+
+        /*Collect the points of the chunk skipping the zero length segments and add the joins to the outline.
+         *The left side is added from the beginning of the buffer, the right side from the end.*/
+        const lv_point_t * prev = &points[start];
+        uint32_t prev_idx = start;
+        uint32_t last_seg_idx = start;
+        uint32_t seg_cnt = 0;
+        uint32_t right_idx = POLYLINE_OUTLINE_PCNT_MAX;
+        lv_area_t bbox;
+        bbox.x1 = prev->x;
+        bbox.y1 = prev->y;
+        bbox.x2 = prev->x;
+        bbox.y2 = prev->y;
+        pts[0].x = (prev->x << LV_DRAW_POLY_SUBPX_SHIFT) + outline->ofs;
+        pts[0].y = (prev->y << LV_DRAW_POLY_SUBPX_SHIFT) + outline->ofs;
+        outline->point_cnt = 0;
+
+        uint32_t i;
+        for(i = start + 1; i < point_cnt && seg_cnt < POLYLINE_CHUNK_SEG_MAX; i++) {
+            if(!polyline_get_normal(prev, &points[i], outline->r, &normals[seg_cnt])) continue;
+
+            if(seg_cnt == 0) {
+                polyline_add_point(outline, &pts[0], &normals[0]);
+            }
+            else {
+                if(right_idx - outline->point_cnt < reserved_pcnt) break;
+
+                polyline_add_join(outline, &pts[seg_cnt], &normals[seg_cnt - 1], &normals[seg_cnt]);
+
+                lv_draw_poly_point_t n_neg_in;
+                lv_draw_poly_point_t n_neg_out;
+                n_neg_in.x = -normals[seg_cnt].x;
+                n_neg_in.y = -normals[seg_cnt].y;
+                n_neg_out.x = -normals[seg_cnt - 1].x;
+                n_neg_out.y = -normals[seg_cnt - 1].y;
+                uint32_t left_pcnt = outline->point_cnt;
+                polyline_add_join(outline, &pts[seg_cnt], &n_neg_in, &n_neg_out);
+                uint32_t join_right_pcnt = outline->point_cnt - left_pcnt;
+                right_idx -= join_right_pcnt;
+                lv_memcpy(&outline->points[right_idx], &outline->points[left_pcnt],
+                          join_right_pcnt * sizeof(lv_draw_poly_point_t));
+                outline->point_cnt = left_pcnt;
+            }
+
+            seg_cnt++;
+            prev = &points[i];
+            pts[seg_cnt].x = (prev->x << LV_DRAW_POLY_SUBPX_SHIFT) + outline->ofs;
+            pts[seg_cnt].y = (prev->y << LV_DRAW_POLY_SUBPX_SHIFT) + outline->ofs;
+            bbox.x1 = LV_MIN(bbox.x1, prev->x);
+            bbox.y1 = LV_MIN(bbox.y1, prev->y);
+            bbox.x2 = LV_MAX(bbox.x2, prev->x);
+            bbox.y2 = LV_MAX(bbox.y2, prev->y);
+            last_seg_idx = prev_idx;
+            prev_idx = i;
+        }
+
+        while(i < point_cnt && points[i].x == prev->x && points[i].y == prev->y) i++;
+        bool last = i >= point_cnt;
+        if(seg_cnt == 0) break;
+
+        /*End*/
+        lv_draw_poly_point_t n_neg;
+        polyline_add_point(outline, &pts[seg_cnt], &normals[seg_cnt - 1]);
+        n_neg.x = -normals[seg_cnt - 1].x;
+        n_neg.y = -normals[seg_cnt - 1].y;
+        if(last && round_end) polyline_add_arc(outline, &pts[seg_cnt], &normals[seg_cnt - 1], &n_neg);
+        polyline_add_point(outline, &pts[seg_cnt], &n_neg);
+
+        /*Move the right side after the left side. It can overlap but moves backward so copy forward.*/
+        for(; right_idx < POLYLINE_OUTLINE_PCNT_MAX; right_idx++) {
+            outline->points[outline->point_cnt] = outline->points[right_idx];
+            outline->point_cnt++;
+        }
+
+        /*Start*/
+        n_neg.x = -normals[0].x;
+        n_neg.y = -normals[0].y;
+        polyline_add_point(outline, &pts[0], &n_neg);
+        if(start == 0 && round_start) polyline_add_arc(outline, &pts[0], &n_neg, &normals[0]);
+
+        lv_area_t chunk_clip = *clip;
+        if(stripes) {
+            chunk_clip.x1 = stripe.x1;
+            /*Leave the area where the next segments might be visible to the next chunk*/
+            if(!last) chunk_clip.x2 = LV_MIN(clip->x2, LV_MAX(stripe.x1, points[prev_idx].x - outline->ext - 1));
+        }
+
+        lv_area_increase(&bbox, outline->ext, outline->ext);
+        if(_lv_area_is_on(&bbox, &chunk_clip)) {
+            uint16_t outline_pcnt = outline->point_cnt;
+            _lv_draw_polygon_subpx(outline->points, &outline_pcnt, 1, &chunk_clip, &outline->rect_dsc);
+        }
+
+        if(last) break;
+
+        if(stripes) {
+            stripe.x1 = chunk_clip.x2 + 1;
+            if(stripe.x1 > clip->x2) break;
+        }
+        else {
+            start = last_seg_idx;
+        }
+    }
+}
+
+static void polyline_add_point(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                               const lv_draw_poly_point_t * n)
+{
+    lv_draw_poly_point_t * dest = &outline->points[outline->point_cnt];
+    dest->x = p->x + n->x;
+    dest->y = p->y + n->y;
+    outline->point_cnt++;
+}
+
+/**
+ * Add one side of the join between two segments to the outline.
+ * On the outer side the gap is filled with a miter, bevel or arc,
+ * on the inner side the outline goes through the common point to keep the winding positive.
+ * @param outline the outline to add the points to
+ * @param p the common point of the segments
+ * @param n_in normal vector of the incoming segment, pointing to this side
+ * @param n_out normal vector of the outgoing segment, pointing to this side
+ */
+static void polyline_add_join(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                              const lv_draw_poly_point_t * n_in, const lv_draw_poly_point_t * n_out)
+{
+    int64_t cross = (int64_t)n_in->x * n_out->y - (int64_t)n_in->y * n_out->x;
+    int64_t dot = (int64_t)n_in->x * n_out->x + (int64_t)n_in->y * n_out->y;
+    int64_t r = outline->r;
+
+    polyline_add_point(outline, p, n_in);
+
+    /*The miter or arc of a small turn would be closer than 1/16 px to the bevel*/
+    if(dot > 0 && cross * cross < 64 * r * r * r) {
+        polyline_add_point(outline, p, n_out);
+        return;
+    }
+
+    /*Inner side*/
+    if(cross > 0) {
+        lv_draw_poly_point_t * dest = &outline->points[outline->point_cnt];
+        *dest = *p;
+        outline->point_cnt++;
+    }
+    else if(outline->round_join) {
+        polyline_add_arc(outline, p, n_in, n_out);
+    }
+    else if(cross != 0) {
+        /*The miter point is on the bisector, r / cos(angle / 2) far from `p`*/
+        int64_t sx = (int64_t)n_in->x + n_out->x;
+        int64_t sy = (int64_t)n_in->y + n_out->y;
+        int64_t sum_len2 = sx * sx + sy * sy;
+        if(sum_len2 * POLYLINE_MITER_LIMIT * POLYLINE_MITER_LIMIT >= 4 * r * r) {
+            lv_draw_poly_point_t miter;
+            miter.x = (int32_t)((sx * 2 * r * r) / sum_len2);
+            miter.y = (int32_t)((sy * 2 * r * r) / sum_len2);
+            polyline_add_point(outline, p, &miter);
+        }
+    }
+
+    polyline_add_point(outline, p, n_out);
+}
+
+/**
+ * Add the inner points of an arc to the outline going clockwise from `n_from` to `n_to`
+ * (counter-clockwise with the y axis pointing down).
+ * @param outline the outline to add the points to
+ * @param p center of the arc
+ * @param n_from the vector from the center to the start of the arc
+ * @param n_to the vector from the center to the end of the arc. Should be less than 180 degrees or exactly 180 degrees far.
+ */
+static void polyline_add_arc(polyline_outline_t * outline, const lv_draw_poly_point_t * p,
+                             const lv_draw_poly_point_t * n_from, const lv_draw_poly_point_t * n_to)
+{
+    int32_t angle;
+    for(angle = outline->arc_step; angle < 180; angle += outline->arc_step) {
+        int32_t s = lv_trigo_sin(-angle);
+        int32_t c = lv_trigo_cos(-angle);
+        lv_draw_poly_point_t n;
+        n.x = (int32_t)(((int64_t)n_from->x * c - (int64_t)n_from->y * s) >> LV_TRIGO_SHIFT);
+        n.y = (int32_t)(((int64_t)n_from->x * s + (int64_t)n_from->y * c) >> LV_TRIGO_SHIFT);
+
+        /*Stop if `n_to` is already passed*/
+        if((int64_t)n.x * n_to->y - (int64_t)n.y * n_to->x >= 0) break;
+
+        polyline_add_point(outline, p, &n);
+    }
+}
+
+/**
+ * Get the normal vector of a segment
+ * @param p1 start point of the segment
+ * @param p2 end point of the segment
+ * @param r length of the normal vector in sub-pixel units
+ * @param n store the normal vector here
+ * @return false: the segment has zero length
+ */
+static bool polyline_get_normal(const lv_point_t * p1, const lv_point_t * p2, int32_t r, lv_draw_poly_point_t * n)
+{
+    int32_t dx = p2->x - p1->x;
+    int32_t dy = p2->y - p1->y;
+    if(dx == 0 && dy == 0) return false;
+
+    lv_sqrt_res_t res;
+    lv_sqrt((uint32_t)dx * dx + (uint32_t)dy * dy, &res, 0x8000);
+    int64_t len = (res.i << 8) + res.f;
+
+    n->x = (int32_t)(-(int64_t)dy * r * 256 / len);
+    n->y = (int32_t)((int64_t)dx * r * 256 / len);
+    return true;
+}
+
+#endif /*LV_DRAW_COMPLEX*/
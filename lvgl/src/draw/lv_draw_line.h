@@ -49,6 +49,17 @@ typedef struct {
 LV_ATTRIBUTE_FAST_MEM void lv_draw_line(const lv_point_t * point1, const lv_point_t * point2, const lv_area_t * clip,
                                         const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw lines through the points in one pass.
+ * The segments are connected with round joins if `round_end` is set, else with miter joins.
+ * @param points array of points
+ * @param point_cnt number of points
+ * @param clip the line will be drawn only in this area
+ * @param dsc pointer to an initialized `lv_draw_line_dsc_t` variable
+ */
+void lv_draw_polyline(const lv_point_t points[], uint16_t point_cnt, const lv_area_t * clip,
+                      const lv_draw_line_dsc_t * dsc);
+
 LV_ATTRIBUTE_FAST_MEM void lv_draw_line_dsc_init(lv_draw_line_dsc_t * dsc);
 
 //! @endcond
@@ -9,18 +9,71 @@
 #include "lv_draw_triangle.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_mem.h"
+#include "lv_draw_blend.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define POLY_SUBPX_ONE          (1 << LV_DRAW_POLY_SUBPX_SHIFT)
+#define POLY_X_EXTRA_SHIFT      8   /*The X coordinates of the edges have this many extra bits to avoid drifting*/
+#define POLY_COV_SHIFT          16  /*The coverage of a pixel is accumulated in 1/65536 units*/
+#define POLY_COV_ONE            (1 << POLY_COV_SHIFT)
+#define POLY_CONST_SPAN_MIN     16  /*Shorter parts with constant coverage are blended together with the anti-aliased pixels*/
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_COMPLEX
+typedef struct {
+    int32_t y_top;      /*Top of the not yet processed part in sub-pixels*/
+    int32_t y_bottom;   /*Bottom of the edge in sub-pixels*/
+    int64_t x;          /*X on `y_top` with POLY_X_EXTRA_SHIFT extra precision*/
+    int64_t x_bottom;   /*X on `y_bottom` with POLY_X_EXTRA_SHIFT extra precision*/
+    int64_t slope;      /*X change for 1 pixel of Y with POLY_X_EXTRA_SHIFT extra precision*/
+    int64_t dydx;       /*Signed Y change for 1 sub-pixel of X in POLY_COV_ONE << LV_DRAW_POLY_SUBPX_SHIFT units*/
+    int8_t dir;         /*1: downward edge, -1: upward edge*/
+} poly_edge_t;
+
+typedef struct {
+    const lv_draw_rect_dsc_t * dsc;
+    const lv_area_t * draw_area;
+    const lv_area_t * poly_area;
+    lv_color_t * grad_map;
+    lv_grad_dir_t grad_dir;
+    lv_opa_t opa;
+} poly_fill_t;
+
+typedef struct {
+    int32_t x1;
+    int32_t x2;
+} poly_span_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_COMPLEX
+static void draw_polygon_masked(const lv_point_t points[], uint16_t point_cnt, const lv_area_t * clip_area,
+                                const lv_draw_rect_dsc_t * draw_dsc);
+static uint32_t poly_edge_sort(poly_edge_t * edges, uint32_t edge_cnt, const lv_area_t * draw_area,
+                               poly_edge_t ** sorted);
+static inline void poly_cov_add(int32_t * cov_buf, int32_t w, int32_t i, int32_t v);
+LV_ATTRIBUTE_FAST_MEM static bool poly_accumulate(int32_t * cov_buf, int32_t w, int32_t xa, int32_t xb, int32_t d,
+                                                  int64_t dydx, poly_span_t * span);
+static void poly_active_sort(poly_edge_t ** active, uint32_t act_cnt);
+static void poly_active_insert(poly_edge_t ** active, uint32_t act_cnt, poly_edge_t * e);
+static void poly_span_sort(poly_span_t * spans, uint32_t span_cnt);
+static inline lv_opa_t poly_cov_to_opa(int32_t cov);
+static void poly_fill_init(poly_fill_t * fill, const lv_area_t * poly_area, const lv_area_t * draw_area,
+                           const lv_draw_rect_dsc_t * dsc);
+LV_ATTRIBUTE_FAST_MEM static void poly_fill_span(const poly_fill_t * fill, int32_t x1, int32_t x2, int32_t y,
+                                                 lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_opa_t opa);
+LV_ATTRIBUTE_FAST_MEM static int32_t poly_row_const(const poly_fill_t * fill, lv_opa_t * mask_buf, int32_t x_pend,
+                                                    int32_t x1, int32_t x2, int32_t y, lv_opa_t cov, bool mask_any);
+LV_ATTRIBUTE_FAST_MEM static void poly_row_flush(const poly_fill_t * fill, lv_opa_t * mask_buf, int32_t x1, int32_t x2,
+                                                 int32_t y, bool mask_any);
+static inline lv_color_t grad_get(const lv_draw_rect_dsc_t * dsc, lv_coord_t s, lv_coord_t i);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -53,7 +106,8 @@ void lv_draw_triangle(const lv_point_t points[], const lv_area_t * clip_area, co
 }
 
 /**
- * Draw a polygon. Only convex polygons are supported
+ * Draw a polygon. The background can be drawn for any polygon (even concave or self-intersecting ones)
+ * but the background image, border, outline and shadow are supported only for convex polygons.
  * @param points an array of points
  * @param point_cnt number of points
  * @param clip_area polygon will be drawn only in this area
@@ -66,6 +120,257 @@ void lv_draw_polygon(const lv_point_t points[], uint16_t point_cnt, const lv_are
     if(point_cnt < 3) return;
     if(points == NULL) return;
 
+    lv_draw_poly_point_t * p = lv_mem_buf_get(point_cnt * sizeof(lv_draw_poly_point_t));
+    if(p == NULL) return;
+    uint16_t i;
+    for(i = 0; i < point_cnt; i++) {
+        p[i].x = (int32_t)points[i].x << LV_DRAW_POLY_SUBPX_SHIFT;
+        p[i].y = (int32_t)points[i].y << LV_DRAW_POLY_SUBPX_SHIFT;
+    }
+
+    _lv_draw_polygon_subpx(p, &point_cnt, 1, clip_area, draw_dsc);
+    lv_mem_buf_release(p);
+
+    /*The other parts are drawn as a masked rectangle*/
+    bool other = false;
+    if(draw_dsc->bg_img_src && draw_dsc->bg_img_opa > LV_OPA_MIN) other = true;
+    if(draw_dsc->border_width && draw_dsc->border_opa > LV_OPA_MIN) other = true;
+    if(draw_dsc->outline_width && draw_dsc->outline_opa > LV_OPA_MIN) other = true;
+    if(draw_dsc->shadow_width && draw_dsc->shadow_opa > LV_OPA_MIN) other = true;
+    if(other) {
+        lv_draw_rect_dsc_t other_dsc;
+        lv_memcpy_small(&other_dsc, draw_dsc, sizeof(lv_draw_rect_dsc_t));
+        other_dsc.bg_opa = LV_OPA_TRANSP;
+        draw_polygon_masked(points, point_cnt, clip_area, &other_dsc);
+    }
+#else
+    LV_UNUSED(points);
+    LV_UNUSED(point_cnt);
+    LV_UNUSED(clip_area);
+    LV_UNUSED(draw_dsc);
+    LV_LOG_WARN("Can't draw polygon with LV_DRAW_COMPLEX == 0");
+#endif /*LV_DRAW_COMPLEX*/
+}
+
+/**
+ * Fill one or more closed contours with anti-aliased edges using the non-zero winding rule.
+ * Draws the shape scanline by scanline without adding masks, so it works with any number of points.
+ * @param points the points of all contours one after the other
+ * @param contour_pcnt number of points in each contour
+ * @param contour_cnt number of contours
+ * @param clip_area the shape will be drawn only in this area
+ * @param draw_dsc only the background color, gradient, opacity and the blend mode are used from it
+ */
+void _lv_draw_polygon_subpx(const lv_draw_poly_point_t points[], const uint16_t contour_pcnt[], uint16_t contour_cnt,
+                            const lv_area_t * clip_area, const lv_draw_rect_dsc_t * draw_dsc)
+{
+#if LV_DRAW_COMPLEX
+    if(draw_dsc->bg_opa <= LV_OPA_MIN) return;
+
+    uint32_t point_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < contour_cnt; i++) point_cnt += contour_pcnt[i];
+    if(point_cnt < 3) return;
+
+    /*Create the non-horizontal edges and get the bounding box*/
+    poly_edge_t * edges = lv_mem_buf_get(point_cnt * sizeof(poly_edge_t));
+    if(edges == NULL) return;
+
+    int32_t x_min = INT32_MAX;
+    int32_t y_min = INT32_MAX;
+    int32_t x_max = INT32_MIN;
+    int32_t y_max = INT32_MIN;
+    uint32_t edge_cnt = 0;
+    const lv_draw_poly_point_t * c = points;
+    for(i = 0; i < contour_cnt; i++) {
+        uint32_t j;
+        for(j = 0; j < contour_pcnt[i]; j++) {
+            const lv_draw_poly_point_t * p1 = &c[j];
+            const lv_draw_poly_point_t * p2 = &c[j + 1 < contour_pcnt[i] ? j + 1 : 0];
+            x_min = LV_MIN(x_min, p1->x);
+            y_min = LV_MIN(y_min, p1->y);
+            x_max = LV_MAX(x_max, p1->x);
+            y_max = LV_MAX(y_max, p1->y);
+            if(p1->y == p2->y) continue;
+
+            poly_edge_t * e = &edges[edge_cnt];
+            edge_cnt++;
+            if(p1->y < p2->y) {
+                e->dir = 1;
+            }
+            else {
+                e->dir = -1;
+                const lv_draw_poly_point_t * t = p1;
+                p1 = p2;
+                p2 = t;
+            }
+            e->y_top = p1->y;
+            e->y_bottom = p2->y;
+            e->x = (int64_t)p1->x << POLY_X_EXTRA_SHIFT;
+            e->x_bottom = (int64_t)p2->x << POLY_X_EXTRA_SHIFT;
+            e->slope = (((int64_t)p2->x - p1->x) << (POLY_X_EXTRA_SHIFT + LV_DRAW_POLY_SUBPX_SHIFT)) / (p2->y - p1->y);
+            e->dydx = p1->x == p2->x ? 0 : (((int64_t)p2->y - p1->y) << (POLY_COV_SHIFT + LV_DRAW_POLY_SUBPX_SHIFT)) /
+                      LV_ABS(p2->x - p1->x) * e->dir;
+        }
+        c += contour_pcnt[i];
+    }
+
+    lv_area_t poly_area;
+    poly_area.x1 = x_min >> LV_DRAW_POLY_SUBPX_SHIFT;
+    poly_area.y1 = y_min >> LV_DRAW_POLY_SUBPX_SHIFT;
+    poly_area.x2 = ((x_max + POLY_SUBPX_ONE - 1) >> LV_DRAW_POLY_SUBPX_SHIFT) - 1;
+    poly_area.y2 = ((y_max + POLY_SUBPX_ONE - 1) >> LV_DRAW_POLY_SUBPX_SHIFT) - 1;
+
+    lv_area_t draw_area;
+    if(edge_cnt < 2 || !_lv_area_intersect(&draw_area, &poly_area, clip_area)) {
+        lv_mem_buf_release(edges);
+        return;
+    }
+
+    poly_edge_t ** sorted = lv_mem_buf_get(edge_cnt * sizeof(poly_edge_t *));
+    edge_cnt = poly_edge_sort(edges, edge_cnt, &draw_area, sorted);
+    if(edge_cnt == 0) {
+        lv_mem_buf_release(sorted);
+        lv_mem_buf_release(edges);
+        return;
+    }
+
+    int32_t draw_area_w = lv_area_get_width(&draw_area);
+    int32_t * cov_buf = lv_mem_buf_get(draw_area_w * sizeof(int32_t));
+    lv_opa_t * mask_buf = lv_mem_buf_get(draw_area_w);
+    poly_edge_t ** active = lv_mem_buf_get(edge_cnt * sizeof(poly_edge_t *));
+    poly_span_t * spans = lv_mem_buf_get(edge_cnt * sizeof(poly_span_t));
+    lv_memset_00(cov_buf, draw_area_w * sizeof(int32_t));
+
+    poly_fill_t fill;
+    poly_fill_init(&fill, &poly_area, &draw_area, draw_dsc);
+
+    bool mask_any = lv_draw_mask_is_any(&draw_area);
+    int32_t ofs_x = (int32_t)draw_area.x1 << LV_DRAW_POLY_SUBPX_SHIFT;
+    uint32_t next_edge = 0;
+    uint32_t act_cnt = 0;
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        int32_t row_top = y << LV_DRAW_POLY_SUBPX_SHIFT;
+        int32_t row_bottom = row_top + POLY_SUBPX_ONE;
+
+        /*Jump to the next edge if there is nothing to draw until it*/
+        if(act_cnt == 0) {
+            if(next_edge == edge_cnt) break;
+            if(sorted[next_edge]->y_top >= row_bottom) {
+                y = LV_MAX(y, (sorted[next_edge]->y_top >> LV_DRAW_POLY_SUBPX_SHIFT) - 1);
+                continue;
+            }
+        }
+
+        /*Keep the active edges in X order so the touched ranges will be mostly sorted too.
+         *The edges rarely cross each other so fixing the order of the previous row is cheap.*/
+        poly_active_sort(active, act_cnt);
+
+        /*Activate the edges starting in this row*/
+        while(next_edge < edge_cnt && sorted[next_edge]->y_top < row_bottom) {
+            poly_edge_t * e = sorted[next_edge];
+            next_edge++;
+            if(e->y_bottom <= row_top) continue;
+            if(e->y_top < row_top) {
+                /*Starts above the draw area*/
+                e->x += (e->slope * (row_top - e->y_top)) >> LV_DRAW_POLY_SUBPX_SHIFT;
+                e->y_top = row_top;
+            }
+            poly_active_insert(active, act_cnt, e);
+            act_cnt++;
+        }
+
+        /*Accumulate the signed area of each edge's segment in this row and collect the touched pixels*/
+        uint32_t span_cnt = 0;
+        uint32_t act_keep = 0;
+        for(i = 0; i < act_cnt; i++) {
+            poly_edge_t * e = active[i];
+            bool last = e->y_bottom <= row_bottom;
+            int32_t yb = last ? e->y_bottom : row_bottom;
+            int64_t xb = last ? e->x_bottom : e->x + ((e->slope * (yb - e->y_top)) >> LV_DRAW_POLY_SUBPX_SHIFT);
+            if(poly_accumulate(cov_buf, draw_area_w, (int32_t)(e->x >> POLY_X_EXTRA_SHIFT) - ofs_x,
+                               (int32_t)(xb >> POLY_X_EXTRA_SHIFT) - ofs_x, (yb - e->y_top) * e->dir, e->dydx,
+                               &spans[span_cnt])) {
+                span_cnt++;
+            }
+
+            if(!last) {
+                e->x = xb;
+                e->y_top = yb;
+                active[act_keep] = e;
+                act_keep++;
+            }
+        }
+        act_cnt = act_keep;
+
+        if(span_cnt == 0) continue;
+        poly_span_sort(spans, span_cnt);
+
+        /*Only the touched pixels need to be summed up, between them the coverage is constant.
+         *The pixels are collected in `mask_buf` and blended at once, except the long constant parts.*/
+        int32_t acc = 0;
+        int32_t x = 0;
+        int32_t x_pend = -1;    /*Start of the not yet blended pixels in `mask_buf` or -1 if there is none*/
+        uint32_t s = 0;
+        while(s < span_cnt) {
+            int32_t x1 = spans[s].x1;
+            int32_t x2 = spans[s].x2;
+            for(s++; s < span_cnt && spans[s].x1 <= x2 + 1; s++) {
+                x2 = LV_MAX(x2, spans[s].x2);
+            }
+
+            if(x < x1) x_pend = poly_row_const(&fill, mask_buf, x_pend, x, x1 - 1, y, poly_cov_to_opa(acc), mask_any);
+            if(x_pend < 0) x_pend = x1;
+
+            for(x = x1; x <= x2; x++) {
+                acc += cov_buf[x];
+                cov_buf[x] = 0;
+                mask_buf[x] = poly_cov_to_opa(acc);
+            }
+        }
+
+        /*The area on the right of the last edge in the buffer can be still covered*/
+        lv_opa_t opa_rest = poly_cov_to_opa(acc);
+        if(opa_rest != LV_OPA_TRANSP) {
+            x_pend = poly_row_const(&fill, mask_buf, x_pend, x, draw_area_w - 1, y, opa_rest, mask_any);
+            x = draw_area_w;
+        }
+
+        if(x_pend >= 0) poly_row_flush(&fill, mask_buf, x_pend, x - 1, y, mask_any);
+    }
+
+    if(fill.grad_map) lv_mem_buf_release(fill.grad_map);
+    lv_mem_buf_release(spans);
+    lv_mem_buf_release(active);
+    lv_mem_buf_release(mask_buf);
+    lv_mem_buf_release(cov_buf);
+    lv_mem_buf_release(sorted);
+    lv_mem_buf_release(edges);
+#else
+    LV_UNUSED(points);
+    LV_UNUSED(contour_pcnt);
+    LV_UNUSED(contour_cnt);
+    LV_UNUSED(clip_area);
+    LV_UNUSED(draw_dsc);
+    LV_LOG_WARN("Can't draw polygon with LV_DRAW_COMPLEX == 0");
+#endif /*LV_DRAW_COMPLEX*/
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+#if LV_DRAW_COMPLEX
+
+/**
+ * Draw a convex polygon as a rectangle masked by a line mask for each edge.
+ */
+static void draw_polygon_masked(const lv_point_t points[], uint16_t point_cnt, const lv_area_t * clip_area,
+                                const lv_draw_rect_dsc_t * draw_dsc)
+{
+    if(point_cnt < 3) return;
+    if(points == NULL) return;
+
     /*Join adjacent points if they are on the same coordinate*/
     lv_point_t * p = lv_mem_buf_get(point_cnt * sizeof(lv_point_t));
     if(p == NULL) return;
@@ -202,15 +507,326 @@ void lv_draw_polygon(const lv_point_t points[], uint16_t point_cnt, const lv_are
 
     lv_mem_buf_release(mp);
     lv_mem_buf_release(p);
-#else
-    LV_UNUSED(points);
-    LV_UNUSED(point_cnt);
-    LV_UNUSED(clip_area);
-    LV_UNUSED(draw_dsc);
-    LV_LOG_WARN("Can't draw polygon with LV_DRAW_COMPLEX == 0");
-#endif /*LV_DRAW_COMPLEX*/
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Sort the edges by their top Y coordinate
+ */
+/**
+ * Sort the edges by the row where they start with bucket sort.
+ * The edges which are not in the rows of the draw area are dropped.
+ * @param edges the edges
+ * @param edge_cnt number of edges
+ * @param draw_area the area to draw
+ * @param sorted store the pointers to the sorted edges here
+ * @return number of edges in `sorted`
+ */
+static uint32_t poly_edge_sort(poly_edge_t * edges, uint32_t edge_cnt, const lv_area_t * draw_area,
+                               poly_edge_t ** sorted)
+{
+    int32_t area_top = (int32_t)draw_area->y1 << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t area_bottom = ((int32_t)draw_area->y2 + 1) << LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t row_cnt = lv_area_get_height(draw_area);
+    uint32_t * row_start = lv_mem_buf_get((row_cnt + 1) * sizeof(uint32_t));
+    lv_memset_00(row_start, (row_cnt + 1) * sizeof(uint32_t));
+
+    /*Count the edges starting in each row. Edges starting above the draw area start in its first row*/
+    uint32_t i;
+    for(i = 0; i < edge_cnt; i++) {
+        poly_edge_t * e = &edges[i];
+        if(e->y_bottom <= area_top || e->y_top >= area_bottom) {
+            e->dir = 0;
+            continue;
+        }
+        int32_t row = (e->y_top >> LV_DRAW_POLY_SUBPX_SHIFT) - draw_area->y1;
+        row_start[LV_MAX(row, 0) + 1]++;
+    }
+
+    int32_t row;
+    for(row = 0; row < row_cnt; row++) row_start[row + 1] += row_start[row];
+    uint32_t sorted_cnt = row_start[row_cnt];
+
+    for(i = 0; i < edge_cnt; i++) {
+        poly_edge_t * e = &edges[i];
+        if(e->dir == 0) continue;
+        row = (e->y_top >> LV_DRAW_POLY_SUBPX_SHIFT) - draw_area->y1;
+        sorted[row_start[LV_MAX(row, 0)]] = e;
+        row_start[LV_MAX(row, 0)]++;
+    }
+
+    lv_mem_buf_release(row_start);
+    return sorted_cnt;
+}
+
+static inline void poly_cov_add(int32_t * cov_buf, int32_t w, int32_t i, int32_t v)
+{
+    if(i >= w) return;
+    /*The buffer is accumulated from left to right so the cells on the left can be merged into the first*/
+    if(i < 0) i = 0;
+    cov_buf[i] += v;
+}
+
+/**
+ * Add the signed area covered by an edge segment in a row to the accumulation buffer.
+ * Summing the buffer from left to right gives the coverage of each pixel.
+ * @param cov_buf the accumulation buffer of the row
+ * @param w width of the buffer
+ * @param xa X coordinate at the top of the segment, relative to the buffer, in sub-pixels
+ * @param xb X coordinate at the bottom of the segment, relative to the buffer, in sub-pixels
+ * @param d height of the segment in sub-pixels, negative for upward edges
+ * @param dydx signed Y change for 1 sub-pixel of X in POLY_COV_ONE << LV_DRAW_POLY_SUBPX_SHIFT units
+ * @param span the range of the touched pixels will be stored here
+ * @return false if the segment doesn't affect the buffer
+ */
+LV_ATTRIBUTE_FAST_MEM static bool poly_accumulate(int32_t * cov_buf, int32_t w, int32_t xa, int32_t xb, int32_t d,
+                                                  int64_t dydx, poly_span_t * span)
+{
+    int32_t x0 = LV_MIN(xa, xb);
+    int32_t x1 = LV_MAX(xa, xb);
+    int32_t total = d << LV_DRAW_POLY_SUBPX_SHIFT;
+
+    /*Affects only the pixels on the right of the buffer*/
+    if(x0 >= (w << LV_DRAW_POLY_SUBPX_SHIFT)) return false;
+
+    int32_t x0i = x0 >> LV_DRAW_POLY_SUBPX_SHIFT;
+    int32_t x1c = (x1 + POLY_SUBPX_ONE - 1) >> LV_DRAW_POLY_SUBPX_SHIFT;
+
+    span->x1 = LV_MAX(x0i, 0);
+    span->x2 = LV_CLAMP(0, x1c, w - 1);
+
+    /*Completely on the left: all pixels of the buffer are on its right side*/
+    if(x1 <= 0) {
+        cov_buf[0] += total;
+        return true;
+    }
+
+    /*The segment is in a single pixel: split the area by the middle X*/
+    if(x1c <= x0i + 1) {
+        int32_t xm = ((xa + xb) >> 1) - (x0i << LV_DRAW_POLY_SUBPX_SHIFT);
+        int32_t v = d * xm;
+        poly_cov_add(cov_buf, w, x0i, total - v);
+        poly_cov_add(cov_buf, w, x0i + 1, v);
+        return true;
+    }
+
+    /*The segment crosses more pixels. The first and last have triangle shaped areas,
+     *the ones between get the same amount.*/
+    int32_t x0f = POLY_SUBPX_ONE - (x0 - (x0i << LV_DRAW_POLY_SUBPX_SHIFT));
+    int32_t x1f = x1 - ((x1c - 1) << LV_DRAW_POLY_SUBPX_SHIFT);
+    int32_t v0 = (int32_t)((dydx * x0f * x0f) >> (POLY_COV_SHIFT + LV_DRAW_POLY_SUBPX_SHIFT + 1));
+    int32_t vm = (int32_t)((dydx * x1f * x1f) >> (POLY_COV_SHIFT + LV_DRAW_POLY_SUBPX_SHIFT + 1));
+
+    poly_cov_add(cov_buf, w, x0i, v0);
+    if(x1c == x0i + 2) {
+        poly_cov_add(cov_buf, w, x0i + 1, total - v0 - vm);
+    }
+    else {
+        /*Here dx > 1 px so `dydx < POLY_COV_ONE` and nothing overflows*/
+        int32_t v1 = (int32_t)((dydx * (x0f + POLY_SUBPX_ONE / 2)) >> POLY_COV_SHIFT) - v0;
+        int32_t vs = (int32_t)(dydx >> LV_DRAW_POLY_SUBPX_SHIFT);
+        int32_t mid_cnt = x1c - x0i - 3;
+        poly_cov_add(cov_buf, w, x0i + 1, v1);
+
+        int32_t xi = x0i + 2;
+        int32_t xi_end = LV_MIN(x1c - 1, w);
+        if(xi < 0) {
+            int32_t left_cnt = LV_MIN(-xi, xi_end - xi);
+            if(left_cnt > 0) {
+                cov_buf[0] += left_cnt * vs;
+                xi += left_cnt;
+            }
+        }
+        for(; xi < xi_end; xi++) cov_buf[xi] += vs;
+
+        poly_cov_add(cov_buf, w, x1c - 1, total - v0 - v1 - mid_cnt * vs - vm);
+    }
+    poly_cov_add(cov_buf, w, x1c, vm);
+    return true;
+}
+
+/**
+ * Sort the active edges by their current X coordinate
+ */
+static void poly_active_sort(poly_edge_t ** active, uint32_t act_cnt)
+{
+    /*The order changes only where the edges cross so insertion sort is fine*/
+    uint32_t i;
+    for(i = 1; i < act_cnt; i++) {
+        poly_edge_t * tmp = active[i];
+        uint32_t j = i;
+        while(j > 0 && active[j - 1]->x > tmp->x) {
+            active[j] = active[j - 1];
+            j--;
+        }
+        active[j] = tmp;
+    }
+}
+
+/**
+ * Insert an edge into the sorted active edges
+ */
+static void poly_active_insert(poly_edge_t ** active, uint32_t act_cnt, poly_edge_t * e)
+{
+    uint32_t lo = 0;
+    uint32_t hi = act_cnt;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if(active[mid]->x > e->x) hi = mid;
+        else lo = mid + 1;
+    }
+
+    uint32_t i;
+    for(i = act_cnt; i > lo; i--) active[i] = active[i - 1];
+    active[lo] = e;
+}
+
+/**
+ * Sort the touched ranges of a row by their start
+ */
+static void poly_span_sort(poly_span_t * spans, uint32_t span_cnt)
+{
+    /*Only a few edges are active in a row so insertion sort is fine*/
+    uint32_t i;
+    for(i = 1; i < span_cnt; i++) {
+        poly_span_t tmp = spans[i];
+        uint32_t j = i;
+        while(j > 0 && spans[j - 1].x1 > tmp.x1) {
+            spans[j] = spans[j - 1];
+            j--;
+        }
+        spans[j] = tmp;
+    }
+}
+
+static inline lv_opa_t poly_cov_to_opa(int32_t cov)
+{
+    /*Non-zero winding rule: the coverage is the absolute value clamped to 1*/
+    if(cov < 0) cov = -cov;
+    cov = cov >> (POLY_COV_SHIFT - 8);
+    return cov >= LV_OPA_COVER ? LV_OPA_COVER : cov;
+}
+
+static void poly_fill_init(poly_fill_t * fill, const lv_area_t * poly_area, const lv_area_t * draw_area,
+                           const lv_draw_rect_dsc_t * dsc)
+{
+    fill->dsc = dsc;
+    fill->draw_area = draw_area;
+    fill->poly_area = poly_area;
+    fill->grad_map = NULL;
+    fill->opa = dsc->bg_opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->bg_opa;
+    fill->grad_dir = dsc->bg_grad_dir;
+    if(dsc->bg_color.full == dsc->bg_grad_color.full) fill->grad_dir = LV_GRAD_DIR_NONE;
+
+    /*In case of horizontal gradient pre-compute a line with a gradient*/
+    if(fill->grad_dir == LV_GRAD_DIR_HOR) {
+        int32_t draw_area_w = lv_area_get_width(draw_area);
+        fill->grad_map = lv_mem_buf_get(draw_area_w * sizeof(lv_color_t));
+        int32_t i;
+        for(i = 0; i < draw_area_w; i++) {
+            fill->grad_map[i] = grad_get(dsc, lv_area_get_width(poly_area), draw_area->x1 + i - poly_area->x1);
+        }
+    }
+}
+
+/**
+ * Blend a span of a row
+ * @param fill the fill settings
+ * @param x1 start of the span relative to the draw area
+ * @param x2 end of the span relative to the draw area
+ * @param y absolute Y coordinate of the row
+ * @param mask opacity of the pixels of the span or NULL if `mask_res` is `LV_DRAW_MASK_RES_FULL_COVER`
+ * @param mask_res the type of `mask`
+ * @param opa overall opacity of the span
+ */
+LV_ATTRIBUTE_FAST_MEM static void poly_fill_span(const poly_fill_t * fill, int32_t x1, int32_t x2, int32_t y,
+                                                 lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_opa_t opa)
+{
+    lv_area_t span;
+    span.x1 = fill->draw_area->x1 + x1;
+    span.x2 = fill->draw_area->x1 + x2;
+    span.y1 = y;
+    span.y2 = y;
+
+    if(fill->grad_dir == LV_GRAD_DIR_HOR) {
+        _lv_blend_map(fill->draw_area, &span, &fill->grad_map[x1], mask, mask_res, opa, fill->dsc->blend_mode);
+    }
+    else {
+        lv_color_t color = fill->dsc->bg_color;
+        if(fill->grad_dir == LV_GRAD_DIR_VER) {
+            color = grad_get(fill->dsc, lv_area_get_height(fill->poly_area), y - fill->poly_area->y1);
+        }
+        _lv_blend_fill(fill->draw_area, &span, color, mask, mask_res, opa, fill->dsc->blend_mode);
+    }
+}
+
+/**
+ * Handle a part of a row where the coverage is the same for every pixel.
+ * Short parts are added to the not yet blended pixels, long parts are blended directly without mask.
+ * @param fill the fill settings
+ * @param mask_buf the mask buffer of the row
+ * @param x_pend start of the not yet blended pixels or -1 if there is none
+ * @param x1 start of the part relative to the draw area
+ * @param x2 end of the part relative to the draw area
+ * @param y absolute Y coordinate of the row
+ * @param cov coverage of the pixels
+ * @param mask_any true: there are other masks so everything needs to be added to the not blended pixels
+ * @return the new start of the not yet blended pixels
+ */
+LV_ATTRIBUTE_FAST_MEM static int32_t poly_row_const(const poly_fill_t * fill, lv_opa_t * mask_buf, int32_t x_pend,
+                                                    int32_t x1, int32_t x2, int32_t y, lv_opa_t cov, bool mask_any)
+{
+    if(cov == LV_OPA_TRANSP && x_pend < 0) return -1;
+
+    if(mask_any || x2 - x1 < POLY_CONST_SPAN_MIN) {
+        lv_memset(&mask_buf[x1], cov, x2 - x1 + 1);
+        return x_pend >= 0 ? x_pend : x1;
+    }
+
+    if(x_pend >= 0) poly_row_flush(fill, mask_buf, x_pend, x1 - 1, y, false);
+
+    if(cov == LV_OPA_COVER) {
+        poly_fill_span(fill, x1, x2, y, NULL, LV_DRAW_MASK_RES_FULL_COVER, fill->opa);
+    }
+    else if(cov != LV_OPA_TRANSP) {
+        poly_fill_span(fill, x1, x2, y, NULL, LV_DRAW_MASK_RES_FULL_COVER, (fill->opa * cov) >> 8);
+    }
+
+    return -1;
+}
+
+/**
+ * Blend the collected pixels of a row
+ * @param fill the fill settings
+ * @param mask_buf the mask buffer of the row
+ * @param x1 start of the pixels relative to the draw area
+ * @param x2 end of the pixels relative to the draw area
+ * @param y absolute Y coordinate of the row
+ * @param mask_any true: apply the other masks too
+ */
+LV_ATTRIBUTE_FAST_MEM static void poly_row_flush(const poly_fill_t * fill, lv_opa_t * mask_buf, int32_t x1, int32_t x2,
+                                                 int32_t y, bool mask_any)
+{
+    lv_draw_mask_res_t mask_res = LV_DRAW_MASK_RES_CHANGED;
+    if(mask_any) {
+        mask_res = lv_draw_mask_apply(&mask_buf[x1], fill->draw_area->x1 + x1, y, x2 - x1 + 1);
+        if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask_res = LV_DRAW_MASK_RES_CHANGED;
+    }
+    poly_fill_span(fill, x1, x2, y, &mask_buf[x1], mask_res, fill->opa);
+}
+
+static inline lv_color_t grad_get(const lv_draw_rect_dsc_t * dsc, lv_coord_t s, lv_coord_t i)
+{
+    int32_t min = (dsc->bg_main_color_stop * s) >> 8;
+    if(i <= min) return dsc->bg_color;
+
+    int32_t max = (dsc->bg_grad_color_stop * s) >> 8;
+    if(i >= max) return dsc->bg_grad_color;
+
+    int32_t d = dsc->bg_grad_color_stop - dsc->bg_main_color_stop;
+    d = (s * d) >> 8;
+    i -= min;
+    lv_opa_t mix = (i * 255) / d;
+    return lv_color_mix(dsc->bg_grad_color, dsc->bg_color, mix);
+}
+
+#endif /*LV_DRAW_COMPLEX*/
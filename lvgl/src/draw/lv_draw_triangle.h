@@ -18,11 +18,21 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#define LV_DRAW_POLY_SUBPX_SHIFT 8  /**< The coordinates of `lv_draw_poly_point_t` are upscaled by this many bits*/
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * A point with sub-pixel precision in 1/(1 << LV_DRAW_POLY_SUBPX_SHIFT) pixel units.
+ * The integer coordinates are on the top left corner of the pixels.
+ */
+typedef struct {
+    int32_t x;
+    int32_t y;
+} lv_draw_poly_point_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -36,7 +46,8 @@ extern "C" {
 void lv_draw_triangle(const lv_point_t points[], const lv_area_t * clip, const lv_draw_rect_dsc_t * draw_dsc);
 
 /**
- * Draw a polygon. Only convex polygons are supported.
+ * Draw a polygon. The background can be drawn for any polygon (even concave or self-intersecting ones)
+ * but the background image, border, outline and shadow are supported only for convex polygons.
  * @param points an array of points
  * @param point_cnt number of points
  * @param clip_area polygon will be drawn only in this area
@@ -45,6 +56,18 @@ void lv_draw_triangle(const lv_point_t points[], const lv_area_t * clip, const l
 void lv_draw_polygon(const lv_point_t points[], uint16_t point_cnt, const lv_area_t * mask,
                      const lv_draw_rect_dsc_t * draw_dsc);
 
+/**
+ * Fill one or more closed contours with anti-aliased edges using the non-zero winding rule.
+ * Draws the shape scanline by scanline without adding masks, so it works with any number of points.
+ * @param points the points of all contours one after the other
+ * @param contour_pcnt number of points in each contour
+ * @param contour_cnt number of contours
+ * @param clip_area the shape will be drawn only in this area
+ * @param draw_dsc only the background color, gradient, opacity and the blend mode are used from it
+ */
+void _lv_draw_polygon_subpx(const lv_draw_poly_point_t points[], const uint16_t contour_pcnt[], uint16_t contour_cnt,
+                            const lv_area_t * clip_area, const lv_draw_rect_dsc_t * draw_dsc);
+
 /**********************
  *      MACROS
  **********************/
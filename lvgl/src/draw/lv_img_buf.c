@@ -17,6 +17,12 @@
 /*********************
  *      DEFINES
  *********************/
+/*Number of fractional bits of the source coordinates in `_lv_img_buf_transform_line`*/
+#define TRANSFORM_FP_SHIFT  16
+#define TRANSFORM_FP_HALF   (1 << (TRANSFORM_FP_SHIFT - 1))
+
+/*`lv_trigo_sin() * zoom_inv >> TRANSFORM_STEP_SHIFT` gives the source step in 1/65536 px units*/
+#define TRANSFORM_STEP_SHIFT (LV_TRIGO_SHIFT + _LV_ZOOM_INV_UPSCALE + 8 - TRANSFORM_FP_SHIFT)
 
 /**********************
  *      TYPEDEFS
@@ -25,6 +31,18 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_COMPLEX
+static int32_t transform_get_step(int32_t trigo, uint32_t zoom_inv);
+static bool transform_line_get_range(int64_t start, int32_t step, int32_t size, int32_t * first, int32_t * last);
+LV_ATTRIBUTE_FAST_MEM static void transform_line_true_color(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                            int32_t len, lv_color_t * cbuf, lv_opa_t * abuf);
+LV_ATTRIBUTE_FAST_MEM static void transform_line_true_color_alpha(const lv_img_transform_dsc_t * dsc, int32_t xs,
+                                                                  int32_t ys, int32_t len, lv_color_t * cbuf, lv_opa_t * abuf);
+LV_ATTRIBUTE_FAST_MEM static void transform_line_alpha(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                       int32_t len, lv_color_t * cbuf, lv_opa_t * abuf);
+LV_ATTRIBUTE_FAST_MEM static void transform_line_indexed(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                         int32_t len, lv_color_t * cbuf, lv_opa_t * abuf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -433,6 +451,15 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc)
     dsc->tmp.sinma = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
     dsc->tmp.cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
 
+    /*The inverse of the zoom will be sued during the transformation
+     * + dsc->cfg.zoom / 2 for rounding*/
+    dsc->tmp.zoom_inv = (((256 * 256) << _LV_ZOOM_INV_UPSCALE) + dsc->cfg.zoom / 2) / dsc->cfg.zoom;
+
+    /*Moving right by one pixel on the destination moves the source point by this much.
+     *Calculated from the full precision sine and cosine as the error accumulates along the line.*/
+    dsc->tmp.xs_step = transform_get_step(dsc->tmp.cosma, dsc->tmp.zoom_inv);
+    dsc->tmp.ys_step = transform_get_step(dsc->tmp.sinma, dsc->tmp.zoom_inv);
+
     /*Use smaller value to avoid overflow*/
     dsc->tmp.sinma = dsc->tmp.sinma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
     dsc->tmp.cosma = dsc->tmp.cosma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
@@ -453,10 +480,6 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc)
     dsc->tmp.img_dsc.header.w = dsc->cfg.src_w;
     dsc->tmp.img_dsc.header.h = dsc->cfg.src_h;
 
-    /*The inverse of the zoom will be sued during the transformation
-     * + dsc->cfg.zoom / 2 for rounding*/
-    dsc->tmp.zoom_inv = (((256 * 256) << _LV_ZOOM_INV_UPSCALE) + dsc->cfg.zoom / 2) / dsc->cfg.zoom;
-
     dsc->res.opa = LV_OPA_COVER;
     dsc->res.color = dsc->cfg.color;
 }
@@ -766,7 +789,475 @@ bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc)
 
     return true;
 }
+/**
+ * Transform a horizontal line of pixels at once.
+ * The source coordinates are stepped in fixed point along the line and
+ * a specialized loop is used for every color format.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the x coordinate of the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels to transform
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements). Pixels out of the image will be `LV_OPA_TRANSP`.
+ * @return true: at least one pixel of the line is on the image; false: the whole line was out of the image
+ */
+bool _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    /*Get the first pixel's coordinates relative to the pivot*/
+    int32_t xt = x - dsc->cfg.pivot_x;
+    int32_t yt = y - dsc->cfg.pivot_y;
+
+    /*Map it to the source image. The steps are `cos * zoom` and `sin * zoom` so they describe the rotation too.
+     *64 bit is used as far away or strongly zoomed out pixels can overflow.*/
+    int64_t xs = (int64_t)dsc->tmp.xs_step * xt - (int64_t)dsc->tmp.ys_step * yt;
+    int64_t ys = (int64_t)dsc->tmp.ys_step * xt + (int64_t)dsc->tmp.xs_step * yt;
+    xs += (int64_t)dsc->cfg.pivot_x << TRANSFORM_FP_SHIFT;
+    ys += (int64_t)dsc->cfg.pivot_y << TRANSFORM_FP_SHIFT;
+
+    /*Find the part of the line which falls on the image. Only this part needs to be sampled.*/
+    int32_t first = 0;
+    int32_t last = len - 1;
+    if(!transform_line_get_range(xs, dsc->tmp.xs_step, dsc->cfg.src_w, &first, &last) ||
+       !transform_line_get_range(ys, dsc->tmp.ys_step, dsc->cfg.src_h, &first, &last)) {
+        lv_memset_00(abuf, len);
+        return false;
+    }
+
+    if(first > 0) lv_memset_00(abuf, first);
+    if(last < len - 1) lv_memset_00(&abuf[last + 1], len - 1 - last);
+
+    /*From here the coordinates are on the image so they fit into 32 bit*/
+    int32_t xs_first = (int32_t)(xs + (int64_t)dsc->tmp.xs_step * first);
+    int32_t ys_first = (int32_t)(ys + (int64_t)dsc->tmp.ys_step * first);
+    int32_t len_on_img = last - first + 1;
+
+    switch(dsc->cfg.cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            transform_line_true_color(dsc, xs_first, ys_first, len_on_img, &cbuf[first], &abuf[first]);
+            break;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+            transform_line_true_color_alpha(dsc, xs_first, ys_first, len_on_img, &cbuf[first], &abuf[first]);
+            break;
+        case LV_IMG_CF_ALPHA_1BIT:
+        case LV_IMG_CF_ALPHA_2BIT:
+        case LV_IMG_CF_ALPHA_4BIT:
+        case LV_IMG_CF_ALPHA_8BIT:
+            transform_line_alpha(dsc, xs_first, ys_first, len_on_img, &cbuf[first], &abuf[first]);
+            break;
+        case LV_IMG_CF_INDEXED_1BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+        case LV_IMG_CF_INDEXED_8BIT:
+            transform_line_indexed(dsc, xs_first, ys_first, len_on_img, &cbuf[first], &abuf[first]);
+            break;
+        default:
+            LV_LOG_WARN("_lv_img_buf_transform_line: unsupported color format");
+            lv_memset_00(abuf, len);
+            return false;
+    }
+
+    return true;
+}
 #endif
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_DRAW_COMPLEX
+
+/**
+ * Get the change of a source coordinate in 1/65536 px units when the destination x increases by 1
+ * @param trigo sine or cosine of the angle as returned by `lv_trigo_sin()`
+ * @param zoom_inv inverse of the zoom as in `lv_img_transform_dsc_t`
+ * @return the step
+ */
+static int32_t transform_get_step(int32_t trigo, uint32_t zoom_inv)
+{
+    /*Handle the max. value of `lv_trigo_sin()` as 1 to get exact steps on 0, 90, 180 and 270 degrees*/
+    if(trigo == LV_TRIGO_SIN_MAX) trigo = 1 << LV_TRIGO_SHIFT;
+    else if(trigo == -LV_TRIGO_SIN_MAX) trigo = -(1 << LV_TRIGO_SHIFT);
+
+    int64_t step = (int64_t)trigo * zoom_inv;
+    return (int32_t)((step + (1 << (TRANSFORM_STEP_SHIFT - 1))) >> TRANSFORM_STEP_SHIFT);
+}
+
+static int64_t div_floor(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    if((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
+static int64_t div_ceil(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    if((a % b != 0) && ((a < 0) == (b < 0))) q++;
+    return q;
+}
+
+/**
+ * Limit the `first..last` pixel range of a line to the pixels whose source coordinate is on the image.
+ * The source coordinate of the i-th pixel is `start + i * step` in 1/65536 px units.
+ * @param start source coordinate of the 0th pixel
+ * @param step change of the source coordinate per pixel
+ * @param size width or height of the image
+ * @param first index of the first pixel, will be increased if required
+ * @param last index of the last pixel, will be decreased if required
+ * @return true: there are pixels on the image; false: the range became empty
+ */
+static bool transform_line_get_range(int64_t start, int32_t step, int32_t size, int32_t * first, int32_t * last)
+{
+    /*Looking for `i` where `lo <= step * i <= hi`*/
+    int64_t lo = -start;
+    int64_t hi = ((int64_t)size << TRANSFORM_FP_SHIFT) - 1 - start;
+
+    if(step == 0) return lo <= 0 && hi >= 0 && *first <= *last;
+
+    int64_t i_min;
+    int64_t i_max;
+    if(step > 0) {
+        i_min = div_ceil(lo, step);
+        i_max = div_floor(hi, step);
+    }
+    else {
+        i_min = div_ceil(hi, step);
+        i_max = div_floor(lo, step);
+    }
+
+    if(i_min > *first) *first = i_min > *last ? *last + 1 : (int32_t)i_min;
+    if(i_max < *last) *last = i_max < *first ? *first - 1 : (int32_t)i_max;
+
+    return *first <= *last;
+}
+
+/**
+ * Get the two neighboring pixels and the mix ratio for bilinear filtering.
+ * The pixel centers are at +0.5 so the neighbors are selected by the fractional part.
+ * @param s source coordinate in 1/65536 px units
+ * @param size width or height of the image. Neighbors out of the image are clamped to the edge.
+ * @param s0 store the first neighbor's coordinate here
+ * @param s1 store the second neighbor's coordinate here
+ * @return weight of `s1` (0..255)
+ */
+LV_ATTRIBUTE_FAST_MEM static inline uint8_t transform_get_neighbors(int32_t s, int32_t size, int32_t * s0, int32_t * s1)
+{
+    s -= TRANSFORM_FP_HALF;
+    *s0 = s >> TRANSFORM_FP_SHIFT;
+    *s1 = *s0 + 1;
+    if(*s0 < 0) *s0 = 0;
+    if(*s1 >= size) *s1 = size - 1;
+    return (s >> (TRANSFORM_FP_SHIFT - 8)) & 0xFF;
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t transform_mix_bilinear(lv_color_t c00, lv_color_t c01, lv_color_t c10,
+                                                                      lv_color_t c11, uint8_t fx, uint8_t fy)
+{
+#if LV_COLOR_DEPTH == 1
+    lv_color_t c0 = fx ? lv_color_mix(c01, c00, fx) : c00;
+    lv_color_t c1 = fx ? lv_color_mix(c11, c10, fx) : c10;
+    return fy ? lv_color_mix(c1, c0, fy) : c0;
+#else
+    /*Weight of the 4 pixels. Their sum is 65536.*/
+    uint32_t w00 = (256 - fx) * (256 - fy);
+    uint32_t w01 = fx * (256 - fy);
+    uint32_t w10 = (256 - fx) * fy;
+    uint32_t w11 = fx * fy;
+
+    lv_color_t c;
+    LV_COLOR_SET_R(c, (LV_COLOR_GET_R(c00) * w00 + LV_COLOR_GET_R(c01) * w01 +
+                       LV_COLOR_GET_R(c10) * w10 + LV_COLOR_GET_R(c11) * w11 + 0x8000) >> 16);
+    LV_COLOR_SET_G(c, (LV_COLOR_GET_G(c00) * w00 + LV_COLOR_GET_G(c01) * w01 +
+                       LV_COLOR_GET_G(c10) * w10 + LV_COLOR_GET_G(c11) * w11 + 0x8000) >> 16);
+    LV_COLOR_SET_B(c, (LV_COLOR_GET_B(c00) * w00 + LV_COLOR_GET_B(c01) * w01 +
+                       LV_COLOR_GET_B(c10) * w10 + LV_COLOR_GET_B(c11) * w11 + 0x8000) >> 16);
+    LV_COLOR_SET_A(c, 0xFF);
+    return c;
+#endif
+}
+
+/**
+ * Bilinear filtering of pixels with opacity.
+ * The colors are weighted by their opacity too so transparent neighbors don't cause dark fringes.
+ * @return the mixed opacity. The mixed color is written to `res`.
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t transform_mix_bilinear_alpha(lv_color_t c00, lv_color_t c01,
+                                                                          lv_color_t c10, lv_color_t c11,
+                                                                          lv_opa_t a00, lv_opa_t a01,
+                                                                          lv_opa_t a10, lv_opa_t a11,
+                                                                          uint8_t fx, uint8_t fy, lv_color_t * res)
+{
+    /*Weight of the 4 pixels scaled by their opacity. The sum of the weights without opacity would be 65536.*/
+    uint32_t w00 = ((256 - fx) * (256 - fy) * a00) >> 8;
+    uint32_t w01 = (fx * (256 - fy) * a01) >> 8;
+    uint32_t w10 = ((256 - fx) * fy * a10) >> 8;
+    uint32_t w11 = (fx * fy * a11) >> 8;
+    uint32_t w_sum = w00 + w01 + w10 + w11;
+
+    lv_opa_t a = w_sum >> 8;
+    if(a <= LV_OPA_MIN) return LV_OPA_TRANSP;
+
+#if LV_COLOR_DEPTH == 1
+    LV_UNUSED(c01);
+    LV_UNUSED(c10);
+    LV_UNUSED(c11);
+    uint32_t w_max = LV_MAX4(w00, w01, w10, w11);
+    if(w_max == w00) *res = c00;
+    else if(w_max == w01) *res = c01;
+    else if(w_max == w10) *res = c10;
+    else *res = c11;
+#else
+    uint32_t round = w_sum >> 1;
+    LV_COLOR_SET_R(*res, (LV_COLOR_GET_R(c00) * w00 + LV_COLOR_GET_R(c01) * w01 +
+                          LV_COLOR_GET_R(c10) * w10 + LV_COLOR_GET_R(c11) * w11 + round) / w_sum);
+    LV_COLOR_SET_G(*res, (LV_COLOR_GET_G(c00) * w00 + LV_COLOR_GET_G(c01) * w01 +
+                          LV_COLOR_GET_G(c10) * w10 + LV_COLOR_GET_G(c11) * w11 + round) / w_sum);
+    LV_COLOR_SET_B(*res, (LV_COLOR_GET_B(c00) * w00 + LV_COLOR_GET_B(c01) * w01 +
+                          LV_COLOR_GET_B(c10) * w10 + LV_COLOR_GET_B(c11) * w11 + round) / w_sum);
+    LV_COLOR_SET_A(*res, 0xFF);
+#endif
+
+    return a;
+}
+
+/**
+ * Read a color from a `LV_IMG_CF_TRUE_COLOR_ALPHA` pixel. 16 bit colors can be on odd addresses
+ * so they are read byte-by-byte.
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color_t transform_read_color(const uint8_t * px)
+{
+    lv_color_t c;
+#if LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
+    c.full = px[0];
+#elif LV_COLOR_DEPTH == 16
+    c.full = px[0] + (px[1] << 8);
+#elif LV_COLOR_DEPTH == 32
+    lv_memcpy_small(&c, px, sizeof(lv_color_t));
+    c.ch.alpha = 0xFF;
+#endif
+    return c;
+}
+
+/**
+ * Get an index or alpha value from an image with 1, 2, 4 or 8 bit per pixel
+ */
+LV_ATTRIBUTE_FAST_MEM static inline uint8_t transform_read_bits(const uint8_t * buf, uint32_t stride, uint8_t bpp,
+                                                                int32_t x, int32_t y)
+{
+    if(bpp == 8) return buf[stride * y + x];
+
+    uint32_t bit_pos = x * bpp;
+    uint8_t byte = buf[stride * y + (bit_pos >> 3)];
+    return (byte >> (8 - bpp - (bit_pos & 0x7))) & ((1 << bpp) - 1);
+}
+
+LV_ATTRIBUTE_FAST_MEM static void transform_line_true_color(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                            int32_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    const lv_color_t * src = dsc->cfg.src;
+    int32_t w = dsc->cfg.src_w;
+    int32_t h = dsc->cfg.src_h;
+    int32_t xs_step = dsc->tmp.xs_step;
+    int32_t ys_step = dsc->tmp.ys_step;
+    lv_color_t chroma_key = LV_COLOR_CHROMA_KEY;
+    int32_t i;
+
+    if(dsc->cfg.antialias == false) {
+        for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+            lv_color_t c = src[(ys >> TRANSFORM_FP_SHIFT) * w + (xs >> TRANSFORM_FP_SHIFT)];
+            if(dsc->tmp.chroma_keyed && c.full == chroma_key.full) {
+                abuf[i] = LV_OPA_TRANSP;
+                continue;
+            }
+#if LV_COLOR_DEPTH == 32
+            c.ch.alpha = 0xFF;
+#endif
+            cbuf[i] = c;
+            abuf[i] = LV_OPA_COVER;
+        }
+        return;
+    }
+
+    for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+        int32_t x0, x1, y0, y1;
+        uint8_t fx = transform_get_neighbors(xs, w, &x0, &x1);
+        uint8_t fy = transform_get_neighbors(ys, h, &y0, &y1);
+
+        const lv_color_t * row0 = &src[y0 * w];
+        const lv_color_t * row1 = &src[y1 * w];
+        lv_color_t c00 = row0[x0];
+        lv_color_t c01 = row0[x1];
+        lv_color_t c10 = row1[x0];
+        lv_color_t c11 = row1[x1];
+
+        if(dsc->tmp.chroma_keyed) {
+            /*Handle the chroma keyed pixels as transparent ones to get smooth edges*/
+            abuf[i] = transform_mix_bilinear_alpha(c00, c01, c10, c11,
+                                                   c00.full == chroma_key.full ? LV_OPA_TRANSP : LV_OPA_COVER,
+                                                   c01.full == chroma_key.full ? LV_OPA_TRANSP : LV_OPA_COVER,
+                                                   c10.full == chroma_key.full ? LV_OPA_TRANSP : LV_OPA_COVER,
+                                                   c11.full == chroma_key.full ? LV_OPA_TRANSP : LV_OPA_COVER,
+                                                   fx, fy, &cbuf[i]);
+        }
+        else {
+            cbuf[i] = transform_mix_bilinear(c00, c01, c10, c11, fx, fy);
+            abuf[i] = LV_OPA_COVER;
+        }
+#if LV_COLOR_DEPTH == 32
+        cbuf[i].ch.alpha = 0xFF;
+#endif
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void transform_line_true_color_alpha(const lv_img_transform_dsc_t * dsc, int32_t xs,
+                                                                  int32_t ys, int32_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    const uint8_t * src = dsc->cfg.src;
+    int32_t w = dsc->cfg.src_w;
+    int32_t h = dsc->cfg.src_h;
+    int32_t xs_step = dsc->tmp.xs_step;
+    int32_t ys_step = dsc->tmp.ys_step;
+    uint32_t stride = w * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    int32_t i;
+
+    if(dsc->cfg.antialias == false) {
+        for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+            const uint8_t * px = &src[(ys >> TRANSFORM_FP_SHIFT) * stride + (xs >> TRANSFORM_FP_SHIFT) * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            abuf[i] = px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            if(abuf[i]) cbuf[i] = transform_read_color(px);
+        }
+        return;
+    }
+
+    for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+        int32_t x0, x1, y0, y1;
+        uint8_t fx = transform_get_neighbors(xs, w, &x0, &x1);
+        uint8_t fy = transform_get_neighbors(ys, h, &y0, &y1);
+
+        const uint8_t * px00 = &src[y0 * stride + x0 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        const uint8_t * px01 = &src[y0 * stride + x1 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        const uint8_t * px10 = &src[y1 * stride + x0 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        const uint8_t * px11 = &src[y1 * stride + x1 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+
+        lv_opa_t a00 = px00[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+        lv_opa_t a01 = px01[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+        lv_opa_t a10 = px10[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+        lv_opa_t a11 = px11[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+
+        /*Fast path for the fully transparent and fully opaque areas*/
+        if((a00 | a01 | a10 | a11) == 0) {
+            abuf[i] = LV_OPA_TRANSP;
+        }
+        else if((a00 & a01 & a10 & a11) == 0xFF) {
+            cbuf[i] = transform_mix_bilinear(transform_read_color(px00), transform_read_color(px01),
+                                             transform_read_color(px10), transform_read_color(px11), fx, fy);
+            abuf[i] = LV_OPA_COVER;
+        }
+        else {
+            abuf[i] = transform_mix_bilinear_alpha(transform_read_color(px00), transform_read_color(px01),
+                                                   transform_read_color(px10), transform_read_color(px11),
+                                                   a00, a01, a10, a11, fx, fy, &cbuf[i]);
+        }
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void transform_line_alpha(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                       int32_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    static const lv_opa_t opa_table_1bit[2] = {0, 255};
+    static const lv_opa_t opa_table_2bit[4] = {0, 85, 170, 255};
+    static const lv_opa_t opa_table_4bit[16] = {0,  17, 34,  51, 68, 85, 102, 119,
+                                                136, 153, 170, 187, 204, 221, 238, 255
+                                               };
+
+    const uint8_t * src = dsc->cfg.src;
+    int32_t w = dsc->cfg.src_w;
+    int32_t h = dsc->cfg.src_h;
+    int32_t xs_step = dsc->tmp.xs_step;
+    int32_t ys_step = dsc->tmp.ys_step;
+    uint8_t bpp = lv_img_cf_get_px_size(dsc->cfg.cf);
+    uint32_t stride = (w * bpp + 7) >> 3;
+    const lv_opa_t * opa_table = NULL;
+    if(bpp == 1) opa_table = opa_table_1bit;
+    else if(bpp == 2) opa_table = opa_table_2bit;
+    else if(bpp == 4) opa_table = opa_table_4bit;
+
+    int32_t i;
+    for(i = 0; i < len; i++) cbuf[i] = dsc->cfg.color;
+
+    if(dsc->cfg.antialias == false) {
+        for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+            uint8_t v = transform_read_bits(src, stride, bpp, xs >> TRANSFORM_FP_SHIFT, ys >> TRANSFORM_FP_SHIFT);
+            abuf[i] = opa_table ? opa_table[v] : v;
+        }
+        return;
+    }
+
+    for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+        int32_t x0, x1, y0, y1;
+        uint8_t fx = transform_get_neighbors(xs, w, &x0, &x1);
+        uint8_t fy = transform_get_neighbors(ys, h, &y0, &y1);
+
+        uint32_t a00 = transform_read_bits(src, stride, bpp, x0, y0);
+        uint32_t a01 = transform_read_bits(src, stride, bpp, x1, y0);
+        uint32_t a10 = transform_read_bits(src, stride, bpp, x0, y1);
+        uint32_t a11 = transform_read_bits(src, stride, bpp, x1, y1);
+        if(opa_table) {
+            a00 = opa_table[a00];
+            a01 = opa_table[a01];
+            a10 = opa_table[a10];
+            a11 = opa_table[a11];
+        }
+
+        uint32_t a0 = (a00 * (256 - fx) + a01 * fx) >> 8;
+        uint32_t a1 = (a10 * (256 - fx) + a11 * fx) >> 8;
+        abuf[i] = (a0 * (256 - fy) + a1 * fy) >> 8;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void transform_line_indexed(const lv_img_transform_dsc_t * dsc, int32_t xs, int32_t ys,
+                                                         int32_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    uint8_t bpp = lv_img_cf_get_px_size(dsc->cfg.cf);
+
+    /*The palette is stored at the beginning of the image data*/
+    const lv_color32_t * palette = dsc->cfg.src;
+    const uint8_t * src = (const uint8_t *)dsc->cfg.src + sizeof(lv_color32_t) * (1 << bpp);
+    int32_t w = dsc->cfg.src_w;
+    int32_t h = dsc->cfg.src_h;
+    int32_t xs_step = dsc->tmp.xs_step;
+    int32_t ys_step = dsc->tmp.ys_step;
+    uint32_t stride = (w * bpp + 7) >> 3;
+    int32_t i;
+
+    if(dsc->cfg.antialias == false) {
+        for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+            const lv_color32_t * p = &palette[transform_read_bits(src, stride, bpp, xs >> TRANSFORM_FP_SHIFT,
+                                                                  ys >> TRANSFORM_FP_SHIFT)];
+            abuf[i] = p->ch.alpha;
+            cbuf[i] = lv_color_make(p->ch.red, p->ch.green, p->ch.blue);
+        }
+        return;
+    }
+
+    for(i = 0; i < len; i++, xs += xs_step, ys += ys_step) {
+        int32_t x0, x1, y0, y1;
+        uint8_t fx = transform_get_neighbors(xs, w, &x0, &x1);
+        uint8_t fy = transform_get_neighbors(ys, h, &y0, &y1);
+
+        const lv_color32_t * p00 = &palette[transform_read_bits(src, stride, bpp, x0, y0)];
+        const lv_color32_t * p01 = &palette[transform_read_bits(src, stride, bpp, x1, y0)];
+        const lv_color32_t * p10 = &palette[transform_read_bits(src, stride, bpp, x0, y1)];
+        const lv_color32_t * p11 = &palette[transform_read_bits(src, stride, bpp, x1, y1)];
+
+        abuf[i] = transform_mix_bilinear_alpha(lv_color_make(p00->ch.red, p00->ch.green, p00->ch.blue),
+                                               lv_color_make(p01->ch.red, p01->ch.green, p01->ch.blue),
+                                               lv_color_make(p10->ch.red, p10->ch.green, p10->ch.blue),
+                                               lv_color_make(p11->ch.red, p11->ch.green, p11->ch.blue),
+                                               p00->ch.alpha, p01->ch.alpha, p10->ch.alpha, p11->ch.alpha,
+                                               fx, fy, &cbuf[i]);
+    }
+}
+
+#endif /*LV_DRAW_COMPLEX*/
@@ -170,6 +170,10 @@ typedef struct {
 
         uint32_t zoom_inv;
 
+        /*Change of the source coordinates when the destination x increases by 1 (1/65536 px units)*/
+        int32_t xs_step;
+        int32_t ys_step;
+
         /*Runtime data*/
         lv_coord_t xs;
         lv_coord_t ys;
@@ -286,6 +290,21 @@ bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc);
  */
 bool _lv_img_buf_transform(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y);
 
+/**
+ * Transform a horizontal line of pixels at once.
+ * The source coordinates are stepped in fixed point along the line and
+ * a specialized loop is used for every color format.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`
+ * @param x the x coordinate of the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels to transform
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements). Pixels out of the image will be `LV_OPA_TRANSP`.
+ * @return true: at least one pixel of the line is on the image; false: the whole line was out of the image
+ */
+bool _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                lv_color_t * cbuf, lv_opa_t * abuf);
+
 #endif
 /**
  * Get the area of a rectangle if its rotated and scaled
@@ -40,6 +40,34 @@ typedef struct {
     lv_coord_t grid_h;
 }_lv_grid_calc_t;
 
+/*The cell and size of an item when it was placed the last time*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_coord_t x;           /*Position relative to the grid*/
+    lv_coord_t y;
+    lv_coord_t w;
+    lv_coord_t h;
+    lv_coord_t tr_x;
+    lv_coord_t tr_y;
+    uint8_t col_pos;
+    uint8_t col_span;
+    uint8_t row_pos;
+    uint8_t row_span;
+    uint8_t x_align : 3;
+    uint8_t y_align : 3;
+    uint8_t ignored : 1;    /*Not placed by the grid (hidden, floating, etc)*/
+    uint8_t changed : 1;    /*The item has changed since it was placed*/
+}grid_item_t;
+
+/*The result of the last layout update of a container*/
+typedef struct {
+    _lv_grid_calc_t calc;
+    lv_coord_t * col_content;   /*Size of the items in the CONTENT tracks, LV_COORD_MIN: not calculated*/
+    lv_coord_t * row_content;
+    grid_item_t * items;
+    uint32_t item_cnt;
+}grid_cache_t;
+
 
 /**********************
  *  GLOBAL PROTOTYPES
@@ -49,11 +77,16 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void grid_update(lv_obj_t * cont, void * user_data);
-static void calc(lv_obj_t * obj, _lv_grid_calc_t * calc);
-static void calc_free(_lv_grid_calc_t * calc);
-static void calc_cols(lv_obj_t * cont, _lv_grid_calc_t * c);
-static void calc_rows(lv_obj_t * cont, _lv_grid_calc_t * c);
-static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t * hint);
+static grid_cache_t * cache_get(lv_obj_t * cont);
+static bool cache_resize(grid_cache_t * cache, uint32_t col_num, uint32_t row_num, uint32_t item_cnt);
+static void cache_event_cb(lv_event_t * e);
+static void items_check(lv_obj_t * cont, grid_cache_t * cache, uint8_t * col_inv, uint8_t * row_inv);
+static void calc_content(grid_cache_t * cache, const lv_coord_t * templ, bool col, const uint8_t * inv);
+static void calc(lv_obj_t * obj, grid_cache_t * cache, uint8_t * col_moved, uint8_t * row_moved);
+static void calc_cols(lv_obj_t * cont, grid_cache_t * cache, lv_coord_t * w);
+static void calc_rows(lv_obj_t * cont, grid_cache_t * cache, lv_coord_t * h);
+static bool tracks_moved(const uint8_t * moved, uint32_t pos, uint32_t span);
+static void item_repos(lv_obj_t * item, grid_item_t * cell, _lv_grid_calc_t * c, item_repos_hint_t * hint);
 static lv_coord_t grid_align(lv_coord_t cont_size,  bool auto_size, uint8_t align, lv_coord_t gap, uint32_t track_num, lv_coord_t * size_array, lv_coord_t * pos_array, bool reverse);
 static uint32_t count_tracks(const lv_coord_t * templ);
 
@@ -319,26 +352,57 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     const lv_coord_t * row_templ = get_row_dsc(cont);
     if(col_templ == NULL || row_templ == NULL) return;
 
-    _lv_grid_calc_t c;
-    calc(cont, &c);
-
-    item_repos_hint_t hint;
-    lv_memset_00(&hint, sizeof(hint));
+    uint32_t child_cnt = lv_obj_get_child_cnt(cont);
+    if(child_cnt > 0) {
+        grid_cache_t * cache = cache_get(cont);
+        if(cache == NULL) return;
+
+        uint32_t col_num = count_tracks(col_templ);
+        uint32_t row_num = count_tracks(row_templ);
+        if(!cache_resize(cache, col_num, row_num, child_cnt)) return;
+
+        /*Find the tracks whose content size might have changed*/
+        uint8_t * col_inv = lv_mem_buf_get(col_num + row_num);
+        uint8_t * row_inv = col_inv + col_num;
+        lv_memset_00(col_inv, col_num + row_num);
+        items_check(cont, cache, col_inv, row_inv);
+        calc_content(cache, col_templ, true, col_inv);
+        calc_content(cache, row_templ, false, row_inv);
+
+        /*Reuse the invalidation flags to mark the tracks which were moved or resized*/
+        calc(cont, cache, col_inv, row_inv);
+
+        item_repos_hint_t hint;
+        lv_memset_00(&hint, sizeof(hint));
+
+        /*Calculate the grids absolute x and y coordinates.
+         *It will be used as helper during item repositioning to avoid calculating this value for every children*/
+        lv_coord_t border_widt = lv_obj_get_style_border_width(cont, LV_PART_MAIN);
+        lv_coord_t pad_left = lv_obj_get_style_pad_left(cont, LV_PART_MAIN) + border_widt;
+        lv_coord_t pad_top = lv_obj_get_style_pad_top(cont, LV_PART_MAIN) + border_widt;
+        hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
+        hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
+
+        uint32_t i;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * item = cont->spec_attr->children[i];
+            grid_item_t * cell = &cache->items[i];
+            if(cell->ignored) continue;
+
+            /*Skip the items which are already in place in their unchanged cell*/
+            if(!cell->changed &&
+               !tracks_moved(col_inv, cell->col_pos, cell->col_span) &&
+               !tracks_moved(row_inv, cell->row_pos, cell->row_span) &&
+               item->coords.x1 - hint.grid_abs.x == cell->x &&
+               item->coords.y1 - hint.grid_abs.y == cell->y) {
+                continue;
+            }
 
-    /*Calculate the grids absolute x and y coordinates.
-     *It will be used as helper during item repositioning to avoid calculating this value for every children*/
-    lv_coord_t border_widt = lv_obj_get_style_border_width(cont, LV_PART_MAIN);
-    lv_coord_t pad_left = lv_obj_get_style_pad_left(cont, LV_PART_MAIN) + border_widt;
-    lv_coord_t pad_top = lv_obj_get_style_pad_top(cont, LV_PART_MAIN) + border_widt;
-    hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
-    hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
+            item_repos(item, cell, &cache->calc, &hint);
+        }
 
-    uint32_t i;
-    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
-        lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+        lv_mem_buf_release(col_inv);
     }
-    calc_free(&c);
 
     lv_coord_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     lv_coord_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
@@ -352,20 +416,235 @@ static void grid_update(lv_obj_t * cont, void * user_data)
 }
 
 /**
- * Calculate the grid cells coordinates
- * @param cont an object that has a grid
- * @param calc store the calculated cells sizes here
- * @note `_lv_grid_calc_free(calc_out)` needs to be called when `calc_out` is not needed anymore
+ * Get the cached result of the previous layout update of a container or create a new empty cache.
+ * @param cont      an object that has a grid
+ * @return          the cache or NULL if it couldn't be allocated
  */
-static void calc(lv_obj_t * cont, _lv_grid_calc_t * calc_out)
+static grid_cache_t * cache_get(lv_obj_t * cont)
 {
-    if(lv_obj_get_child(cont, 0) == NULL) {
-        lv_memset_00(calc_out, sizeof(_lv_grid_calc_t));
-        return;
+    grid_cache_t * cache = lv_obj_get_event_user_data(cont, cache_event_cb);
+    if(cache) return cache;
+
+    cache = lv_mem_alloc(sizeof(grid_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+    lv_memset_00(cache, sizeof(grid_cache_t));
+
+    lv_obj_add_event_cb(cont, cache_event_cb, LV_EVENT_DELETE, cache);
+    return cache;
+}
+
+/**
+ * Set the number of tracks and items in the cache.
+ * If the number of tracks changes the sizes of all the tracks will be recalculated.
+ * @param cache     pointer to a cache
+ * @param col_num   number of columns
+ * @param row_num   number of rows
+ * @param item_cnt  number of children of the container
+ * @return          false if the memory couldn't be allocated
+ */
+static bool cache_resize(grid_cache_t * cache, uint32_t col_num, uint32_t row_num, uint32_t item_cnt)
+{
+    _lv_grid_calc_t * c = &cache->calc;
+    if(c->col_num != col_num || c->row_num != row_num) {
+        uint32_t track_num = col_num + row_num;
+        lv_coord_t * buf = lv_mem_realloc(c->x, sizeof(lv_coord_t) * track_num * 3);
+        LV_ASSERT_MALLOC(buf);
+        if(buf == NULL) return false;
+
+        /*All the track arrays are in one buffer*/
+        c->x = buf;
+        c->w = c->x + col_num;
+        cache->col_content = c->w + col_num;
+        c->y = cache->col_content + col_num;
+        c->h = c->y + row_num;
+        cache->row_content = c->h + row_num;
+        c->col_num = col_num;
+        c->row_num = row_num;
+
+        uint32_t i;
+        for(i = 0; i < track_num * 3; i++) buf[i] = LV_COORD_MIN;
+    }
+
+    if(cache->item_cnt != item_cnt) {
+        grid_item_t * items = lv_mem_realloc(cache->items, sizeof(grid_item_t) * item_cnt);
+        LV_ASSERT_MALLOC(items);
+        if(items == NULL) return false;
+
+        /*The new items are marked as ignored so they don't invalidate any tracks on the first check*/
+        uint32_t i;
+        for(i = cache->item_cnt; i < item_cnt; i++) {
+            lv_memset_00(&items[i], sizeof(grid_item_t));
+            items[i].ignored = 1;
+        }
+
+        /*The items removed from the end were in a track whose size might have changed*/
+        for(i = item_cnt; i < cache->item_cnt; i++) {
+            if(cache->items[i].ignored) continue;
+            if(cache->items[i].col_pos < col_num) cache->col_content[cache->items[i].col_pos] = LV_COORD_MIN;
+            if(cache->items[i].row_pos < row_num) cache->row_content[cache->items[i].row_pos] = LV_COORD_MIN;
+        }
+
+        cache->items = items;
+        cache->item_cnt = item_cnt;
     }
 
-    calc_rows(cont, calc_out);
-    calc_cols(cont, calc_out);
+    return true;
+}
+
+static void cache_event_cb(lv_event_t * e)
+{
+    grid_cache_t * cache = lv_event_get_user_data(e);
+    lv_mem_free(cache->calc.x);
+    lv_mem_free(cache->items);
+    lv_mem_free(cache);
+}
+
+/**
+ * Compare the children to the cached items and mark the changed ones.
+ * The cells of the changed items, both the old and the new one, are marked as invalid.
+ * @param cont      an object that has a grid
+ * @param cache     the cache of `cont`
+ * @param col_inv   set the invalid column flags here
+ * @param row_inv   set the invalid row flags here
+ */
+static void items_check(lv_obj_t * cont, grid_cache_t * cache, uint8_t * col_inv, uint8_t * row_inv)
+{
+    uint32_t col_num = cache->calc.col_num;
+    uint32_t row_num = cache->calc.row_num;
+    uint32_t i;
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        grid_item_t * cell = &cache->items[i];
+        grid_item_t new_cell;
+        lv_memset_00(&new_cell, sizeof(new_cell));
+        new_cell.obj = item;
+
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) {
+            new_cell.ignored = 1;
+        }
+        else {
+            new_cell.col_pos = get_col_pos(item);
+            new_cell.col_span = get_col_span(item);
+            new_cell.row_pos = get_row_pos(item);
+            new_cell.row_span = get_row_span(item);
+            new_cell.x_align = get_cell_col_align(item);
+            new_cell.y_align = get_cell_row_align(item);
+            new_cell.tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
+            new_cell.tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+            new_cell.w = lv_obj_get_width(item);
+            new_cell.h = lv_obj_get_height(item);
+
+            /*Items out of the grid can't be placed*/
+            if(new_cell.col_span == 0 || new_cell.row_span == 0 ||
+               new_cell.col_pos + new_cell.col_span > col_num ||
+               new_cell.row_pos + new_cell.row_span > row_num) {
+                new_cell.ignored = 1;
+            }
+        }
+
+        bool changed = cell->obj != new_cell.obj || cell->ignored != new_cell.ignored;
+        if(!changed && !new_cell.ignored) {
+            changed = cell->col_pos != new_cell.col_pos || cell->col_span != new_cell.col_span ||
+                      cell->row_pos != new_cell.row_pos || cell->row_span != new_cell.row_span ||
+                      cell->x_align != new_cell.x_align || cell->y_align != new_cell.y_align ||
+                      cell->tr_x != new_cell.tr_x || cell->tr_y != new_cell.tr_y ||
+                      cell->w != new_cell.w || cell->h != new_cell.h;
+        }
+
+        if(changed) {
+            /*Only the items spanning 1 track have effect on the CONTENT tracks*/
+            if(!cell->ignored) {
+                if(cell->col_span == 1 && cell->col_pos < col_num) col_inv[cell->col_pos] = 1;
+                if(cell->row_span == 1 && cell->row_pos < row_num) row_inv[cell->row_pos] = 1;
+            }
+            if(!new_cell.ignored) {
+                if(new_cell.col_span == 1) col_inv[new_cell.col_pos] = 1;
+                if(new_cell.row_span == 1) row_inv[new_cell.row_pos] = 1;
+            }
+
+            /*The placed position is kept until the item is placed again*/
+            new_cell.x = cell->x;
+            new_cell.y = cell->y;
+            new_cell.changed = 1;
+            *cell = new_cell;
+        }
+        else {
+            cell->changed = 0;
+        }
+    }
+}
+
+/**
+ * Recalculate the size of the invalid CONTENT tracks from the size of their items.
+ * @param cache     the cache of the container
+ * @param templ     the column or row template of the container
+ * @param col       true: process the columns; false: process the rows
+ * @param inv       the flags of the invalid tracks
+ */
+static void calc_content(grid_cache_t * cache, const lv_coord_t * templ, bool col, const uint8_t * inv)
+{
+    uint32_t track_num = col ? cache->calc.col_num : cache->calc.row_num;
+    lv_coord_t * content = col ? cache->col_content : cache->row_content;
+
+    /*Mark the CONTENT tracks to recalculate and skip the item scan if there is none*/
+    bool any = false;
+    uint32_t i;
+    for(i = 0; i < track_num; i++) {
+        if(!IS_CONTENT(templ[i])) {
+            content[i] = LV_COORD_MIN;
+            continue;
+        }
+        if(inv[i] || content[i] == LV_COORD_MIN) {
+            content[i] = LV_COORD_MIN;
+            any = true;
+        }
+    }
+    if(!any) return;
+
+    /*Check the size of the items in the invalid tracks*/
+    lv_coord_t * new_content = lv_mem_buf_get(sizeof(lv_coord_t) * track_num);
+    for(i = 0; i < track_num; i++) new_content[i] = 0;
+
+    for(i = 0; i < cache->item_cnt; i++) {
+        grid_item_t * cell = &cache->items[i];
+        if(cell->ignored) continue;
+        uint32_t span = col ? cell->col_span : cell->row_span;
+        if(span != 1) continue;
+
+        uint32_t pos = col ? cell->col_pos : cell->row_pos;
+        if(content[pos] != LV_COORD_MIN) continue;
+
+        lv_coord_t size = col ? cell->w : cell->h;
+        new_content[pos] = LV_MAX(new_content[pos], size);
+    }
+
+    for(i = 0; i < track_num; i++) {
+        if(content[i] == LV_COORD_MIN && IS_CONTENT(templ[i])) content[i] = new_content[i];
+    }
+
+    lv_mem_buf_release(new_content);
+}
+
+/**
+ * Calculate the grid cells coordinates
+ * @param cont      an object that has a grid
+ * @param cache     the cache of `cont` with the up to date content track sizes. The cells coordinates are updated here.
+ * @param col_moved set the flags of the columns which were moved or resized here
+ * @param row_moved set the flags of the rows which were moved or resized here
+ */
+static void calc(lv_obj_t * cont, grid_cache_t * cache, uint8_t * col_moved, uint8_t * row_moved)
+{
+    _lv_grid_calc_t * c = &cache->calc;
+    uint32_t track_num = c->col_num + c->row_num;
+    lv_coord_t * buf = lv_mem_buf_get(sizeof(lv_coord_t) * track_num * 2);
+    lv_coord_t * x = buf;
+    lv_coord_t * w = x + c->col_num;
+    lv_coord_t * y = w + c->col_num;
+    lv_coord_t * h = y + c->row_num;
+
+    calc_rows(cont, cache, h);
+    calc_cols(cont, cache, w);
 
     lv_coord_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
     lv_coord_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
@@ -376,88 +655,68 @@ static void calc(lv_obj_t * cont, _lv_grid_calc_t * calc_out)
     lv_coord_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
     bool auto_w = (w_set == LV_SIZE_CONTENT && !cont->w_layout) ? true : false;
     lv_coord_t cont_w = lv_obj_get_content_width(cont);
-    calc_out->grid_w = grid_align(cont_w, auto_w, get_grid_col_align(cont), col_gap, calc_out->col_num, calc_out->w, calc_out->x, rev);
+    c->grid_w = grid_align(cont_w, auto_w, get_grid_col_align(cont), col_gap, c->col_num, w, x, rev);
 
     bool auto_h = (h_set == LV_SIZE_CONTENT && !cont->h_layout) ? true : false;
     lv_coord_t cont_h = lv_obj_get_content_height(cont);
-    calc_out->grid_h = grid_align(cont_h, auto_h, get_grid_row_align(cont), row_gap, calc_out->row_num, calc_out->h, calc_out->y, false);
+    c->grid_h = grid_align(cont_h, auto_h, get_grid_row_align(cont), row_gap, c->row_num, h, y, false);
 
-    LV_ASSERT_MEM_INTEGRITY();
-}
+    /*Save the new tracks and mark the ones which has changed*/
+    uint32_t i;
+    for(i = 0; i < c->col_num; i++) {
+        col_moved[i] = c->x[i] != x[i] || c->w[i] != w[i];
+        c->x[i] = x[i];
+        c->w[i] = w[i];
+    }
 
-/**
- * Free the a grid calculation's data
- * @param calc pointer to the calculated gtrid cell coordinates
- */
-static void calc_free(_lv_grid_calc_t * calc)
-{
-    lv_mem_buf_release(calc->x);
-    lv_mem_buf_release(calc->y);
-    lv_mem_buf_release(calc->w);
-    lv_mem_buf_release(calc->h);
+    for(i = 0; i < c->row_num; i++) {
+        row_moved[i] = c->y[i] != y[i] || c->h[i] != h[i];
+        c->y[i] = y[i];
+        c->h[i] = h[i];
+    }
+
+    lv_mem_buf_release(buf);
+
+    LV_ASSERT_MEM_INTEGRITY();
 }
 
-static void calc_cols(lv_obj_t * cont, _lv_grid_calc_t * c)
+static void calc_cols(lv_obj_t * cont, grid_cache_t * cache, lv_coord_t * w)
 {
     const lv_coord_t * col_templ = get_col_dsc(cont);
     lv_coord_t cont_w = lv_obj_get_content_width(cont);
+    uint32_t col_num = cache->calc.col_num;
 
-    c->col_num = count_tracks(col_templ);
-    c->x = lv_mem_buf_get(sizeof(lv_coord_t) * c->col_num);
-    c->w = lv_mem_buf_get(sizeof(lv_coord_t) * c->col_num);
-
-    /*Set sizes for CONTENT cells*/
     uint32_t i;
-    for(i = 0; i < c->col_num; i++) {
-        lv_coord_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_cnt(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
-        }
-    }
-
     uint32_t col_fr_cnt = 0;
     lv_coord_t grid_w = 0;
 
-    for(i = 0; i < c->col_num; i++) {
+    for(i = 0; i < col_num; i++) {
         lv_coord_t x = col_templ[i];
         if(IS_FR(x)) {
             col_fr_cnt += GET_FR(x);
         }
         else if (IS_CONTENT(x)) {
-            grid_w += c->w[i];
+            w[i] = cache->col_content[i];
+            grid_w += w[i];
         }
         else {
-            c->w[i] = x;
+            w[i] = x;
             grid_w += x;
         }
     }
 
     lv_coord_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
-    cont_w -= col_gap * (c->col_num - 1);
+    cont_w -= col_gap * (col_num - 1);
     lv_coord_t free_w = cont_w - grid_w;
     if(free_w < 0) free_w = 0;
 
     int32_t last_fr_i = -1;
     int32_t last_fr_x = 0;
-    for(i = 0; i < c->col_num; i++) {
+    for(i = 0; i < col_num; i++) {
         lv_coord_t x = col_templ[i];
         if(IS_FR(x)) {
             lv_coord_t f = GET_FR(x);
-            c->w[i] = (free_w * f) / col_fr_cnt;
+            w[i] = (free_w * f) / col_fr_cnt;
             last_fr_i = i;
             last_fr_x = f;
         }
@@ -465,94 +724,85 @@ static void calc_cols(lv_obj_t * cont, _lv_grid_calc_t * c)
 
     /*To avoid rounding errors set the last FR track to the remaining size */
     if(last_fr_i >= 0) {
-    	c->w[last_fr_i] = free_w - ((free_w * (col_fr_cnt - last_fr_x)) / col_fr_cnt);
+    	w[last_fr_i] = free_w - ((free_w * (col_fr_cnt - last_fr_x)) / col_fr_cnt);
     }
 }
 
-static void calc_rows(lv_obj_t * cont, _lv_grid_calc_t * c)
+static void calc_rows(lv_obj_t * cont, grid_cache_t * cache, lv_coord_t * h)
 {
     uint32_t i;
     const lv_coord_t * row_templ = get_row_dsc(cont);
-    c->row_num = count_tracks(row_templ);
-    c->y = lv_mem_buf_get(sizeof(lv_coord_t) * c->row_num);
-    c->h = lv_mem_buf_get(sizeof(lv_coord_t) * c->row_num);
-    /*Set sizes for CONTENT cells*/
-    for(i = 0; i < c->row_num; i++) {
-        lv_coord_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_cnt(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
-        }
-    }
+    uint32_t row_num = cache->calc.row_num;
 
     uint32_t row_fr_cnt = 0;
     lv_coord_t grid_h = 0;
 
-    for(i = 0; i < c->row_num; i++) {
+    for(i = 0; i < row_num; i++) {
         lv_coord_t x = row_templ[i];
         if(IS_FR(x)) {
             row_fr_cnt += GET_FR(x);
         } else if (IS_CONTENT(x)) {
-            grid_h += c->h[i];
+            h[i] = cache->row_content[i];
+            grid_h += h[i];
         } else {
-            c->h[i] = x;
+            h[i] = x;
             grid_h += x;
         }
     }
 
 
     lv_coord_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
-    lv_coord_t cont_h = lv_obj_get_content_height(cont) - row_gap * (c->row_num - 1);
+    lv_coord_t cont_h = lv_obj_get_content_height(cont) - row_gap * (row_num - 1);
     lv_coord_t free_h = cont_h - grid_h;
     if(free_h < 0) free_h = 0;
 
     int32_t last_fr_i = -1;
     int32_t last_fr_x = 0;
-    for(i = 0; i < c->row_num; i++) {
+    for(i = 0; i < row_num; i++) {
         lv_coord_t x = row_templ[i];
         if(IS_FR(x)) {
             lv_coord_t f = GET_FR(x);
-            c->h[i] = (free_h * f) / row_fr_cnt;
+            h[i] = (free_h * f) / row_fr_cnt;
         }
     }
 
     /*To avoid rounding errors set the last FR track to the remaining size */
     if(last_fr_i >= 0) {
-    	c->h[last_fr_i] = free_h - ((free_h * (row_fr_cnt - last_fr_x)) / row_fr_cnt);
+    	h[last_fr_i] = free_h - ((free_h * (row_fr_cnt - last_fr_x)) / row_fr_cnt);
     }
 }
 
+/**
+ * Tell whether any of the tracks of a cell was moved or resized
+ * @param moved     the flags of the moved tracks
+ * @param pos       index of the first track of the cell
+ * @param span      number of tracks in the cell
+ * @return          true: the cell has changed
+ */
+static bool tracks_moved(const uint8_t * moved, uint32_t pos, uint32_t span)
+{
+    uint32_t i;
+    for(i = pos; i < pos + span; i++) {
+        if(moved[i]) return true;
+    }
+    return false;
+}
+
 /**
  * Reposition a grid item in its cell
  * @param item a grid item to reposition
+ * @param cell the cached cell of the item. The new position and size of the item is saved here.
  * @param calc the calculated grid of `cont`
- * @param child_id_ext helper value if the ID of the child is know (order from the oldest) else -1
  * @param grid_abs helper value, the absolute position of the grid, NULL if unknown
  */
-static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t * hint)
+static void item_repos(lv_obj_t * item, grid_item_t * cell, _lv_grid_calc_t * c, item_repos_hint_t * hint)
 {
-    if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
-    uint32_t col_span = get_col_span(item);
-    uint32_t row_span = get_row_span(item);
-    if(row_span == 0 || col_span == 0) return;
-
-    uint32_t col_pos = get_col_pos(item);
-    uint32_t row_pos = get_row_pos(item);
-    lv_grid_align_t col_align = get_cell_col_align(item);
-    lv_grid_align_t row_align = get_cell_row_align(item);
+    uint32_t col_span = cell->col_span;
+    uint32_t row_span = cell->row_span;
+    uint32_t col_pos = cell->col_pos;
+    uint32_t row_pos = cell->row_pos;
+    lv_grid_align_t col_align = cell->x_align;
+    lv_grid_align_t row_align = cell->y_align;
 
 
     lv_coord_t col_x1 = c->x[col_pos];
@@ -631,8 +881,8 @@ static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t *
     }
 
     /*Handle percentage value of translate*/
-    lv_coord_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-    lv_coord_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+    lv_coord_t tr_x = cell->tr_x;
+    lv_coord_t tr_y = cell->tr_y;
     lv_coord_t w = lv_obj_get_width(item);
     lv_coord_t h = lv_obj_get_height(item);
     if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
@@ -652,6 +902,12 @@ static void item_repos(lv_obj_t * item, _lv_grid_calc_t * c, item_repos_hint_t *
         lv_obj_invalidate(item);
         lv_obj_move_children_by(item, diff_x, diff_y, true);
     }
+
+    cell->x = x;
+    cell->y = y;
+    cell->w = w;
+    cell->h = h;
+    cell->changed = 0;
 }
 
 /**
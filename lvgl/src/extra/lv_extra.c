@@ -41,6 +41,10 @@ void lv_extra_init(void)
 #if LV_USE_GRID
     lv_grid_init();
 #endif
+
+#if LV_USE_SNAPSHOT
+    _lv_snapshot_layer_init();
+#endif
 }
 
 /**********************
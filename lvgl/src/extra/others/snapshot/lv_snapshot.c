@@ -12,6 +12,8 @@
 #include <stdbool.h>
 #include "../../../core/lv_disp.h"
 #include "../../../core/lv_refr.h"
+#include "../../../draw/lv_img_cache.h"
+#include "../../../misc/lv_gc.h"
 /*********************
  *      DEFINES
  *********************/
@@ -20,9 +22,29 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_obj_t * obj;
+    lv_img_dsc_t img;       /*The cached content. `data` is NULL if not allocated yet*/
+    lv_area_t dirty;        /*The area of the cache to redraw*/
+    lv_coord_t ext;         /*Extra size on the sides of the object, e.g. for shadows*/
+    uint16_t angle;
+    uint16_t zoom;
+    lv_opa_t opa;
+    uint8_t has_dirty : 1;
+    uint8_t rendering : 1;  /*The object is being drawn into the cache*/
+    uint8_t keep_cache : 1; /*Only the drawing of the cache has changed*/
+} lv_snapshot_layer_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_snapshot_layer_t * layer_find(const lv_obj_t * obj);
+static void layer_event_cb(lv_event_t * e);
+static void layer_free(lv_snapshot_layer_t * layer);
+static void layer_mark_dirty(lv_snapshot_layer_t * layer, const lv_area_t * area);
+static bool layer_is_shown(lv_snapshot_layer_t * layer, lv_disp_t * disp);
+static void layer_render(lv_snapshot_layer_t * layer);
+static void layer_invalidate_drawing(lv_snapshot_layer_t * layer);
 
 /**********************
  *  STATIC VARIABLES
@@ -206,8 +228,458 @@ void lv_snapshot_free(lv_img_dsc_t * dsc)
     lv_mem_free(dsc);
 }
 
+/** Draw an object and its children through a layer.
+ *
+ * @param obj    The object to draw through a layer.
+ *
+ * @return LV_RES_OK on success, LV_RES_INV on error.
+ */
+lv_res_t lv_snapshot_layer_add(lv_obj_t * obj)
+{
+    LV_ASSERT_NULL(obj);
+
+    if(layer_find(obj)) return LV_RES_OK;
+
+    lv_snapshot_layer_t * layer = _lv_ll_ins_tail(&LV_GC_ROOT(_lv_snapshot_layer_ll));
+    LV_ASSERT_MALLOC(layer);
+    if(layer == NULL) return LV_RES_INV;
+
+    lv_memset_00(layer, sizeof(lv_snapshot_layer_t));
+    layer->obj = obj;
+    layer->opa = LV_OPA_COVER;
+    layer->zoom = LV_IMG_ZOOM_NONE;
+    layer->img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    layer->img.header.always_zero = 0;
+    layer->has_dirty = 1;   /*The whole cache will be drawn when it's allocated*/
+
+    lv_obj_add_event_cb(obj, layer_event_cb, LV_EVENT_ALL, layer);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_LAYER);
+
+    /*Get the size of the cache. It also invalidates the object if the size changes.*/
+    lv_obj_refresh_ext_draw_size(obj);
+    lv_obj_invalidate(obj);
+
+    return LV_RES_OK;
+}
+
+/** Draw the object directly again and free its layer.
+ *
+ * @param obj    The object with a layer.
+ */
+void lv_snapshot_layer_remove(lv_obj_t * obj)
+{
+    lv_snapshot_layer_t * layer = layer_find(obj);
+    if(layer == NULL) return;
+
+    layer->keep_cache = 1;
+    lv_obj_invalidate(obj);
+    lv_obj_remove_event_cb(obj, layer_event_cb);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_LAYER);
+    layer_free(layer);
+
+    lv_obj_refresh_ext_draw_size(obj);
+    lv_obj_invalidate(obj);
+}
+
+/** Set the opacity of the layer.
+ *
+ * @param obj    The object with a layer.
+ * @param opa    The opacity of the layer.
+ */
+void lv_snapshot_layer_set_opa(lv_obj_t * obj, lv_opa_t opa)
+{
+    lv_snapshot_layer_t * layer = layer_find(obj);
+    if(layer == NULL || layer->opa == opa) return;
+
+    layer->opa = opa;
+    layer_invalidate_drawing(layer);
+}
+
+/** Rotate the layer around the center of the object.
+ *
+ * @param obj    The object with a layer.
+ * @param angle  rotation angle in 0.1 degree (e.g. 450 means 45 degree).
+ */
+void lv_snapshot_layer_set_angle(lv_obj_t * obj, int16_t angle)
+{
+    lv_snapshot_layer_t * layer = layer_find(obj);
+    if(layer == NULL) return;
+
+    while(angle >= 3600) angle -= 3600;
+    while(angle < 0) angle += 3600;
+    if(layer->angle == angle) return;
+
+    layer->angle = angle;
+    layer_invalidate_drawing(layer);
+}
+
+/** Zoom the layer around the center of the object.
+ *
+ * @param obj    The object with a layer.
+ * @param zoom   256 or LV_IMG_ZOOM_NONE for no zoom, 512 for double size, 128 for half size.
+ */
+void lv_snapshot_layer_set_zoom(lv_obj_t * obj, uint16_t zoom)
+{
+    lv_snapshot_layer_t * layer = layer_find(obj);
+    if(layer == NULL) return;
+
+    if(zoom == 0) zoom = 1;
+    if(layer->zoom == zoom) return;
+
+    layer->zoom = zoom;
+    layer_invalidate_drawing(layer);
+}
+
+/** Initialize the layers. Called by LVGL on start up.
+ */
+void _lv_snapshot_layer_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_snapshot_layer_ll), sizeof(lv_snapshot_layer_t));
+}
+
+/** Mark the changed area of the layers an object belongs to.
+ *
+ * @param obj    The invalidated object.
+ * @param area   The invalidated area. If a layer is transformed it's replaced with the area of the layer.
+ * @param moved  true: `obj` was moved so its own layer (if any) doesn't change.
+ *
+ * @return the object whose area should be invalidated on the screen
+ */
+const lv_obj_t * _lv_snapshot_layer_invalidate(const lv_obj_t * obj, lv_area_t * area, bool moved)
+{
+    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_snapshot_layer_ll)) == NULL) return obj;
+
+    /*Clip the area like on drawing. Don't clip to the screen because the layers
+     *should be up to date when they are scrolled or moved in*/
+    lv_area_t obj_area;
+    lv_area_t changed;
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_area);
+    lv_area_increase(&obj_area, ext_size, ext_size);
+    if(!_lv_area_intersect(&changed, area, &obj_area)) return obj;
+
+    const lv_obj_t * inv_obj = obj;
+    const lv_obj_t * cur = obj;
+    while(cur) {
+        if(lv_obj_has_flag(cur, LV_OBJ_FLAG_LAYER) && !(cur == obj && moved)) {
+            lv_snapshot_layer_t * layer = layer_find(cur);
+            if(layer && !layer->rendering && !layer->keep_cache) {
+                layer_mark_dirty(layer, &changed);
+
+                /*The change of a transformed layer can be anywhere in its drawing*/
+                if(layer->angle || layer->zoom != LV_IMG_ZOOM_NONE) {
+                    ext_size = _lv_obj_get_ext_draw_size(cur);
+                    lv_obj_get_coords(cur, &changed);
+                    lv_area_increase(&changed, ext_size, ext_size);
+                    lv_area_copy(area, &changed);
+                    inv_obj = cur;
+                }
+            }
+        }
+
+        /*The children are drawn only on their parent*/
+        const lv_obj_t * parent = lv_obj_get_parent(cur);
+        if(parent && !_lv_area_intersect(&changed, &changed, &parent->coords)) break;
+        cur = parent;
+    }
+
+    return inv_obj;
+}
+
+/** Redraw the changed part of the layers shown on a display.
+ *
+ * @param disp   The display being refreshed.
+ */
+void _lv_snapshot_layer_refr(lv_disp_t * disp)
+{
+    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_snapshot_layer_ll)) == NULL) return;
+
+    /*Render the most inner layers first because the outer layers draw them from their cache*/
+    while(1) {
+        lv_snapshot_layer_t * layer;
+        lv_snapshot_layer_t * deepest = NULL;
+        uint32_t deepest_depth = 0;
+        _LV_LL_READ(&LV_GC_ROOT(_lv_snapshot_layer_ll), layer) {
+            if(!layer->has_dirty || layer->rendering) continue;
+            if(!layer_is_shown(layer, disp)) continue;
+
+            uint32_t depth = 0;
+            lv_obj_t * parent = lv_obj_get_parent(layer->obj);
+            while(parent) {
+                depth++;
+                parent = lv_obj_get_parent(parent);
+            }
+
+            if(deepest == NULL || depth > deepest_depth) {
+                deepest = layer;
+                deepest_depth = depth;
+            }
+        }
+
+        if(deepest == NULL) break;
+
+        layer_render(deepest);
+    }
+
+    /*Rendering the layers has changed the display being refreshed*/
+    _lv_refr_set_disp_refreshing(disp);
+}
+
+/** Draw a layer from its cache.
+ *
+ * @param obj    The object with a layer.
+ * @param clip   The layer will be drawn only in this area.
+ *
+ * @return LV_RES_OK: the layer was drawn; LV_RES_INV: the object should be drawn directly.
+ */
+lv_res_t _lv_snapshot_layer_draw(const lv_obj_t * obj, const lv_area_t * clip)
+{
+    lv_snapshot_layer_t * layer = layer_find(obj);
+    if(layer == NULL || layer->rendering || layer->has_dirty || layer->img.data == NULL) return LV_RES_INV;
+
+    /*The size has changed since the last render*/
+    lv_coord_t w = lv_obj_get_width(obj) + 2 * layer->ext;
+    lv_coord_t h = lv_obj_get_height(obj) + 2 * layer->ext;
+    if(w != layer->img.header.w || h != layer->img.header.h) return LV_RES_INV;
+
+    if(layer->opa <= LV_OPA_MIN) return LV_RES_OK;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_increase(&coords, layer->ext, layer->ext);
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    dsc.opa = layer->opa;
+    dsc.angle = layer->angle;
+    dsc.zoom = layer->zoom;
+    dsc.pivot.x = w / 2;
+    dsc.pivot.y = h / 2;
+    dsc.antialias = 1;
+    lv_draw_img(&coords, clip, &layer->img, &dsc);
+
+    return LV_RES_OK;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_snapshot_layer_t * layer_find(const lv_obj_t * obj)
+{
+    lv_snapshot_layer_t * layer;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_snapshot_layer_ll), layer) {
+        if(layer->obj == obj) return layer;
+    }
+
+    return NULL;
+}
+
+static void layer_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_snapshot_layer_t * layer = lv_event_get_user_data(e);
+
+    if(code == LV_EVENT_COVER_CHECK) {
+        /*Don't let the children be drawn directly as the top object*/
+        lv_cover_check_info_t * info = lv_event_get_param(e);
+        info->res = LV_COVER_RES_MASKED;
+    }
+    else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        /*The cache has the same extra size as the object*/
+        lv_coord_t * s = lv_event_get_param(e);
+        layer->ext = *s;
+
+        /*Provide enough room for the transformed cache*/
+        if(layer->angle || layer->zoom != LV_IMG_ZOOM_NONE) {
+            lv_coord_t w = lv_obj_get_width(obj) + 2 * layer->ext;
+            lv_coord_t h = lv_obj_get_height(obj) + 2 * layer->ext;
+            lv_point_t pivot;
+            pivot.x = w / 2;
+            pivot.y = h / 2;
+            lv_area_t a;
+            _lv_img_buf_get_transformed_area(&a, w, h, layer->angle, layer->zoom, &pivot);
+            *s = LV_MAX(*s, layer->ext - a.x1);
+            *s = LV_MAX(*s, layer->ext - a.y1);
+            *s = LV_MAX(*s, layer->ext + a.x2 - w + 1);
+            *s = LV_MAX(*s, layer->ext + a.y2 - h + 1);
+        }
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED) {
+        /*The size of the transformed area depends on the size of the object*/
+        if(layer->angle || layer->zoom != LV_IMG_ZOOM_NONE) lv_obj_refresh_ext_draw_size(obj);
+    }
+    else if(code == LV_EVENT_DELETE) {
+        layer_free(layer);
+    }
+}
+
+static void layer_free(lv_snapshot_layer_t * layer)
+{
+    lv_img_cache_invalidate_src(&layer->img);
+    if(layer->img.data) lv_mem_free((void *)layer->img.data);
+
+    _lv_ll_remove(&LV_GC_ROOT(_lv_snapshot_layer_ll), layer);
+    lv_mem_free(layer);
+}
+
+/**
+ * Add an area to the part of the cache to redraw
+ * @param layer pointer to a layer
+ * @param area the changed area in absolute coordinates
+ */
+static void layer_mark_dirty(lv_snapshot_layer_t * layer, const lv_area_t * area)
+{
+    lv_area_t a;
+    lv_area_copy(&a, area);
+    lv_area_move(&a, layer->ext - layer->obj->coords.x1, layer->ext - layer->obj->coords.y1);
+
+    if(layer->has_dirty) _lv_area_join(&layer->dirty, &layer->dirty, &a);
+    else lv_area_copy(&layer->dirty, &a);
+    layer->has_dirty = 1;
+}
+
+/**
+ * Check if a layer can be seen on a display.
+ * @param layer pointer to a layer
+ * @param disp pointer to a display
+ * @return true: the object is not hidden and it's on the active screen or on a layer of `disp`
+ */
+static bool layer_is_shown(lv_snapshot_layer_t * layer, lv_disp_t * disp)
+{
+    lv_obj_t * obj = layer->obj;
+    lv_obj_t * scr = obj;
+    while(1) {
+        if(lv_obj_has_flag(scr, LV_OBJ_FLAG_HIDDEN)) return false;
+        lv_obj_t * parent = lv_obj_get_parent(scr);
+        if(parent == NULL) break;
+        scr = parent;
+    }
+
+    return scr == lv_disp_get_scr_act(disp) || scr == lv_disp_get_scr_prev(disp) ||
+           scr == lv_disp_get_layer_top(disp) || scr == lv_disp_get_layer_sys(disp);
+}
+
+/**
+ * Redraw the dirty area of the cache of a layer.
+ * Like the snapshots the object is drawn with a temporary display. The object is moved to the
+ * top left corner of the display so the cache can be its draw buffer in full refresh mode
+ * and the dirty area can be redrawn without the rest.
+ * @param layer pointer to a layer
+ */
+static void layer_render(lv_snapshot_layer_t * layer)
+{
+    lv_obj_t * obj = layer->obj;
+    lv_coord_t w = lv_obj_get_width(obj) + 2 * layer->ext;
+    lv_coord_t h = lv_obj_get_height(obj) + 2 * layer->ext;
+
+    layer->has_dirty = 0;
+
+    if(layer->img.data == NULL || w != layer->img.header.w || h != layer->img.header.h) {
+        lv_img_cache_invalidate_src(&layer->img);
+        if(layer->img.data) lv_mem_free((void *)layer->img.data);
+
+        layer->img.data = NULL;
+        layer->img.data_size = 0;
+        layer->img.header.w = 0;
+        layer->img.header.h = 0;
+
+        /*Without cache the object is drawn directly*/
+        if(w <= 0 || h <= 0) return;
+        layer->img.data = lv_mem_alloc((uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        if(layer->img.data == NULL) {
+            LV_LOG_WARN("couldn't allocate the cache of the layer");
+            return;
+        }
+
+        layer->img.data_size = (uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        layer->img.header.w = w;
+        layer->img.header.h = h;
+        layer->dirty.x1 = 0;
+        layer->dirty.y1 = 0;
+        layer->dirty.x2 = w - 1;
+        layer->dirty.y2 = h - 1;
+    }
+
+    lv_area_t cache_area;
+    lv_area_t dirty;
+    lv_area_set(&cache_area, 0, 0, w - 1, h - 1);
+    if(!_lv_area_intersect(&dirty, &layer->dirty, &cache_area)) return;
+
+    /*Make the dirty area transparent*/
+    uint8_t * data = (uint8_t *)layer->img.data;
+    uint32_t row_size = lv_area_get_width(&dirty) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    lv_coord_t y;
+    for(y = dirty.y1; y <= dirty.y2; y++) {
+        lv_memset_00(&data[((uint32_t)y * w + dirty.x1) * LV_IMG_PX_SIZE_ALPHA_BYTE], row_size);
+    }
+
+    /*We are safe to use stack for below variables since disp will be
+     * unregistered when function returns. */
+    lv_disp_t * disp;
+    lv_disp_drv_t driver;
+    lv_disp_draw_buf_t draw_buf;
+
+    lv_disp_draw_buf_init(&draw_buf, data, NULL, (uint32_t)w * h);
+
+    lv_disp_drv_init(&driver);
+    driver.draw_buf = &draw_buf;
+    driver.hor_res = w;
+    driver.ver_res = h;
+    driver.full_refresh = 1;
+    lv_disp_drv_use_generic_set_px_cb(&driver, LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    disp = lv_disp_drv_register(&driver);
+    if(disp == NULL) return;
+
+    lv_disp_set_bg_opa(disp, LV_OPA_TRANSP);
+
+    /*Move obj to newly created disp to the top left corner*/
+    lv_obj_t * parent_old = lv_obj_get_parent(obj);
+    lv_obj_t * screen = lv_disp_get_scr_act(disp);
+    lv_obj_remove_style_all(screen);
+    lv_obj_allocate_spec_attr(screen);
+    screen->spec_attr->child_cnt = 1;
+    screen->spec_attr->children = &obj;
+
+    obj->parent = screen;
+
+    lv_coord_t x_ofs = layer->ext - obj->coords.x1;
+    lv_coord_t y_ofs = layer->ext - obj->coords.y1;
+    lv_area_move(&obj->coords, x_ofs, y_ofs);
+    lv_obj_move_children_by(obj, x_ofs, y_ofs, false);
+
+    /*Redraw only the dirty area*/
+    disp->inv_areas[0] = dirty;
+    disp->inv_p = 1;
+
+    layer->rendering = 1;
+    _lv_disp_refr_timer(disp->refr_timer);
+    layer->rendering = 0;
+
+    /*Restore obj original parameters and clean up*/
+    lv_area_move(&obj->coords, -x_ofs, -y_ofs);
+    lv_obj_move_children_by(obj, -x_ofs, -y_ofs, false);
+
+    obj->parent = parent_old;
+    screen->spec_attr->child_cnt = 0;
+    screen->spec_attr->children = NULL;
+
+    lv_disp_remove(disp);
+}
+
+/**
+ * Redraw the layer on the screen without changing its cache
+ * @param layer pointer to a layer
+ */
+static void layer_invalidate_drawing(lv_snapshot_layer_t * layer)
+{
+    layer->keep_cache = 1;
+    lv_obj_invalidate(layer->obj);
+    lv_obj_refresh_ext_draw_size(layer->obj);
+    lv_obj_invalidate(layer->obj);
+    layer->keep_cache = 0;
+}
+
 #endif /*LV_USE_SNAPSHOT*/
@@ -71,6 +71,80 @@ uint32_t lv_snapshot_buf_size_needed(lv_obj_t * obj, lv_img_cf_t cf);
  */
 lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t * dsc, void * buf, uint32_t buff_size);
 
+/** Draw an object and its children through a layer.
+ *
+ * The object is rendered into a cached ARGB image and only the changed parts of the image are
+ * redrawn when the object or its children change. The cached image is drawn to the screen with
+ * the opacity and transformation of the layer. Moving the object doesn't redraw the cache.
+ * The layer is deleted with the object.
+ *
+ * @param obj    The object to draw through a layer.
+ *
+ * @return LV_RES_OK on success, LV_RES_INV on error.
+ */
+lv_res_t lv_snapshot_layer_add(lv_obj_t * obj);
+
+/** Draw the object directly again and free its layer.
+ *
+ * @param obj    The object with a layer.
+ */
+void lv_snapshot_layer_remove(lv_obj_t * obj);
+
+/** Set the opacity of the layer. The object and its children are blended with this opacity
+ * as one image.
+ *
+ * @param obj    The object with a layer.
+ * @param opa    The opacity of the layer.
+ */
+void lv_snapshot_layer_set_opa(lv_obj_t * obj, lv_opa_t opa);
+
+/** Rotate the layer around the center of the object.
+ *
+ * Only the drawing is transformed, the clickable area remains the same.
+ *
+ * @param obj    The object with a layer.
+ * @param angle  rotation angle in 0.1 degree (e.g. 450 means 45 degree).
+ */
+void lv_snapshot_layer_set_angle(lv_obj_t * obj, int16_t angle);
+
+/** Zoom the layer around the center of the object.
+ *
+ * Only the drawing is transformed, the clickable area remains the same.
+ *
+ * @param obj    The object with a layer.
+ * @param zoom   256 or LV_IMG_ZOOM_NONE for no zoom, 512 for double size, 128 for half size.
+ */
+void lv_snapshot_layer_set_zoom(lv_obj_t * obj, uint16_t zoom);
+
+/** Initialize the layers. Called by LVGL on start up.
+ */
+void _lv_snapshot_layer_init(void);
+
+/** Mark the changed area of the layers an object belongs to.
+ *
+ * @param obj    The invalidated object.
+ * @param area   The invalidated area. If a layer is transformed it's replaced with the area of the layer.
+ * @param moved  true: `obj` was moved so its own layer (if any) doesn't change.
+ *
+ * @return the object whose area should be invalidated on the screen
+ */
+const lv_obj_t * _lv_snapshot_layer_invalidate(const lv_obj_t * obj, lv_area_t * area, bool moved);
+
+/** Redraw the changed part of the layers shown on a display.
+ *
+ * @param disp   The display being refreshed.
+ */
+void _lv_snapshot_layer_refr(lv_disp_t * disp);
+
+/** Draw a layer from its cache.
+ *
+ * @param obj    The object with a layer.
+ * @param clip   The layer will be drawn only in this area.
+ *
+ * @return LV_RES_OK: the layer was drawn; LV_RES_INV: the object should be drawn directly.
+ */
+lv_res_t _lv_snapshot_layer_draw(const lv_obj_t * obj, const lv_area_t * clip);
+
 
 /**********************
  *      MACROS
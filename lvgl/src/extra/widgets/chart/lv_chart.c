@@ -21,6 +21,13 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_ASYNC_QUEUE
+/*The series is the target of the update to cancel it when the series is removed*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_coord_t value;
+} next_value_async_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -31,6 +38,7 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj , const lv_area_t * mask);
 static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area);
+static bool line_dsc_is_equal(const lv_draw_line_dsc_t * dsc1, const lv_draw_line_dsc_t * dsc2);
 static void draw_series_bar(lv_obj_t * obj, const lv_area_t * clip_area);
 static void draw_series_scatter(lv_obj_t * obj, const lv_area_t * clip_area);
 static void draw_cursors(lv_obj_t * obj, const lv_area_t * clip_area);
@@ -39,6 +47,9 @@ static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x);
 static void invalidate_point(lv_obj_t * obj, uint16_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
+#if LV_USE_ASYNC_QUEUE
+static void next_value_async_cb(void * ser, void * data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -377,6 +388,11 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_mem_free(series->y_points);
 
+#if LV_USE_ASYNC_QUEUE
+    /*Drop the values posted by `lv_chart_set_next_value_async()` but not added yet*/
+    lv_async_post_cancel(series);
+#endif
+
     _lv_ll_remove(&chart->series_ll, series);
     lv_mem_free(series);
 
@@ -534,6 +550,18 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
     invalidate_point(obj, ser->start_point);
 }
 
+#if LV_USE_ASYNC_QUEUE
+lv_res_t lv_chart_set_next_value_async(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value)
+{
+    LV_ASSERT_NULL(ser);
+
+    next_value_async_t data;
+    data.obj = obj;
+    data.value = value;
+    return lv_async_post(next_value_async_cb, ser, &data, sizeof(data), false);
+}
+#endif
+
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t x_value, lv_coord_t y_value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -672,6 +700,10 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_mem_free(ser->y_points);
 
+#if LV_USE_ASYNC_QUEUE
+        lv_async_post_cancel(ser);
+#endif
+
         _lv_ll_remove(&chart->series_ll, ser);
         lv_mem_free(ser);
     }
@@ -879,6 +911,18 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
     /*If there are mire points than pixels draw only vertical lines*/
     bool crowded_mode = chart->point_cnt >= w ? true : false;
 
+    /*If there are no points to draw on the lines the connected lines are collected and drawn at once.
+     *Not if the user draws in `LV_EVENT_DRAW_PART_END` as the line needs to be drawn before it.
+     *The points are allocated from the heap to leave the buffers of `lv_mem_buf_get()` to the drawing.*/
+    bool poly_mode = !crowded_mode && (point_w == 0 || point_h == 0) && !lv_obj_has_event_cb(obj, LV_EVENT_DRAW_PART_END);
+    lv_point_t * poly_points = NULL;
+    uint16_t poly_cnt = 0;
+    lv_draw_line_dsc_t poly_dsc;
+    if(poly_mode) {
+        poly_points = lv_mem_alloc(chart->point_cnt * sizeof(lv_point_t));
+        if(poly_points == NULL) poly_mode = false;
+    }
+
     /*Go through all data lines*/
     _LV_LL_READ_BACK(&chart->series_ll, ser) {
         if (ser->hidden) continue;
@@ -962,7 +1006,23 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
                     lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
 
                     if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        lv_draw_line(&p1, &p2, &series_mask, &line_dsc_default);
+                        if(poly_mode) {
+                            /*Start a new line if it's not continuous or the user changed the line's style*/
+                            bool cont = poly_cnt > 0 && poly_points[poly_cnt - 1].x == p1.x &&
+                                        poly_points[poly_cnt - 1].y == p1.y && line_dsc_is_equal(&poly_dsc, &line_dsc_default);
+                            if(poly_cnt > 0 && !cont) {
+                                lv_draw_polyline(poly_points, poly_cnt, &series_mask, &poly_dsc);
+                                poly_cnt = 0;
+                            }
+                            if(poly_cnt == 0) {
+                                lv_memcpy_small(&poly_dsc, &line_dsc_default, sizeof(lv_draw_line_dsc_t));
+                                poly_points[poly_cnt++] = p1;
+                            }
+                            poly_points[poly_cnt++] = p2;
+                        }
+                        else {
+                            lv_draw_line(&p1, &p2, &series_mask, &line_dsc_default);
+                        }
                     }
 
                     if(point_w && point_h && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
@@ -976,6 +1036,11 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
             p_prev = p_act;
         }
 
+        if(poly_cnt > 0) {
+            lv_draw_polyline(poly_points, poly_cnt, &series_mask, &poly_dsc);
+            poly_cnt = 0;
+        }
+
         /*Draw the last point*/
         if(!crowded_mode && i == chart->point_cnt) {
 
@@ -997,6 +1062,16 @@ static void draw_series_line(lv_obj_t * obj, const lv_area_t * clip_area)
             }
         }
     }
+
+    if(poly_points) lv_mem_free(poly_points);
+}
+
+static bool line_dsc_is_equal(const lv_draw_line_dsc_t * dsc1, const lv_draw_line_dsc_t * dsc2)
+{
+    return dsc1->color.full == dsc2->color.full && dsc1->width == dsc2->width && dsc1->opa == dsc2->opa &&
+           dsc1->dash_width == dsc2->dash_width && dsc1->dash_gap == dsc2->dash_gap &&
+           dsc1->blend_mode == dsc2->blend_mode && dsc1->round_start == dsc2->round_start &&
+           dsc1->round_end == dsc2->round_end;
 }
 
 static void draw_series_scatter(lv_obj_t * obj, const lv_area_t * clip_area)
@@ -1731,5 +1806,13 @@ lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis)
     }
 }
 
+#if LV_USE_ASYNC_QUEUE
+static void next_value_async_cb(void * ser, void * data)
+{
+    next_value_async_t * d = data;
+    lv_chart_set_next_value(d->obj, ser, d->value);
+}
+#endif
+
 
 #endif
@@ -370,6 +370,18 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
  */
 void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value);
 
+#if LV_USE_ASYNC_QUEUE
+/**
+ * Set the next point's Y value from any thread. It's added in the next `lv_timer_handler()`.
+ * The values posted meanwhile are all added in order.
+ * @param obj       pointer to chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param value     the new value of the next data
+ * @return          LV_RES_OK: posted; LV_RES_INV: the queue is full
+ */
+lv_res_t lv_chart_set_next_value_async(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value);
+#endif
+
 /**
  * Set the next point's X and Y value according to the update mode policy.
  * @param obj       pointer to chart object
@@ -0,0 +1,792 @@
+/**
+ * @file lv_vlist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_vlist.h"
+#if LV_USE_VLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS &lv_vlist_class
+
+#define SCROLLBAR_MIN_SIZE      (LV_DPX(10))
+#define SCROLL_ANIM_TIME_MIN    200    /*ms*/
+#define SCROLL_ANIM_TIME_MAX    400    /*ms*/
+
+/*Measuring the new rows can make other rows visible. Measure them too but limit the number of rounds*/
+#define MEASURE_ROUND_MAX       4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void vlist_update(lv_obj_t * obj);
+static void scroll_set(lv_obj_t * obj, int32_t y);
+static void scroll_anim_cb(void * obj, int32_t v);
+static void scroll_anim_ready_cb(lv_anim_t * a);
+static lv_obj_t * row_bind(lv_obj_t * obj, uint32_t id);
+static void rows_release(lv_vlist_t * vlist, uint32_t first, uint32_t last);
+static bool row_measure(lv_vlist_t * vlist, uint32_t id, lv_coord_t h);
+static void row_size_event_cb(lv_event_t * e);
+static int32_t row_get_h(const lv_vlist_t * vlist, uint32_t id);
+static void pos_tree_build(lv_vlist_t * vlist);
+static void pos_tree_add(lv_vlist_t * vlist, uint32_t id, int32_t diff);
+static int32_t pos_get(const lv_vlist_t * vlist, uint32_t id);
+static uint32_t pos_find_row(const lv_vlist_t * vlist, int32_t y);
+static void get_scrollbar_area(lv_obj_t * obj, lv_scrollbar_mode_t sm, lv_area_t * area);
+static void draw_scrollbar(lv_obj_t * obj, lv_scrollbar_mode_t sm, const lv_area_t * clip_area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_vlist_class = {
+    .constructor_cb = lv_vlist_constructor,
+    .destructor_cb = lv_vlist_destructor,
+    .event_cb = lv_vlist_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_vlist_t),
+    .base_class = &lv_obj_class
+};
+
+/**********************
+ *      MACROS
+ **********************/
+#define LOWBIT(i)   ((i) & (~(i) + 1))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_vlist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin")
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_vlist_set_create_cb(lv_obj_t * obj, lv_vlist_create_cb_t create_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    /*The old row objects might be different so delete them*/
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        lv_obj_del(vlist->row_objs[i].obj);
+    }
+    lv_mem_free(vlist->row_objs);
+    vlist->row_objs = NULL;
+    vlist->row_obj_cnt = 0;
+
+    vlist->create_cb = create_cb;
+    vlist_update(obj);
+}
+
+void lv_vlist_set_bind_cb(lv_obj_t * obj, lv_vlist_bind_cb_t bind_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->bind_cb = bind_cb;
+    lv_vlist_refresh(obj);
+}
+
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    int32_t y = lv_vlist_get_scroll_y(obj);
+
+    lv_coord_t * row_h = lv_mem_realloc(vlist->row_h, cnt * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(row_h);
+    if(row_h) vlist->row_h = row_h;
+
+    int32_t * pos_tree = lv_mem_realloc(vlist->pos_tree, (cnt + 1) * sizeof(int32_t));
+    LV_ASSERT_MALLOC(pos_tree);
+    if(pos_tree) vlist->pos_tree = pos_tree;
+
+    /*Keep the rows if the arrays couldn't grow. If they couldn't shrink the old ones are large enough.*/
+    if(cnt > vlist->row_cnt && (row_h == NULL || pos_tree == NULL)) return;
+
+    /*The new rows are not measured yet*/
+    uint32_t i;
+    for(i = vlist->row_cnt; i < cnt; i++) vlist->row_h[i] = -1;
+    vlist->row_cnt = cnt;
+    pos_tree_build(vlist);
+
+    if(cnt) rows_release(vlist, 0, cnt - 1);
+    else rows_release(vlist, LV_VLIST_ID_NONE, 0);
+
+    /*Don't leave the view beyond the last row*/
+    int32_t y_max = lv_vlist_get_content_height(obj) - lv_obj_get_content_height(obj);
+    if(y > y_max) y = y_max;
+    if(y < 0) y = 0;
+    scroll_set(obj, y);
+}
+
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_h_est == h) return;
+
+    vlist->row_h_est = h;
+    pos_tree_build(vlist);
+    vlist_update(obj);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_vlist_get_row_cnt(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return vlist->row_cnt;
+}
+
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t id)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(id == LV_VLIST_ID_NONE) return NULL;
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        if(vlist->row_objs[i].id == id) return vlist->row_objs[i].obj;
+    }
+
+    return NULL;
+}
+
+uint32_t lv_vlist_get_row_id(const lv_obj_t * obj, const lv_obj_t * row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        if(vlist->row_objs[i].obj == row) return vlist->row_objs[i].id;
+    }
+
+    return LV_VLIST_ID_NONE;
+}
+
+int32_t lv_vlist_get_scroll_y(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return pos_get(vlist, vlist->base_id) + lv_obj_get_scroll_y(obj);
+}
+
+int32_t lv_vlist_get_content_height(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == 0) return 0;
+
+    /*There is no gap after the last row*/
+    return pos_get(vlist, vlist->row_cnt) - vlist->row_gap;
+}
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_vlist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    /*The data has changed so the measured heights are not valid anymore*/
+    uint32_t i;
+    for(i = 0; i < vlist->row_cnt; i++) vlist->row_h[i] = -1;
+    pos_tree_build(vlist);
+
+    rows_release(vlist, LV_VLIST_ID_NONE, 0);
+    vlist_update(obj);
+}
+
+void lv_vlist_refresh_row(lv_obj_t * obj, uint32_t id)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(id >= vlist->row_cnt) return;
+
+    lv_obj_t * row = lv_vlist_get_row(obj, id);
+    if(row == NULL) {
+        /*Measure it again when it becomes visible*/
+        int32_t h_prev = row_get_h(vlist, id);
+        vlist->row_h[id] = -1;
+        pos_tree_add(vlist, id, row_get_h(vlist, id) - h_prev);
+        vlist_update(obj);
+        return;
+    }
+
+    if(vlist->bind_cb) vlist->bind_cb(obj, row, id);
+
+    /*If the height of the row has changed `row_size_event_cb` updates the list*/
+    lv_obj_update_layout(row);
+}
+
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t id, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == 0) return;
+    if(id >= vlist->row_cnt) id = vlist->row_cnt - 1;
+
+    lv_anim_del(obj, scroll_anim_cb);
+
+    int32_t y = pos_get(vlist, id);
+    int32_t y_max = lv_vlist_get_content_height(obj) - lv_obj_get_content_height(obj);
+    if(y > y_max) y = y_max;
+    if(y < 0) y = 0;
+
+    int32_t y_act = lv_vlist_get_scroll_y(obj);
+    if(anim_en == LV_ANIM_OFF || y == y_act) {
+        scroll_set(obj, y);
+        return;
+    }
+
+    /*The rows on the way are measured so the target can move. Scroll to the row again at the end.*/
+    vlist->scroll_target_id = id;
+
+    lv_disp_t * d = lv_obj_get_disp(obj);
+    uint32_t t = lv_anim_speed_to_time((lv_disp_get_ver_res(d) * 2) >> 2, 0, LV_ABS(y - y_act));
+    if(t < SCROLL_ANIM_TIME_MIN) t = SCROLL_ANIM_TIME_MIN;
+    if(t > SCROLL_ANIM_TIME_MAX) t = SCROLL_ANIM_TIME_MAX;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_values(&a, y_act, y);
+    lv_anim_set_time(&a, t);
+    lv_anim_set_exec_cb(&a, scroll_anim_cb);
+    lv_anim_set_ready_cb(&a, scroll_anim_ready_cb);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    vlist->create_cb = NULL;
+    vlist->bind_cb = NULL;
+    vlist->row_objs = NULL;
+    vlist->row_h = NULL;
+    vlist->pos_tree = NULL;
+    vlist->row_cnt = 0;
+    vlist->row_obj_cnt = 0;
+    vlist->base_id = 0;
+    vlist->scroll_target_id = 0;
+    vlist->row_h_est = LV_DPI_DEF / 3;
+    vlist->row_gap = 0;
+    vlist->updating = 0;
+
+    /*The scroll position is set directly*/
+    lv_obj_allocate_spec_attr(obj);
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_mem_free(vlist->row_objs);
+    lv_mem_free(vlist->row_h);
+    lv_mem_free(vlist->pos_tree);
+    vlist->row_objs = NULL;
+    vlist->row_h = NULL;
+    vlist->pos_tree = NULL;
+}
+
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_res_t res;
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(code == LV_EVENT_DRAW_POST) {
+        /*The scrollbar of the base object would show only the rows around the view*/
+        lv_scrollbar_mode_t sm = lv_obj_get_scrollbar_mode(obj);
+        obj->spec_attr->scrollbar_mode = LV_SCROLLBAR_MODE_OFF;
+        res = lv_obj_event_base(MY_CLASS, e);
+        obj->spec_attr->scrollbar_mode = sm;
+        if(res != LV_RES_OK) return;
+
+        draw_scrollbar(obj, sm, lv_event_get_param(e));
+        return;
+    }
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RES_OK) return;
+
+    if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        vlist_update(obj);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        lv_coord_t row_gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+        if(vlist->row_gap != row_gap) {
+            vlist->row_gap = row_gap;
+            pos_tree_build(vlist);
+            vlist_update(obj);
+        }
+    }
+    else if(code == LV_EVENT_SCROLL_BEGIN) {
+        /*The user has started to scroll*/
+        if(lv_event_get_param(e) == NULL) lv_anim_del(obj, scroll_anim_cb);
+        lv_obj_invalidate(obj);
+    }
+    else if(code == LV_EVENT_SCROLL_END) {
+        /*Hide the scrollbar in LV_SCROLLBAR_MODE_ACTIVE*/
+        lv_obj_invalidate(obj);
+    }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        if(vlist->row_cnt == 0) return;
+
+        /*Only a window around the current rows is scrollable. It's moved as the list is scrolled*/
+        lv_coord_t view_h = lv_obj_get_content_height(obj);
+        int32_t h = lv_vlist_get_content_height(obj) - pos_get(vlist, vlist->base_id);
+        int32_t h_max = lv_obj_get_scroll_y(obj) + view_h * 3;
+        if(h > h_max) h = h_max;
+        if(h > LV_COORD_MAX) h = LV_COORD_MAX;
+        p->y = LV_MAX(p->y, h);
+    }
+}
+
+/**
+ * Bind the visible rows, measure them, move the window of the scroll position and position the row objects
+ * @param obj   pointer to a virtual list
+ */
+static void vlist_update(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    if(vlist->updating) return;
+    vlist->updating = 1;
+
+    /*Be sure the size of the list is up to date*/
+    lv_obj_update_layout(obj);
+
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+    int32_t y = lv_vlist_get_scroll_y(obj);
+
+    if(vlist->row_cnt == 0 || vlist->create_cb == NULL || vlist->bind_cb == NULL) {
+        rows_release(vlist, LV_VLIST_ID_NONE, 0);
+        vlist->base_id = 0;
+        y = 0;
+    }
+    else {
+        /*Keep a row in place which was already visible.
+         *This way the view doesn't jump if the rows above it get their real height now.*/
+        uint32_t first = pos_find_row(vlist, LV_MAX(y, 0));
+        uint32_t last = pos_find_row(vlist, LV_MAX(y + view_h - 1, 0));
+        uint32_t anchor_id = LV_VLIST_ID_NONE;
+        uint32_t i;
+        for(i = 0; i < vlist->row_obj_cnt; i++) {
+            uint32_t id = vlist->row_objs[i].id;
+            if(id >= first && id <= last && (anchor_id == LV_VLIST_ID_NONE || id < anchor_id)) anchor_id = id;
+        }
+        if(anchor_id == LV_VLIST_ID_NONE) anchor_id = first;
+        int32_t anchor_ofs = y - pos_get(vlist, anchor_id);
+
+        uint32_t round;
+        for(round = 0; round < MEASURE_ROUND_MAX; round++) {
+            y = pos_get(vlist, anchor_id) + anchor_ofs;
+            first = pos_find_row(vlist, LV_MAX(y, 0));
+            last = pos_find_row(vlist, LV_MAX(y + view_h - 1, 0));
+            rows_release(vlist, first, last);
+
+            /*The heights can be changed by `row_size_event_cb` too so compare the positions*/
+            int32_t anchor_y = pos_get(vlist, anchor_id);
+            int32_t end_y = pos_get(vlist, last + 1);
+            uint32_t id;
+            for(id = first; id <= last; id++) {
+                lv_obj_t * row = row_bind(obj, id);
+                if(row == NULL) break;
+                row_measure(vlist, id, lv_obj_get_height(row));
+            }
+
+            if(anchor_y == pos_get(vlist, anchor_id) && end_y == pos_get(vlist, last + 1)) break;
+        }
+    }
+
+    /*Keep the scroll position of the object small by making it relative to a row before the view.
+     *Move the base only if the scroll position is too close to the top or too far to avoid moving the rows all the time.*/
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(obj);
+    int32_t base_y = pos_get(vlist, vlist->base_id);
+    if((vlist->base_id > 0 && y - base_y < view_h / 2) || y - base_y > view_h * 2 || y < base_y) {
+        vlist->base_id = pos_find_row(vlist, LV_MAX(y - view_h, 0));
+        base_y = pos_get(vlist, vlist->base_id);
+    }
+
+    if(scroll_y != y - base_y) {
+        obj->spec_attr->scroll.y = -(y - base_y);
+        _lv_obj_child_index_invalidate(obj);
+    }
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        if(vlist->row_objs[i].id == LV_VLIST_ID_NONE) continue;
+        lv_obj_t * row = vlist->row_objs[i].obj;
+        lv_obj_set_y(row, pos_get(vlist, vlist->row_objs[i].id) - base_y);
+        lv_obj_refr_pos(row);
+    }
+
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+
+    vlist->updating = 0;
+}
+
+/**
+ * Scroll the list to a position in the whole list
+ * @param obj   pointer to a virtual list
+ * @param y     the new scroll position
+ */
+static void scroll_set(lv_obj_t * obj, int32_t y)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->base_id = pos_find_row(vlist, LV_MAX(y, 0));
+    obj->spec_attr->scroll.y = -(y - pos_get(vlist, vlist->base_id));
+    _lv_obj_child_index_invalidate(obj);
+
+    vlist_update(obj);
+    lv_event_send(obj, LV_EVENT_SCROLL, NULL);
+}
+
+static void scroll_anim_cb(void * obj, int32_t v)
+{
+    scroll_set(obj, v);
+}
+
+static void scroll_anim_ready_cb(lv_anim_t * a)
+{
+    lv_obj_t * obj = a->var;
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    if(vlist->scroll_target_id < vlist->row_cnt) {
+        lv_vlist_scroll_to_row(obj, vlist->scroll_target_id, LV_ANIM_OFF);
+    }
+}
+
+/**
+ * Get a row object showing a row. Reuse a free row object or create a new one if required.
+ * @param obj   pointer to a virtual list
+ * @param id    ID of the row to show
+ * @return      the row object or NULL on error
+ */
+static lv_obj_t * row_bind(lv_obj_t * obj, uint32_t id)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    _lv_vlist_row_t * free_row = NULL;
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        if(vlist->row_objs[i].id == id) return vlist->row_objs[i].obj;
+        if(free_row == NULL && vlist->row_objs[i].id == LV_VLIST_ID_NONE) free_row = &vlist->row_objs[i];
+    }
+
+    if(free_row == NULL) {
+        lv_obj_t * row = vlist->create_cb(obj);
+        if(row == NULL) return NULL;
+        LV_ASSERT_MSG(lv_obj_get_parent(row) == obj, "The rows should be created on the virtual list");
+
+        _lv_vlist_row_t * row_objs = lv_mem_realloc(vlist->row_objs, (vlist->row_obj_cnt + 1) * sizeof(_lv_vlist_row_t));
+        LV_ASSERT_MALLOC(row_objs);
+        if(row_objs == NULL) {
+            lv_obj_del(row);
+            return NULL;
+        }
+
+        vlist->row_objs = row_objs;
+        free_row = &vlist->row_objs[vlist->row_obj_cnt];
+        vlist->row_obj_cnt++;
+        free_row->obj = row;
+        lv_obj_add_event_cb(row, row_size_event_cb, LV_EVENT_SIZE_CHANGED, NULL);
+    }
+
+    free_row->id = id;
+    lv_obj_clear_flag(free_row->obj, LV_OBJ_FLAG_HIDDEN);
+    vlist->bind_cb(obj, free_row->obj, id);
+    lv_obj_update_layout(free_row->obj);
+
+    return free_row->obj;
+}
+
+/**
+ * Hide the row objects which are not showing a row in a range and mark them as free
+ * @param vlist     pointer to a virtual list
+ * @param first     the first row to keep
+ * @param last      the last row to keep
+ */
+static void rows_release(lv_vlist_t * vlist, uint32_t first, uint32_t last)
+{
+    uint32_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        uint32_t id = vlist->row_objs[i].id;
+        if(id == LV_VLIST_ID_NONE) continue;
+        if(id >= first && id <= last && id < vlist->row_cnt) continue;
+
+        vlist->row_objs[i].id = LV_VLIST_ID_NONE;
+        lv_obj_add_flag(vlist->row_objs[i].obj, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * Save the measured height of a row
+ * @param vlist     pointer to a virtual list
+ * @param id        ID of the row
+ * @param h         the measured height
+ * @return          true: the position of the next rows has changed
+ */
+static bool row_measure(lv_vlist_t * vlist, uint32_t id, lv_coord_t h)
+{
+    int32_t h_prev = row_get_h(vlist, id);
+    vlist->row_h[id] = h;
+    int32_t diff = row_get_h(vlist, id) - h_prev;
+    if(diff == 0) return false;
+
+    pos_tree_add(vlist, id, diff);
+    return true;
+}
+
+/**
+ * Follow the size change of the row objects, e.g. when the content of a row is changed later.
+ */
+static void row_size_event_cb(lv_event_t * e)
+{
+    lv_obj_t * row = lv_event_get_target(e);
+    lv_obj_t * obj = lv_obj_get_parent(row);
+    if(obj == NULL || lv_obj_check_type(obj, MY_CLASS) == false) return;
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    uint32_t id = lv_vlist_get_row_id(obj, row);
+    if(id == LV_VLIST_ID_NONE) return;
+
+    if(row_measure(vlist, id, lv_obj_get_height(row))) vlist_update(obj);
+}
+
+/**
+ * Get the height of a row with the row gap
+ * @param vlist     pointer to a virtual list
+ * @param id        ID of the row
+ * @return          the measured or estimated height + the row gap
+ */
+static int32_t row_get_h(const lv_vlist_t * vlist, uint32_t id)
+{
+    lv_coord_t h = vlist->row_h[id] >= 0 ? vlist->row_h[id] : vlist->row_h_est;
+    return h + vlist->row_gap;
+}
+
+/**
+ * Build the Fenwick tree of the row heights in O(n)
+ * @param vlist     pointer to a virtual list
+ */
+static void pos_tree_build(lv_vlist_t * vlist)
+{
+    if(vlist->pos_tree == NULL) return;
+
+    uint32_t i;
+    vlist->pos_tree[0] = 0;
+    for(i = 1; i <= vlist->row_cnt; i++) {
+        vlist->pos_tree[i] = row_get_h(vlist, i - 1);
+    }
+
+    for(i = 1; i <= vlist->row_cnt; i++) {
+        uint32_t parent = i + LOWBIT(i);
+        if(parent <= vlist->row_cnt) vlist->pos_tree[parent] += vlist->pos_tree[i];
+    }
+}
+
+/**
+ * Change the height of a row in the Fenwick tree
+ * @param vlist     pointer to a virtual list
+ * @param id        ID of the row
+ * @param diff      the change of the height
+ */
+static void pos_tree_add(lv_vlist_t * vlist, uint32_t id, int32_t diff)
+{
+    uint32_t i;
+    for(i = id + 1; i <= vlist->row_cnt; i += LOWBIT(i)) {
+        vlist->pos_tree[i] += diff;
+    }
+}
+
+/**
+ * Get the position of a row in the whole list
+ * @param vlist     pointer to a virtual list
+ * @param id        ID of the row. `row_cnt` means the end of the last row.
+ * @return          the sum of the height of the previous rows
+ */
+static int32_t pos_get(const lv_vlist_t * vlist, uint32_t id)
+{
+    if(id > vlist->row_cnt) id = vlist->row_cnt;
+
+    int32_t y = 0;
+    uint32_t i;
+    for(i = id; i > 0; i -= LOWBIT(i)) {
+        y += vlist->pos_tree[i];
+    }
+
+    return y;
+}
+
+/**
+ * Find the row at a position of the whole list
+ * @param vlist     pointer to a virtual list
+ * @param y         a position in the whole list
+ * @return          ID of the row at `y`. The last row if `y` is beyond the end.
+ */
+static uint32_t pos_find_row(const lv_vlist_t * vlist, int32_t y)
+{
+    if(vlist->row_cnt == 0) return 0;
+
+    uint32_t step = 1;
+    while((step << 1) <= vlist->row_cnt) step <<= 1;
+
+    uint32_t id = 0;
+    for(; step > 0; step >>= 1) {
+        if(id + step <= vlist->row_cnt && vlist->pos_tree[id + step] <= y) {
+            id += step;
+            y -= vlist->pos_tree[id];
+        }
+    }
+
+    return LV_MIN(id, vlist->row_cnt - 1);
+}
+
+/**
+ * Get the area of the vertical scrollbar as if the whole list were scrollable.
+ * Similar to `lv_obj_get_scrollbar_area()`
+ * @param obj       pointer to a virtual list
+ * @param sm        the scrollbar mode
+ * @param area      store the area here
+ */
+static void get_scrollbar_area(lv_obj_t * obj, lv_scrollbar_mode_t sm, lv_area_t * area)
+{
+    lv_area_set(area, 0, 0, -1, -1);
+
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLLABLE) == false) return;
+    if(sm == LV_SCROLLBAR_MODE_OFF) return;
+
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+    int32_t scroll_h = lv_vlist_get_content_height(obj) - view_h;   /*The size of the content which can be really scrolled*/
+    if(sm == LV_SCROLLBAR_MODE_AUTO && scroll_h <= 0) return;
+
+    /*If there is no indev scrolling this object but `mode==active` return*/
+    if(sm == LV_SCROLLBAR_MODE_ACTIVE) {
+        lv_indev_t * indev = lv_indev_get_next(NULL);
+        while(indev) {
+            if(lv_indev_get_scroll_obj(indev) == obj) break;
+            indev = lv_indev_get_next(indev);
+        }
+        if(indev == NULL) return;
+    }
+
+    bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_SCROLLBAR) == LV_BASE_DIR_RTL ? true : false;
+    lv_coord_t end_space = lv_obj_get_style_pad_top(obj, LV_PART_SCROLLBAR);
+    lv_coord_t side_space = lv_obj_get_style_pad_right(obj, LV_PART_SCROLLBAR);
+    lv_coord_t tickness = lv_obj_get_style_width(obj, LV_PART_SCROLLBAR);
+    lv_coord_t obj_h = lv_obj_get_height(obj);
+
+    if(rtl) {
+        area->x1 = obj->coords.x1 + side_space;
+        area->x2 = area->x1 + tickness - 1;
+    }
+    else {
+        area->x2 = obj->coords.x2 - side_space;
+        area->x1 = area->x2 - tickness + 1;
+    }
+
+    if(scroll_h <= 0) {
+        area->y1 = obj->coords.y1 + end_space;
+        area->y2 = obj->coords.y2 - end_space;
+        return;
+    }
+
+    lv_coord_t track_h = obj_h - end_space * 2;
+    int32_t content_h = scroll_h + obj_h;
+    lv_coord_t sb_h = ((int64_t)track_h * obj_h) / content_h;
+    sb_h = LV_MAX(sb_h, SCROLLBAR_MIN_SIZE);
+    lv_coord_t rem = track_h - sb_h;    /*Remaining size from the scrollbar track that is not the scrollbar itself*/
+    lv_coord_t sb_y = ((int64_t)rem * lv_vlist_get_scroll_y(obj)) / scroll_h;
+
+    area->y1 = obj->coords.y1 + end_space + sb_y;
+    area->y2 = area->y1 + sb_h - 1;
+    if(area->y1 < obj->coords.y1 + end_space) {
+        area->y1 = obj->coords.y1 + end_space;
+        if(area->y1 + SCROLLBAR_MIN_SIZE > area->y2) area->y2 = area->y1 + SCROLLBAR_MIN_SIZE;
+    }
+    if(area->y2 > obj->coords.y2 - end_space) {
+        area->y2 = obj->coords.y2 - end_space;
+        if(area->y2 - SCROLLBAR_MIN_SIZE < area->y1) area->y1 = area->y2 - SCROLLBAR_MIN_SIZE;
+    }
+}
+
+static void draw_scrollbar(lv_obj_t * obj, lv_scrollbar_mode_t sm, const lv_area_t * clip_area)
+{
+    lv_area_t area;
+    get_scrollbar_area(obj, sm, &area);
+    if(lv_area_get_size(&area) <= 0) return;
+
+    lv_draw_rect_dsc_t draw_dsc;
+    lv_draw_rect_dsc_init(&draw_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_SCROLLBAR, &draw_dsc);
+    if(draw_dsc.bg_opa < LV_OPA_MIN && draw_dsc.border_opa < LV_OPA_MIN) return;
+
+    lv_obj_draw_part_dsc_t part_dsc;
+    lv_obj_draw_dsc_init(&part_dsc, clip_area);
+    part_dsc.class_p = &lv_obj_class;
+    part_dsc.type = LV_OBJ_DRAW_PART_SCROLLBAR;
+    part_dsc.rect_dsc = &draw_dsc;
+    part_dsc.part = LV_PART_SCROLLBAR;
+    part_dsc.draw_area = &area;
+
+    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_dsc);
+    lv_draw_rect(&area, clip_area, &draw_dsc);
+    lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_dsc);
+}
+
+#endif /*LV_USE_VLIST*/
@@ -0,0 +1,184 @@
+/**
+ * @file lv_vlist.h
+ *
+ */
+
+#ifndef LV_VLIST_H
+#define LV_VLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_VLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_VLIST_ID_NONE    0xFFFFFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create a new row object. The vlist will be the parent of the row.
+ * The row objects are reused to show different rows of the data.
+ */
+typedef lv_obj_t * (*lv_vlist_create_cb_t)(lv_obj_t * vlist);
+
+/**
+ * Show the `id`th row of the data on a row object created by `lv_vlist_create_cb_t`.
+ */
+typedef void (*lv_vlist_bind_cb_t)(lv_obj_t * vlist, lv_obj_t * row, uint32_t id);
+
+typedef struct {
+    lv_obj_t * obj;
+    uint32_t id;            /**< The ID of the shown row or `LV_VLIST_ID_NONE` if the object is free*/
+} _lv_vlist_row_t;
+
+/*Data of virtual list*/
+typedef struct {
+    lv_obj_t obj;
+    lv_vlist_create_cb_t create_cb;
+    lv_vlist_bind_cb_t bind_cb;
+    _lv_vlist_row_t * row_objs; /**< The created row objects*/
+    lv_coord_t * row_h;         /**< Measured height of the rows or -1 if not measured yet*/
+    int32_t * pos_tree;         /**< Fenwick tree of the height of the rows (+row gap) to get the position of the rows*/
+    uint32_t row_cnt;
+    uint32_t row_obj_cnt;
+    uint32_t base_id;           /**< The scroll position of the object is relative to the top of this row*/
+    uint32_t scroll_target_id;  /**< The row to scroll to by `lv_vlist_scroll_to_row()`*/
+    lv_coord_t row_h_est;       /**< The height of the not measured rows*/
+    lv_coord_t row_gap;         /**< The row gap used in `pos_tree`*/
+    uint8_t updating : 1;
+} lv_vlist_t;
+
+extern const lv_obj_class_t lv_vlist_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtual list object
+ * @param parent    pointer to an object, it will be the parent of the new virtual list
+ * @return          pointer to the created virtual list
+ */
+lv_obj_t * lv_vlist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the callback which creates the row objects
+ * @param obj       pointer to a virtual list object
+ * @param create_cb the callback
+ */
+void lv_vlist_set_create_cb(lv_obj_t * obj, lv_vlist_create_cb_t create_cb);
+
+/**
+ * Set the callback which shows a row of the data on a row object
+ * @param obj       pointer to a virtual list object
+ * @param bind_cb   the callback
+ */
+void lv_vlist_set_bind_cb(lv_obj_t * obj, lv_vlist_bind_cb_t bind_cb);
+
+/**
+ * Set the number of rows in the data.
+ * The already measured rows keep their height.
+ * @param obj       pointer to a virtual list object
+ * @param cnt       the number of rows
+ */
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the estimated height of the rows. It's used until a row is shown and its real height is measured.
+ * @param obj       pointer to a virtual list object
+ * @param h         the estimated height of a row
+ */
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of rows in the data
+ * @param obj       pointer to a virtual list object
+ * @return          the number of rows
+ */
+uint32_t lv_vlist_get_row_cnt(const lv_obj_t * obj);
+
+/**
+ * Get the object which shows a row
+ * @param obj       pointer to a virtual list object
+ * @param id        ID of a row
+ * @return          the row object or NULL if the row is not shown
+ */
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t id);
+
+/**
+ * Get the ID of the row shown by a row object
+ * @param obj       pointer to a virtual list object
+ * @param row       a row object
+ * @return          the ID of the row or `LV_VLIST_ID_NONE` if `row` is not used now
+ */
+uint32_t lv_vlist_get_row_id(const lv_obj_t * obj, const lv_obj_t * row);
+
+/**
+ * Get the scroll position in the whole list. Unlike `lv_obj_get_scroll_y()` it is not limited to `lv_coord_t`.
+ * @param obj       pointer to a virtual list object
+ * @return          the distance between the top of the first row and the top of the content area
+ */
+int32_t lv_vlist_get_scroll_y(lv_obj_t * obj);
+
+/**
+ * Get the height of all the rows. The not measured rows are counted with the estimated height.
+ * @param obj       pointer to a virtual list object
+ * @return          the height of the content
+ */
+int32_t lv_vlist_get_content_height(const lv_obj_t * obj);
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Show the data on the row objects again. Call it when the data has changed.
+ * @param obj       pointer to a virtual list object
+ */
+void lv_vlist_refresh(lv_obj_t * obj);
+
+/**
+ * Show a row of the data again if it's visible. Call it when a row of the data has changed.
+ * @param obj       pointer to a virtual list object
+ * @param id        ID of the changed row
+ */
+void lv_vlist_refresh_row(lv_obj_t * obj, uint32_t id);
+
+/**
+ * Scroll to a row. `lv_obj_scroll_to_y()` can't be used as the scroll position of the object is relative.
+ * @param obj       pointer to a virtual list object
+ * @param id        ID of the row to scroll to the top
+ * @param anim_en   LV_ANIM_ON: scroll with animation; LV_ANIM_OFF: scroll immediately
+ */
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t id, lv_anim_enable_t anim_en);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_H*/
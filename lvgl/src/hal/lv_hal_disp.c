@@ -33,6 +33,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_data);
+static void present_process(lv_disp_t * disp);
 
 static void set_px_true_color_alpha(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x,
                                     lv_coord_t y,
@@ -372,6 +373,45 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv)
     return disp_drv->draw_buf->flushing_last;
 }
 
+/**
+ * Tell when a frame was presented on the display, e.g. on the page flip event or vertical sync.
+ * @param disp_drv pointer to display driver
+ * @param tick the time of the presentation in the time base of `lv_tick_get()`
+ */
+void lv_disp_report_present(lv_disp_drv_t * disp_drv, uint32_t tick)
+{
+    /*0 means that there is nothing to process*/
+    if(tick == 0) tick = 1;
+
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(&disp_drv->present_tick, tick, __ATOMIC_RELAXED);
+#else
+    disp_drv->present_tick = tick;
+#endif
+}
+
+/**
+ * Get the predicted presentation time of the next frame
+ * @param disp pointer to a display (NULL to use the default display)
+ * @return the predicted time in the time base of `lv_tick_get()` or the current time
+ *         if the display doesn't report the presentations
+ */
+uint32_t lv_disp_get_next_present_time(lv_disp_t * disp)
+{
+    if(disp == NULL) disp = lv_disp_get_default();
+
+    uint32_t t = lv_tick_get();
+    if(disp == NULL) return t;
+
+    present_process(disp);
+    if(disp->present_period == 0) return t;
+
+    uint32_t elaps = lv_tick_elaps(disp->present_last);
+    if(elaps > LV_DISP_PRESENT_TIMEOUT) return t;
+
+    uint32_t frame_cnt = (elaps << 4) / disp->present_period + 1;
+    return disp->present_last + ((frame_cnt * disp->present_period + 8) >> 4);
+}
 /**
  * Get the next display.
  * @param disp pointer to the current display. NULL to initialize.
@@ -455,6 +495,41 @@ static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_d
     return LV_OBJ_TREE_WALK_NEXT;
 }
 
+/**
+ * Update the presentation period from the last time reported by `lv_disp_report_present()`
+ * @param disp pointer to a display
+ */
+static void present_process(lv_disp_t * disp)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    uint32_t tick = __atomic_exchange_n(&disp->driver->present_tick, 0, __ATOMIC_RELAXED);
+#else
+    /*A presentation reported between these lines is missed which only delays the estimation*/
+    uint32_t tick = disp->driver->present_tick;
+    disp->driver->present_tick = 0;
+#endif
+    if(tick == 0) return;
+
+    uint32_t elaps = tick - disp->present_last;
+    if(disp->present_reported && elaps > 0 && elaps <= LV_DISP_PRESENT_TIMEOUT) {
+        uint32_t elaps16 = elaps << 4;
+        if(disp->present_period == 0) {
+            disp->present_period = elaps16;
+        }
+        else {
+            /*Some frames might be skipped so take the elapsed time as a multiple of the period.
+             *The time is measured in ms, so average the measurements.*/
+            uint32_t frame_cnt = (elaps16 + disp->present_period / 2) / disp->present_period;
+            if(frame_cnt == 0) frame_cnt = 1;
+            int32_t diff = (int32_t)(elaps16 / frame_cnt) - (int32_t)disp->present_period;
+            disp->present_period += diff / 8;
+        }
+    }
+
+    disp->present_last = tick;
+    disp->present_reported = 1;
+}
+
 static void set_px_cb_alpha1(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                              lv_color_t color, lv_opa_t opa)
 {
@@ -31,10 +31,18 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas*/
 #endif
 
+#ifndef LV_INV_AREA_COST
+#define LV_INV_AREA_COST 1024 /*Refreshing one more area costs about as much as redrawing this many pixels*/
+#endif
+
 #ifndef LV_ATTRIBUTE_FLUSH_READY
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
 
+#ifndef LV_DISP_PRESENT_TIMEOUT
+#define LV_DISP_PRESENT_TIMEOUT 1000 /*[ms] Don't predict the presentation time if none was reported for this long*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -129,6 +137,15 @@ typedef struct _lv_disp_drv_t {
     void (*gpu_fill_cb)(struct _lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
                         const lv_area_t * fill_area, lv_color_t color);
 
+    /** OPTIONAL: Move the pixels of `area` on the display by `dx`, `dy`. The pixels moved out of `area` are dropped
+     * and the uncovered part of `area` can be left unchanged. Used to scroll without redrawing the whole content.
+     * Return false if the pixels can't be moved; `area` will be redrawn then.*/
+    bool (*copy_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+
+    /** Time of the last presentation reported by `lv_disp_report_present()` which is not processed yet (0: none).
+     * Written by the thread which flushes, processed on the thread of `lv_timer_handler()`.*/
+    volatile uint32_t present_tick;
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
@@ -172,8 +189,18 @@ typedef struct _lv_disp_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
 
+    /** An area to move with `copy_cb` of the driver before the next refresh*/
+    lv_area_t copy_area;
+    lv_point_t copy_ofs;
+    uint8_t copy_pending : 1;
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
+
+    /*Presentation timing reported by the driver*/
+    uint32_t present_last;              /**< Time of the last processed presentation*/
+    uint32_t present_period;            /**< Estimated time between two presentations in 1/16 ms. 0: unknown*/
+    uint8_t present_reported : 1;       /**< 1: `present_last` is valid*/
 } lv_disp_t;
 
 /**********************
@@ -299,6 +326,26 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_disp_flush_is_last(lv_disp_drv_t * disp_drv);
 
 //! @endcond
 
+/**
+ * Tell when a frame was presented on the display, e.g. on the page flip event or vertical sync.
+ * If the driver reports the presentations the animations are evaluated for the predicted
+ * presentation time of the next frame.
+ * It only stores the time, so it can be called from the thread or interrupt which flushes.
+ * The time is processed by `lv_disp_get_next_present_time()` on the thread of `lv_timer_handler()`.
+ * If more presentations are reported meanwhile only the last one is used.
+ * @param disp_drv pointer to display driver
+ * @param tick the time of the presentation in the time base of `lv_tick_get()`
+ */
+void lv_disp_report_present(lv_disp_drv_t * disp_drv, uint32_t tick);
+
+/**
+ * Get the predicted presentation time of the next frame
+ * @param disp pointer to a display (NULL to use the default display)
+ * @return the predicted time in the time base of `lv_tick_get()` or the current time
+ *         if the display doesn't report the presentations
+ */
+uint32_t lv_disp_get_next_present_time(lv_disp_t * disp);
+
 /**
  * Get the next display.
  * @param disp pointer to the current display. NULL to initialize.
@@ -65,6 +65,9 @@ void lv_indev_drv_init(lv_indev_drv_t * driver)
     driver->long_press_repeat_time  = LV_INDEV_DEF_LONG_PRESS_REP_TIME;
     driver->gesture_limit        = LV_INDEV_DEF_GESTURE_LIMIT;
     driver->gesture_min_velocity = LV_INDEV_DEF_GESTURE_MIN_VELOCITY;
+    driver->filter_min_cutoff    = LV_INDEV_DEF_FILTER_MIN_CUTOFF;
+    driver->filter_beta          = LV_INDEV_DEF_FILTER_BETA;
+    driver->predict_time         = LV_INDEV_DEF_PREDICT_TIME;
 }
 
 /**
@@ -134,7 +137,7 @@ void _lv_indev_read(lv_indev_t * indev, lv_indev_data_t * data)
 
     /* For touchpad sometimes users don't set the last pressed coordinate on release.
      * So be sure a coordinates are initialized to the last point */
-    if(indev->driver->type == LV_INDEV_TYPE_POINTER) {
+    if(indev->driver->type == LV_INDEV_TYPE_POINTER || indev->driver->type == LV_INDEV_TYPE_MULTI_POINTER) {
         data->point.x = indev->proc.types.pointer.last_raw_point.x;
         data->point.y = indev->proc.types.pointer.last_raw_point.y;
     }
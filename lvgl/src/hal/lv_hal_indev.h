@@ -47,6 +47,26 @@ extern "C" {
 /*Gesture min velocity at release before swipe (pixels)*/
 #define LV_INDEV_DEF_GESTURE_MIN_VELOCITY 3
 
+/*Change of the distance of two touches to recognize a pinch (pixels)*/
+#define LV_INDEV_DEF_PINCH_LIMIT          20
+
+/*Change of the angle of two touches to recognize a rotation (0.1 degree)*/
+#define LV_INDEV_DEF_ROTATE_LIMIT         100
+
+/*Jitter smoothing of pointers with a 1-euro filter: cut-off frequency at rest [0.1 Hz] (0: disabled)*/
+#define LV_INDEV_DEF_FILTER_MIN_CUTOFF    0
+
+/*Increase of the filter's cut-off frequency for 1000 px/s speed [0.1 Hz]*/
+#define LV_INDEV_DEF_FILTER_BETA          70
+
+/*Extrapolate the pointer to the expected display time by at most this much [ms] (0: disabled)*/
+#define LV_INDEV_DEF_PREDICT_TIME         0
+
+/*Max. number of touches reported by LV_INDEV_TYPE_MULTI_POINTER input devices*/
+#ifndef LV_INDEV_TOUCH_MAX
+#define LV_INDEV_TOUCH_MAX                5
+#endif
+
 
 /**********************
  *      TYPEDEFS
@@ -65,6 +85,7 @@ typedef enum {
     LV_INDEV_TYPE_KEYPAD,  /**< Keypad or keyboard*/
     LV_INDEV_TYPE_BUTTON,  /**< External (hardware button) which is assigned to a specific point of the screen*/
     LV_INDEV_TYPE_ENCODER, /**< Encoder with only Left, Right turn and a Button*/
+    LV_INDEV_TYPE_MULTI_POINTER, /**< Multi-touch screen. The first touch works as a pointer, two touches make pinch and rotate gestures*/
 } lv_indev_type_t;
 
 /** States for input devices*/
@@ -73,15 +94,26 @@ typedef enum {
     LV_INDEV_STATE_PRESSED
 } lv_indev_state_t;
 
+/** A touch of a LV_INDEV_TYPE_MULTI_POINTER input device*/
+typedef struct {
+    lv_point_t point;
+    int32_t id;         /**< Identifies the same finger across the reads (e.g. the tracking ID of the touch)*/
+} lv_indev_touch_t;
+
 /** Data structure passed to an input driver to fill*/
 typedef struct {
     lv_point_t point; /**< For LV_INDEV_TYPE_POINTER the currently pressed point*/
+    lv_indev_touch_t touches[LV_INDEV_TOUCH_MAX]; /**< For LV_INDEV_TYPE_MULTI_POINTER the touching fingers.
+                                                   *   `point` and `state` are derived from them.*/
+    uint8_t touch_cnt; /**< For LV_INDEV_TYPE_MULTI_POINTER the number of touches in `touches`*/
     uint32_t key;     /**< For LV_INDEV_TYPE_KEYPAD the currently pressed key*/
     uint32_t btn_id;  /**< For LV_INDEV_TYPE_BUTTON the currently pressed button*/
     int16_t enc_diff; /**< For LV_INDEV_TYPE_ENCODER number of steps since the previous read*/
 
     lv_indev_state_t state; /**< LV_INDEV_STATE_REL or LV_INDEV_STATE_PR*/
     bool continue_reading;  /**< If set to true, the read callback is invoked again*/
+    uint32_t timestamp;     /**< Time of the sample in the time base of `lv_tick_get()`. 0: the time of reading.
+                             *   Buffering drivers can report older samples with `continue_reading`.*/
 } lv_indev_data_t;
 
 /** Initialized by the user and registered by 'lv_indev_add()'*/
@@ -124,6 +156,15 @@ typedef struct _lv_indev_drv_t {
 
     /**< Repeated trigger period in long press [ms]*/
     uint16_t long_press_repeat_time;
+
+    /**< Smooth the jitter of the pointer with a 1-euro filter. Cut-off frequency at rest [0.1 Hz] (0: disabled)*/
+    uint16_t filter_min_cutoff;
+
+    /**< Increase of the cut-off frequency for 1000 px/s speed [0.1 Hz]. Greater value means less lag when moving fast.*/
+    uint16_t filter_beta;
+
+    /**< Extrapolate the pointer to the expected display time by at most this much [ms] (0: disabled)*/
+    uint16_t predict_time;
 } lv_indev_drv_t;
 
 /** Run time data of input devices
@@ -154,10 +195,28 @@ typedef struct _lv_indev_proc_t {
             lv_area_t scroll_area;
 
             lv_point_t gesture_sum; /*Count the gesture pixels to check LV_INDEV_DEF_GESTURE_LIMIT*/
+
+            /*Multi-touch data*/
+            int32_t touch_id[2];      /*ID of the first (pointer) and second touch*/
+            lv_point_t touch_point[2];
+            uint32_t pinch_dist_start; /*Distance of the touches when the second touch began*/
+            uint16_t pinch_angle_start; /*Angle of the touches when the second touch began [degree]*/
+            uint16_t pinch_scale;     /*Scale since the start of the pinch (256: no change)*/
+            int16_t rotation;         /*Rotation since the start of the pinch [0.1 degree]*/
+
+            /*Pointer filter and prediction*/
+            int32_t filter_pos[2];    /*Filtered X and Y [1/256 px]*/
+            int32_t filter_vel[2];    /*Filtered X and Y speed [1/256 px/s]*/
+
             /*Flags*/
             lv_dir_t scroll_dir : 4;
             lv_dir_t gesture_dir : 4;
             uint8_t gesture_sent : 1;
+            uint8_t touch_valid : 2;  /*Bit 0, 1: `touch_id[0]`, `touch_id[1]` are valid*/
+            uint8_t pinch_sent : 1;
+            uint8_t rotate_sent : 1;
+            uint8_t multi_gesture_sent : 1; /*A pinch or rotation was sent since pressing, don't click*/
+            uint8_t filter_valid : 1; /*`filter_pos` and `filter_vel` are set*/
         } pointer;
         struct {
             /*Keypad data*/
@@ -168,6 +227,8 @@ typedef struct _lv_indev_proc_t {
 
     uint32_t pr_timestamp;         /**< Pressed time stamp*/
     uint32_t longpr_rep_timestamp; /**< Long press repeat time stamp*/
+    uint32_t timestamp;            /**< Time of the sample being processed*/
+    uint32_t timestamp_elaps;      /**< Time since the previous sample or the read period if the samples have no time*/
 } _lv_indev_proc_t;
 
 /** The main input device descriptor with driver, runtime data ('proc') and some additional
@@ -607,6 +607,31 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  endif
 #endif
 
+/*1: Enable `lv_async_post()` to post updates from other threads without locking (needs the atomics of GCC or Clang)*/
+#ifndef LV_USE_ASYNC_QUEUE
+#  ifdef CONFIG_LV_USE_ASYNC_QUEUE
+#    define LV_USE_ASYNC_QUEUE CONFIG_LV_USE_ASYNC_QUEUE
+#  else
+#    define  LV_USE_ASYNC_QUEUE      0
+#  endif
+#endif
+#if LV_USE_ASYNC_QUEUE
+#ifndef LV_ASYNC_QUEUE_SIZE
+#  ifdef CONFIG_LV_ASYNC_QUEUE_SIZE
+#    define LV_ASYNC_QUEUE_SIZE CONFIG_LV_ASYNC_QUEUE_SIZE
+#  else
+#    define  LV_ASYNC_QUEUE_SIZE       64    /*Max. number of pending updates. Must be a power of 2.*/
+#  endif
+#endif
+#ifndef LV_ASYNC_QUEUE_DATA_SIZE
+#  ifdef CONFIG_LV_ASYNC_QUEUE_DATA_SIZE
+#    define LV_ASYNC_QUEUE_DATA_SIZE CONFIG_LV_ASYNC_QUEUE_DATA_SIZE
+#  else
+#    define  LV_ASYNC_QUEUE_DATA_SIZE  32    /*Max. size of the data of an update [bytes]*/
+#  endif
+#endif
+#endif /*LV_USE_ASYNC_QUEUE*/
+
 /*=====================
  *  COMPILER SETTINGS
  *====================*/
@@ -1360,6 +1385,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  endif
 #endif
 
+#ifndef LV_USE_VLIST
+#  ifdef CONFIG_LV_USE_VLIST
+#    define LV_USE_VLIST CONFIG_LV_USE_VLIST
+#  else
+#    define  LV_USE_VLIST        1
+#  endif
+#endif
+
 #ifndef LV_USE_METER
 #  ifdef CONFIG_LV_USE_METER
 #    define LV_USE_METER CONFIG_LV_USE_METER
@@ -12,10 +12,12 @@
 #include <string.h>
 #include "../misc/lv_assert.h"
 #include "../hal/lv_hal_tick.h"
+#include "../hal/lv_hal_disp.h"
 #include "lv_timer.h"
 #include "lv_math.h"
 #include "lv_mem.h"
 #include "lv_gc.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -38,9 +40,10 @@ static void anim_ready_handler(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static uint32_t last_timer_run;
-static bool anim_list_changed;
 static bool anim_run_round;
 static lv_timer_t * _lv_anim_tmr;
+static lv_anim_t * anim_next;   /*The animation to process next in `anim_timer`*/
+static uint32_t anim_cnt;
 
 /**********************
  *      MACROS
@@ -60,8 +63,9 @@ void _lv_anim_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
     _lv_anim_tmr = lv_timer_create(anim_timer, LV_DISP_DEF_REFR_PERIOD, NULL);
+    anim_next = NULL;
+    anim_cnt = 0;
     anim_mark_list_change(); /*Turn off the animation timer*/
-    anim_list_changed = false;
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -91,6 +95,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
+    anim_cnt++;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
@@ -109,8 +114,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         if(new_anim->exec_cb && new_anim->var) new_anim->exec_cb(new_anim->var, new_anim->start_value);
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
+    /*Resume the animation timer*/
     anim_mark_list_change();
 
     TRACE_ANIM("finished");
@@ -128,10 +132,12 @@ bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
         a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
 
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+            /*Let `anim_timer` continue from the next valid animation*/
+            if(a == anim_next) anim_next = a_next;
             _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
             lv_mem_free(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                         the linked list*/
+            anim_cnt--;
+            anim_mark_list_change();
             del = true;
         }
 
@@ -144,6 +150,8 @@ bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
 void lv_anim_del_all(void)
 {
     _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
+    anim_next = NULL;
+    anim_cnt = 0;
     anim_mark_list_change();
 }
 
@@ -161,11 +169,7 @@ lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) cnt++;
-
-    return cnt;
+    return anim_cnt;
 }
 
 uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end)
@@ -327,22 +331,32 @@ static void anim_timer(lv_timer_t * param)
 {
     (void)param;
 
-    uint32_t elaps = lv_tick_elaps(last_timer_run);
+    /*If the display reports its presentations calculate the state of the animations for the time
+     *when the next frame will be visible. This way the steps are evenly spaced.*/
+    uint32_t act_time = lv_disp_get_next_present_time(NULL);
+    uint32_t elaps = act_time - last_timer_run;
+
+    /*Don't go back in time, e.g. if the display stopped reporting and the predicted time was ahead*/
+    if((int32_t)elaps < 0) {
+        elaps = 0;
+        act_time = last_timer_run;
+    }
 
     /*Flip the run round*/
     anim_run_round = anim_run_round ? false : true;
 
-    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    /*The objects are typically changed by many animations at once so join their invalid areas*/
+    _lv_inv_batch_start();
 
+    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
     while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        anim_list_changed = false;
+        /*The callbacks might delete any animations. `lv_anim_del()` updates `anim_next` if the next
+         *animation is deleted so it's safe to continue with it. The new animations are added to the head
+         *of the list so they are not processed in this round.*/
+        anim_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
 
         if(a->run_round != anim_run_round) {
-            a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+            a->run_round = anim_run_round; /*An animation added in this round is marked as already run*/
 
             /*The animation will run now for the first time. Call `start_cb`*/
             int32_t new_act_time = a->act_time + elaps;
@@ -375,15 +389,13 @@ static void anim_timer(lv_timer_t * param)
             }
         }
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(anim_list_changed)
-            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-        else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+        a = anim_next;
     }
+    anim_next = NULL;
+
+    _lv_inv_batch_end();
 
-    last_timer_run = lv_tick_get();
+    last_timer_run = act_time;
 }
 
 /**
@@ -407,9 +419,10 @@ static void anim_ready_handler(lv_anim_t * a)
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
         lv_anim_t a_tmp;
         lv_memcpy(&a_tmp, a, sizeof(lv_anim_t));
+        if(a == anim_next) anim_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
         _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
         lv_mem_free(a);
-        /*Flag that the list has changed*/
+        anim_cnt--;
         anim_mark_list_change();
 
         /*Call the callback function at the end*/
@@ -437,7 +450,6 @@ static void anim_ready_handler(lv_anim_t * a)
 }
 static void anim_mark_list_change(void)
 {
-    anim_list_changed = true;
     if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
         lv_timer_pause(_lv_anim_tmr);
     else
@@ -156,6 +156,48 @@ void _lv_area_join(lv_area_t * a_res_p, const lv_area_t * a1_p, const lv_area_t
     a_res_p->y2 = LV_MAX(a1_p->y2, a2_p->y2);
 }
 
+/**
+ * Get the parts of an area which are not on an other area.
+ * The parts are in top to bottom, left to right order.
+ * @param res_p pointer to an array of 4 areas, the result will be stored here
+ * @param a1_p pointer to the area to cut
+ * @param a2_p pointer to the area to remove from `a1_p`
+ * @return number of areas stored in `res_p` (0..4)
+ */
+uint8_t _lv_area_diff(lv_area_t res_p[], const lv_area_t * a1_p, const lv_area_t * a2_p)
+{
+    lv_area_t com;
+    if(_lv_area_intersect(&com, a1_p, a2_p) == false) {
+        lv_area_copy(&res_p[0], a1_p);
+        return 1;
+    }
+
+    uint8_t cnt = 0;
+    /*Above the common part*/
+    if(a1_p->y1 < com.y1) {
+        lv_area_set(&res_p[cnt], a1_p->x1, a1_p->y1, a1_p->x2, com.y1 - 1);
+        cnt++;
+    }
+
+    /*Left and right of the common part*/
+    if(a1_p->x1 < com.x1) {
+        lv_area_set(&res_p[cnt], a1_p->x1, com.y1, com.x1 - 1, com.y2);
+        cnt++;
+    }
+    if(a1_p->x2 > com.x2) {
+        lv_area_set(&res_p[cnt], com.x2 + 1, com.y1, a1_p->x2, com.y2);
+        cnt++;
+    }
+
+    /*Below the common part*/
+    if(a1_p->y2 > com.y2) {
+        lv_area_set(&res_p[cnt], a1_p->x1, com.y2 + 1, a1_p->x2, a1_p->y2);
+        cnt++;
+    }
+
+    return cnt;
+}
+
 /**
  * Check if a point is on an area
  * @param a_p pointer to an area
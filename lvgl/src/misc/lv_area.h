@@ -195,6 +195,16 @@ bool _lv_area_intersect(lv_area_t * res_p, const lv_area_t * a1_p, const lv_area
  */
 void _lv_area_join(lv_area_t * a_res_p, const lv_area_t * a1_p, const lv_area_t * a2_p);
 
+/**
+ * Get the parts of an area which are not on an other area.
+ * The parts are in top to bottom, left to right order.
+ * @param res_p pointer to an array of 4 areas, the result will be stored here
+ * @param a1_p pointer to the area to cut
+ * @param a2_p pointer to the area to remove from `a1_p`
+ * @return number of areas stored in `res_p` (0..4)
+ */
+uint8_t _lv_area_diff(lv_area_t res_p[], const lv_area_t * a1_p, const lv_area_t * a2_p);
+
 /**
  * Check if a point is on an area
  * @param a_p pointer to an area
@@ -8,10 +8,20 @@
  *********************/
 
 #include "lv_async.h"
+#include "lv_mem.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_ASYNC_QUEUE
+#if (LV_ASYNC_QUEUE_SIZE & (LV_ASYNC_QUEUE_SIZE - 1)) != 0
+    #error "LV_ASYNC_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if !defined(__GNUC__) && !defined(__clang__)
+    #error "LV_USE_ASYNC_QUEUE needs the __atomic built-ins of GCC or Clang"
+#endif
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -22,19 +32,48 @@ typedef struct _lv_async_info_t {
     void * user_data;
 } lv_async_info_t;
 
+#if LV_USE_ASYNC_QUEUE
+/*A posted update in the queue*/
+typedef struct {
+    uint32_t seq;               /*The position when the slot can be written or `position + 1` when it can be read*/
+    lv_async_update_cb_t cb;    /*NULL if canceled*/
+    void * target;
+    uint8_t coalesce;
+    union {
+        uint8_t bytes[LV_ASYNC_QUEUE_DATA_SIZE];
+        void * ptr;             /*Align the data for any type*/
+        int64_t i64;
+        double f64;
+    } data;
+} lv_async_slot_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static void lv_async_timer_cb(lv_timer_t * timer);
+#if LV_USE_ASYNC_QUEUE
+static uint32_t async_queue_ready_cnt(void);
+static bool async_queue_is_coalesced(uint32_t i, uint32_t cnt);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_ASYNC_QUEUE
+/*Bounded multi producer, single consumer queue. The producers reserve a slot by incrementing
+ *`queue_tail` and publish it by updating its `seq`. Only the consumer writes `queue_head`.*/
+static lv_async_slot_t queue[LV_ASYNC_QUEUE_SIZE];
+static uint32_t queue_tail;
+static uint32_t queue_head;
+#endif
 
 /**********************
  *      MACROS
  **********************/
+#define ASYNC_LOAD(v, order)        __atomic_load_n(&(v), order)
+#define ASYNC_STORE(v, x, order)    __atomic_store_n(&(v), (x), order)
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -64,6 +103,91 @@ lv_res_t lv_async_call(lv_async_cb_t async_xcb, void * user_data)
     return LV_RES_OK;
 }
 
+#if LV_USE_ASYNC_QUEUE
+
+void _lv_async_queue_init(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_ASYNC_QUEUE_SIZE; i++) {
+        queue[i].seq = i;
+    }
+    queue_tail = 0;
+    queue_head = 0;
+}
+
+lv_res_t lv_async_post(lv_async_update_cb_t update_cb, void * target, const void * data, uint32_t data_size,
+                       bool coalesce)
+{
+    if(data_size > LV_ASYNC_QUEUE_DATA_SIZE) return LV_RES_INV;
+
+    /*Reserve a slot*/
+    lv_async_slot_t * slot;
+    uint32_t pos = ASYNC_LOAD(queue_tail, __ATOMIC_RELAXED);
+    while(1) {
+        slot = &queue[pos & (LV_ASYNC_QUEUE_SIZE - 1)];
+        int32_t diff = (int32_t)(ASYNC_LOAD(slot->seq, __ATOMIC_ACQUIRE) - pos);
+        if(diff == 0) {
+            /*The slot is free. On failure `pos` is updated to the current tail.*/
+            if(__atomic_compare_exchange_n(&queue_tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+        }
+        else if(diff < 0) {
+            /*The slot still has an update from the previous round: the queue is full*/
+            return LV_RES_INV;
+        }
+        else {
+            /*Another thread reserved this position*/
+            pos = ASYNC_LOAD(queue_tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->cb = update_cb;
+    slot->target = target;
+    slot->coalesce = coalesce ? 1 : 0;
+    if(data_size) lv_memcpy(slot->data.bytes, data, data_size);
+
+    /*Publish the update*/
+    ASYNC_STORE(slot->seq, pos + 1, __ATOMIC_RELEASE);
+    return LV_RES_OK;
+}
+
+void lv_async_post_cancel(void * target)
+{
+    uint32_t cnt = async_queue_ready_cnt();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_async_slot_t * slot = &queue[(queue_head + i) & (LV_ASYNC_QUEUE_SIZE - 1)];
+        if(slot->target == target) slot->cb = NULL;
+    }
+}
+
+void _lv_async_queue_handler(void)
+{
+    /*Apply only the updates which are ready now, the ones posted meanwhile wait for the next call*/
+    uint32_t cnt = async_queue_ready_cnt();
+    if(cnt == 0) return;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_async_slot_t * slot = &queue[(queue_head + i) & (LV_ASYNC_QUEUE_SIZE - 1)];
+        if(slot->cb == NULL) continue;
+        if(slot->coalesce && async_queue_is_coalesced(i, cnt)) continue;
+
+        /*The callback might cancel the later updates (e.g. by deleting an object)*/
+        lv_async_update_cb_t cb = slot->cb;
+        slot->cb = NULL;
+        cb(slot->target, slot->data.bytes);
+    }
+
+    /*Give the slots back to the producers*/
+    for(i = 0; i < cnt; i++) {
+        lv_async_slot_t * slot = &queue[queue_head & (LV_ASYNC_QUEUE_SIZE - 1)];
+        ASYNC_STORE(slot->seq, queue_head + LV_ASYNC_QUEUE_SIZE, __ATOMIC_RELEASE);
+        queue_head++;
+    }
+}
+
+#endif /*LV_USE_ASYNC_QUEUE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -76,3 +200,42 @@ static void lv_async_timer_cb(lv_timer_t * timer)
 
     lv_mem_free(info);
 }
+
+#if LV_USE_ASYNC_QUEUE
+
+/**
+ * Count the published updates from the head of the queue
+ * @return number of updates which can be applied
+ */
+static uint32_t async_queue_ready_cnt(void)
+{
+    uint32_t cnt = 0;
+    while(cnt < LV_ASYNC_QUEUE_SIZE) {
+        uint32_t pos = queue_head + cnt;
+        lv_async_slot_t * slot = &queue[pos & (LV_ASYNC_QUEUE_SIZE - 1)];
+        if(ASYNC_LOAD(slot->seq, __ATOMIC_ACQUIRE) != pos + 1) break;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+/**
+ * Check if an update is overwritten by a later one with the same callback and target
+ * @param i     index of the update from the head of the queue
+ * @param cnt   number of the ready updates
+ * @return true: a later update will be applied instead
+ */
+static bool async_queue_is_coalesced(uint32_t i, uint32_t cnt)
+{
+    lv_async_slot_t * slot = &queue[(queue_head + i) & (LV_ASYNC_QUEUE_SIZE - 1)];
+    uint32_t j;
+    for(j = i + 1; j < cnt; j++) {
+        lv_async_slot_t * later = &queue[(queue_head + j) & (LV_ASYNC_QUEUE_SIZE - 1)];
+        if(later->cb == slot->cb && later->target == slot->target && later->coalesce) return true;
+    }
+
+    return false;
+}
+
+#endif /*LV_USE_ASYNC_QUEUE*/
@@ -30,6 +30,12 @@ extern "C" {
  */
 typedef void (*lv_async_cb_t)(void *);
 
+/**
+ * Type for the callback applying an update posted by `lv_async_post()`.
+ * The first parameter is the target (e.g. an object), the second is the copy of the data.
+ */
+typedef void (*lv_async_update_cb_t)(void *, void *);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -44,6 +50,41 @@ typedef void (*lv_async_cb_t)(void *);
  */
 lv_res_t lv_async_call(lv_async_cb_t async_xcb, void * user_data);
 
+#if LV_USE_ASYNC_QUEUE
+
+/**
+ * Initialize the queue of the updates posted by other threads. Called by `lv_init()`.
+ */
+void _lv_async_queue_init(void);
+
+/**
+ * Post an update from any thread. It's applied in the next `lv_timer_handler()` on its thread.
+ * It's lock-free, so it never blocks the posting thread.
+ * @param update_cb     applies the update, e.g. calls a setter function of a widget
+ * @param target        the first parameter of `update_cb`, e.g. an object
+ * @param data          pointer to the data of the update. It's copied so it can be a local variable.
+ * @param data_size     size of the data in bytes. Max. `LV_ASYNC_QUEUE_DATA_SIZE`.
+ * @param coalesce      true: only the last one of the pending updates with the same `update_cb` and `target` is applied
+ *                      (e.g. to set the text of a label). false: all of them are applied (e.g. to add points to a chart).
+ * @return LV_RES_OK: posted; LV_RES_INV: the queue is full or the data is too large
+ */
+lv_res_t lv_async_post(lv_async_update_cb_t update_cb, void * target, const void * data, uint32_t data_size, bool coalesce);
+
+/**
+ * Drop the posted but not yet applied updates of a target. Called when an object is deleted
+ * or e.g. a chart series is removed.
+ * Only on the thread of `lv_timer_handler()`.
+ * @param target the target of the updates
+ */
+void lv_async_post_cancel(void * target);
+
+/**
+ * Apply the posted updates. Called by `lv_timer_handler()`.
+ */
+void _lv_async_queue_handler(void);
+
+#endif /*LV_USE_ASYNC_QUEUE*/
+
 /**********************
  *      MACROS
  **********************/
@@ -41,6 +41,7 @@ extern "C" {
 
 #define LV_ITERATE_ROOTS(f)                                                                 \
     LV_DISPATCH(f, lv_ll_t, _lv_timer_ll) /*Linked list to store the lv_timers*/            \
+    LV_DISPATCH(f, lv_timer_t **, _lv_timer_heap) /*Min-heap of the running lv_timers*/ \
     LV_DISPATCH(f, lv_ll_t, _lv_disp_ll)  /*Linked list of display device*/                 \
     LV_DISPATCH(f, lv_ll_t, _lv_indev_ll) /*Linked list of input device*/                   \
     LV_DISPATCH(f, lv_ll_t, _lv_fsdrv_ll)                                                   \
@@ -56,6 +57,7 @@ extern "C" {
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1) \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                       \
+    LV_DISPATCH_COND(f, lv_ll_t, _lv_snapshot_layer_ll, LV_USE_SNAPSHOT, 1)                 \
     LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
@@ -6,6 +6,7 @@
  *      INCLUDES
  *********************/
 #include "lv_timer.h"
+#include "lv_async.h"
 #include <stddef.h>
 #include "../misc/lv_assert.h"
 #include "../hal/lv_hal_tick.h"
@@ -16,6 +17,7 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_SIZE_MIN 8
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +28,13 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static bool timer_heap_insert(lv_timer_t * timer);
+static void timer_heap_remove(lv_timer_t * timer);
+static void timer_heap_update(lv_timer_t * timer);
+static bool timer_heap_sift_up(uint32_t idx, uint32_t now);
+static void timer_heap_sift_down(uint32_t idx, uint32_t now);
+static bool timer_is_before(const lv_timer_t * a, const lv_timer_t * b, uint32_t now);
+static void timer_heap_set(uint32_t idx, lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -33,7 +42,9 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
-static bool timer_created;
+static uint32_t heap_cnt;
+static uint32_t heap_size;
+static uint32_t handler_cnt;
 
 /**********************
  *      MACROS
@@ -54,6 +65,9 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -78,6 +92,11 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         return 1;
     }
 
+#if LV_USE_ASYNC_QUEUE
+    /*Apply the updates posted by other threads before the timers redraw the screen*/
+    _lv_async_queue_handler();
+#endif
+
     static uint32_t idle_period_start = 0;
     static uint32_t busy_time         = 0;
 
@@ -92,39 +111,23 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
+    /*Run the ready timers. The timer to run next is always on the top of the heap.
+     *Run a timer only once even if it's ready again (e.g. 0 period)*/
+    handler_cnt++;
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(timer->handler_cnt == handler_cnt) break;
+        if(timer->repeat_count != 0 && lv_timer_time_remaining(timer) != 0) break;
 
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        time_till_next = timer->repeat_count == 0 ? 0 : lv_timer_time_remaining(timer);
     }
 
     busy_time += lv_tick_elaps(handler_start);
@@ -174,8 +177,14 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
+    new_timer->handler_cnt = handler_cnt - 1;
+    new_timer->heap_idx = LV_TIMER_HEAP_NONE;
 
-    timer_created = true;
+    if(!timer_heap_insert(new_timer)) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
 
     return new_timer;
 }
@@ -196,8 +205,9 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+    timer_heap_remove(timer);
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
+    if(timer == LV_GC_ROOT(_lv_timer_act)) timer_deleted = true;
 
     lv_mem_free(timer);
 }
@@ -209,11 +219,13 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+    timer_heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+    if(timer->heap_idx == LV_TIMER_HEAP_NONE) timer_heap_insert(timer);
 }
 
 /**
@@ -224,6 +236,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    timer_heap_update(timer);
 }
 
 /**
@@ -233,6 +246,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_heap_update(timer);
 }
 
 /**
@@ -243,6 +257,9 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+
+    /*Bring the stopped timer to the top of the heap to be deleted in the next `lv_timer_handler()`*/
+    if(repeat_count == 0) timer_heap_update(timer);
 }
 
 /**
@@ -253,6 +270,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    timer_heap_update(timer);
 }
 
 /**
@@ -289,44 +307,40 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its priority is appropriate
+ * Execute a ready timer
  * @param timer pointer to lv_timer
  * @return true: execute, false: not executed
  */
 static bool lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
     if(timer->repeat_count == 0) {
         TIMER_TRACE("deleting timer with %p callback because the repeat count is over", timer->timer_cb);
         lv_timer_del(timer);
         return false;
     }
 
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        TIMER_TRACE("calling timer callback: %p", timer->timer_cb);
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-        TIMER_TRACE("timer callback %p finished", timer->timer_cb);
-        LV_ASSERT_MEM_INTEGRITY();
-
-        /*Delete if it was a one shot lv_timer*/
-        if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
-            if(timer->repeat_count == 0) {
-                TIMER_TRACE("deleting timer with %p callback because the repeat count is over", timer->timer_cb);
-                lv_timer_del(timer);
-            }
+    /* Decrement the repeat count before executing the timer_cb.
+     * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero and the timer can be deleted in the next round*/
+    timer_deleted = false;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    timer->handler_cnt = handler_cnt;
+    timer_heap_update(timer);
+    TIMER_TRACE("calling timer callback: %p", timer->timer_cb);
+    if(timer->timer_cb) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", timer->timer_cb);
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*Delete if it was a one shot lv_timer*/
+    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
+        if(timer->repeat_count == 0) {
+            TIMER_TRACE("deleting timer with %p callback because the repeat count is over", timer->timer_cb);
+            lv_timer_del(timer);
         }
-        exec = true;
     }
 
-    return exec;
+    return true;
 }
 
 /**
@@ -342,3 +356,129 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+/**
+ * Add a timer to the heap of the running timers
+ * @param timer pointer to lv_timer
+ * @return false: the heap couldn't be enlarged
+ */
+static bool timer_heap_insert(lv_timer_t * timer)
+{
+    if(heap_cnt == heap_size) {
+        uint32_t new_size = heap_size ? heap_size * 2 : HEAP_SIZE_MIN;
+        lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+        LV_GC_ROOT(_lv_timer_heap) = new_heap;
+        heap_size = new_size;
+    }
+
+    heap_cnt++;
+    timer_heap_set(heap_cnt - 1, timer);
+    timer_heap_sift_up(heap_cnt - 1, lv_tick_get());
+
+    return true;
+}
+
+/**
+ * Remove a timer from the heap of the running timers
+ * @param timer pointer to lv_timer
+ */
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == LV_TIMER_HEAP_NONE) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_NONE;
+    heap_cnt--;
+
+    /*Move the last timer to the place of the removed one*/
+    if(idx != heap_cnt) {
+        timer_heap_set(idx, LV_GC_ROOT(_lv_timer_heap)[heap_cnt]);
+        uint32_t now = lv_tick_get();
+        if(!timer_heap_sift_up(idx, now)) timer_heap_sift_down(idx, now);
+    }
+}
+
+/**
+ * Move a timer to the right place in the heap after its next run has changed
+ * @param timer pointer to lv_timer
+ */
+static void timer_heap_update(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == LV_TIMER_HEAP_NONE) return;
+
+    uint32_t now = lv_tick_get();
+    if(!timer_heap_sift_up(idx, now)) timer_heap_sift_down(idx, now);
+}
+
+/**
+ * Move a timer toward the top of the heap while it should run before its parent
+ * @param idx   index of the timer in the heap
+ * @param now   the current tick
+ * @return      true: the timer was moved
+ */
+static bool timer_heap_sift_up(uint32_t idx, uint32_t now)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    uint32_t start_idx = idx;
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_is_before(timer, heap[parent], now)) break;
+        timer_heap_set(idx, heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(idx, timer);
+
+    return idx != start_idx;
+}
+
+/**
+ * Move a timer toward the bottom of the heap while any of its children should run before it
+ * @param idx   index of the timer in the heap
+ * @param now   the current tick
+ */
+static void timer_heap_sift_down(uint32_t idx, uint32_t now)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && timer_is_before(heap[child + 1], heap[child], now)) child++;
+        if(!timer_is_before(heap[child], timer, now)) break;
+        timer_heap_set(idx, heap[child]);
+        idx = child;
+    }
+    timer_heap_set(idx, timer);
+}
+
+/**
+ * Tell whether a timer should run before an other one.
+ * The order doesn't change as the time passes so the heap remains valid.
+ * @param a     pointer to lv_timer
+ * @param b     pointer to an other lv_timer
+ * @param now   the current tick
+ * @return      true: `a` should run first
+ */
+static bool timer_is_before(const lv_timer_t * a, const lv_timer_t * b, uint32_t now)
+{
+    /*The stopped timers needs to be deleted as soon as possible*/
+    if(a->repeat_count == 0 || b->repeat_count == 0) return a->repeat_count == 0 && b->repeat_count != 0;
+
+    /*Compare the time until the next run. Overdue timers have negative value.*/
+    int64_t a_next = (int64_t)a->period - (uint32_t)(now - a->last_run);
+    int64_t b_next = (int64_t)b->period - (uint32_t)(now - b->last_run);
+    if(a_next != b_next) return a_next < b_next;
+
+    /*The timers which haven't run in the current `lv_timer_handler()` come first*/
+    return (int32_t)(a->handler_cnt - b->handler_cnt) < 0;
+}
+
+static void timer_heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    LV_GC_ROOT(_lv_timer_heap)[idx] = timer;
+    timer->heap_idx = idx;
+}
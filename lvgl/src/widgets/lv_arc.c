@@ -459,7 +459,7 @@ static void lv_arc_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
         /*Handle only pointers here*/
         lv_indev_type_t indev_type = lv_indev_get_type(indev);
-        if(indev_type != LV_INDEV_TYPE_POINTER) return;
+        if(indev_type != LV_INDEV_TYPE_POINTER && indev_type != LV_INDEV_TYPE_MULTI_POINTER) return;
 
         lv_point_t p;
         lv_indev_get_point(indev, &p);
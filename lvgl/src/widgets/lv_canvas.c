@@ -159,7 +159,6 @@ void lv_canvas_transform(lv_obj_t * obj, lv_img_dsc_t * img, int16_t angle, uint
 
     int32_t x;
     int32_t y;
-    bool ret;
 
     lv_img_transform_dsc_t dsc;
     dsc.cfg.angle = angle;
@@ -174,63 +173,70 @@ void lv_canvas_transform(lv_obj_t * obj, lv_img_dsc_t * img, int16_t angle, uint
     dsc.cfg.antialias = antialias;
     _lv_img_buf_transform_init(&dsc);
 
-    for(y = -offset_y; y < dest_height - offset_y; y++) {
-        for(x = -offset_x; x < dest_width - offset_x; x++) {
+    bool img_has_alpha = lv_img_cf_has_alpha(img->header.cf);
+    bool canvas_has_alpha = lv_img_cf_has_alpha(canvas->dsc.header.cf);
 
-            ret = _lv_img_buf_transform(&dsc, x, y);
+    /*Transform the image line-by-line*/
+    lv_color_t * cbuf = lv_mem_buf_get(dest_width * sizeof(lv_color_t));
+    lv_opa_t * abuf = lv_mem_buf_get(dest_width);
 
-            if(ret == false) continue;
+    for(y = 0; y < dest_height; y++) {
+        if(_lv_img_buf_transform_line(&dsc, -offset_x, y - offset_y, dest_width, cbuf, abuf) == false) continue;
 
-            if(x + offset_x >= 0 && x + offset_x < dest_width && y + offset_y >= 0 && y + offset_y < dest_height) {
-                /*If the image has no alpha channel just simple set the result color on the canvas*/
-                if(lv_img_cf_has_alpha(img->header.cf) == false) {
-                    lv_img_buf_set_px_color(&canvas->dsc, x + offset_x, y + offset_y, dsc.res.color);
+        for(x = 0; x < dest_width; x++) {
+            lv_opa_t opa = abuf[x];
+            if(opa == LV_OPA_TRANSP) continue;
+
+            /*If the image has no alpha channel just simple set the result color on the canvas.
+             *Anti-aliased edges have partial opacity so they are mixed like the images with alpha.*/
+            if(img_has_alpha == false && opa >= LV_OPA_MAX) {
+                lv_img_buf_set_px_color(&canvas->dsc, x, y, cbuf[x]);
+            }
+            else {
+                lv_color_t bg_color = lv_img_buf_get_px_color(&canvas->dsc, x, y, dsc.cfg.color);
+
+                /*If the canvas has no alpha but the image has mix the image's color with
+                 * canvas*/
+                if(canvas_has_alpha == false) {
+                    if(opa < LV_OPA_MAX) cbuf[x] = lv_color_mix(cbuf[x], bg_color, opa);
+                    lv_img_buf_set_px_color(&canvas->dsc, x, y, cbuf[x]);
                 }
+                /*Both the image and canvas has alpha channel. Some extra calculation is
+                   required*/
                 else {
-                    lv_color_t bg_color = lv_img_buf_get_px_color(&canvas->dsc, x + offset_x, y + offset_y, dsc.cfg.color);
-
-                    /*If the canvas has no alpha but the image has mix the image's color with
-                     * canvas*/
-                    if(lv_img_cf_has_alpha(canvas->dsc.header.cf) == false) {
-                        if(dsc.res.opa < LV_OPA_MAX) dsc.res.color = lv_color_mix(dsc.res.color, bg_color, dsc.res.opa);
-                        lv_img_buf_set_px_color(&canvas->dsc, x + offset_x, y + offset_y, dsc.res.color);
+                    lv_opa_t bg_opa = lv_img_buf_get_px_alpha(&canvas->dsc, x, y);
+                    /*Pick the foreground if it's fully opaque or the Background is fully
+                     *transparent*/
+                    if(opa >= LV_OPA_MAX || bg_opa <= LV_OPA_MIN) {
+                        lv_img_buf_set_px_color(&canvas->dsc, x, y, cbuf[x]);
+                        lv_img_buf_set_px_alpha(&canvas->dsc, x, y, opa);
                     }
-                    /*Both the image and canvas has alpha channel. Some extra calculation is
-                       required*/
+                    /*Opaque background: use simple mix*/
+                    else if(bg_opa >= LV_OPA_MAX) {
+                        lv_img_buf_set_px_color(&canvas->dsc, x, y, lv_color_mix(cbuf[x], bg_color, opa));
+                    }
+                    /*Both colors have alpha. Expensive calculation need to be applied*/
                     else {
-                        lv_opa_t bg_opa = lv_img_buf_get_px_alpha(&canvas->dsc, x + offset_x, y + offset_y);
-                        /*Pick the foreground if it's fully opaque or the Background is fully
-                         *transparent*/
-                        if(dsc.res.opa >= LV_OPA_MAX || bg_opa <= LV_OPA_MIN) {
-                            lv_img_buf_set_px_color(&canvas->dsc, x + offset_x, y + offset_y, dsc.res.color);
-                            lv_img_buf_set_px_alpha(&canvas->dsc, x + offset_x, y + offset_y, dsc.res.opa);
-                        }
-                        /*Opaque background: use simple mix*/
-                        else if(bg_opa >= LV_OPA_MAX) {
-                            lv_img_buf_set_px_color(&canvas->dsc, x + offset_x, y + offset_y,
-                                                    lv_color_mix(dsc.res.color, bg_color, dsc.res.opa));
-                        }
-                        /*Both colors have alpha. Expensive calculation need to be applied*/
-                        else {
-
-                            /*Info:
-                             * https://en.wikipedia.org/wiki/Alpha_compositing#Analytical_derivation_of_the_over_operator*/
-                            lv_opa_t opa_res_2 = 255 - ((uint16_t)((uint16_t)(255 - dsc.res.opa) * (255 - bg_opa)) >> 8);
-                            if(opa_res_2 == 0) {
-                                opa_res_2 = 1; /*never happens, just to be sure*/
-                            }
-                            lv_opa_t ratio = (uint16_t)((uint16_t)dsc.res.opa * 255) / opa_res_2;
-
-                            lv_img_buf_set_px_color(&canvas->dsc, x + offset_x, y + offset_y,
-                                                    lv_color_mix(dsc.res.color, bg_color, ratio));
-                            lv_img_buf_set_px_alpha(&canvas->dsc, x + offset_x, y + offset_y, opa_res_2);
+
+                        /*Info:
+                         * https://en.wikipedia.org/wiki/Alpha_compositing#Analytical_derivation_of_the_over_operator*/
+                        lv_opa_t opa_res_2 = 255 - ((uint16_t)((uint16_t)(255 - opa) * (255 - bg_opa)) >> 8);
+                        if(opa_res_2 == 0) {
+                            opa_res_2 = 1; /*never happens, just to be sure*/
                         }
+                        lv_opa_t ratio = (uint16_t)((uint16_t)opa * 255) / opa_res_2;
+
+                        lv_img_buf_set_px_color(&canvas->dsc, x, y, lv_color_mix(cbuf[x], bg_color, ratio));
+                        lv_img_buf_set_px_alpha(&canvas->dsc, x, y, opa_res_2);
                     }
                 }
             }
         }
     }
 
+    lv_mem_buf_release(abuf);
+    lv_mem_buf_release(cbuf);
+
     lv_obj_invalidate(obj);
 #else
     LV_UNUSED(obj);
@@ -759,10 +765,7 @@ void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t
     lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
     _lv_refr_set_disp_refreshing(&disp);
 
-    uint32_t i;
-    for(i = 0; i < point_cnt - 1; i++) {
-        lv_draw_line(&points[i], &points[i + 1], &mask, draw_dsc);
-    }
+    lv_draw_polyline(points, point_cnt, &mask, draw_dsc);
 
     _lv_refr_set_disp_refreshing(refr_ori);
 
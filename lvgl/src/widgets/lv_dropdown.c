@@ -996,7 +996,8 @@ static lv_res_t list_release_handler(lv_obj_t * list_obj)
     }
 
     /*Search the clicked option (For KEYPAD and ENCODER the new value should be already set)*/
-    if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER || lv_indev_get_type(indev) == LV_INDEV_TYPE_BUTTON) {
+    lv_indev_type_t indev_type = lv_indev_get_type(indev);
+    if(indev_type == LV_INDEV_TYPE_POINTER || indev_type == LV_INDEV_TYPE_MULTI_POINTER || indev_type == LV_INDEV_TYPE_BUTTON) {
         lv_point_t p;
         lv_indev_get_point(indev, &p);
         dropdown->sel_opt_id     = get_id_on_point(dropdown_obj, p.y);
@@ -1022,7 +1023,8 @@ static void list_press_handler(lv_obj_t * list_obj)
     lv_dropdown_t * dropdown = (lv_dropdown_t *)dropdown_obj;
 
     lv_indev_t * indev = lv_indev_get_act();
-    if(indev && (lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER || lv_indev_get_type(indev) == LV_INDEV_TYPE_BUTTON)) {
+    lv_indev_type_t indev_type = lv_indev_get_type(indev);
+    if(indev_type == LV_INDEV_TYPE_POINTER || indev_type == LV_INDEV_TYPE_MULTI_POINTER || indev_type == LV_INDEV_TYPE_BUTTON) {
         lv_point_t p;
         lv_indev_get_point(indev, &p);
         dropdown->pr_opt_id = get_id_on_point(dropdown_obj, p.y);
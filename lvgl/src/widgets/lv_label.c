@@ -17,6 +17,7 @@
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_txt_ap.h"
 #include "../misc/lv_printf.h"
+#include "../misc/lv_async.h"
 
 /*********************
  *      DEFINES
@@ -48,6 +49,9 @@ static char * lv_label_get_dot_tmp(lv_obj_t * label);
 static void lv_label_dot_tmp_free(lv_obj_t * label);
 static void set_ofs_x_anim(void * obj, int32_t v);
 static void set_ofs_y_anim(void * obj, int32_t v);
+#if LV_USE_ASYNC_QUEUE
+static void set_text_async_cb(void * obj, void * text);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -172,6 +176,25 @@ LV_FORMAT_ATTRIBUTE(2, 3) void lv_label_set_text_fmt(lv_obj_t * obj, const char
     lv_label_refr_text(obj);
 }
 
+#if LV_USE_ASYNC_QUEUE
+lv_res_t lv_label_set_text_async(lv_obj_t * obj, const char * text)
+{
+    LV_ASSERT_NULL(text);
+
+    char buf[LV_ASYNC_QUEUE_DATA_SIZE];
+    uint32_t len = strlen(text);
+    if(len > LV_ASYNC_QUEUE_DATA_SIZE - 1) {
+        len = LV_ASYNC_QUEUE_DATA_SIZE - 1;
+        /*Don't cut an UTF-8 character*/
+        while(len > 0 && (text[len] & 0xC0) == 0x80) len--;
+    }
+    lv_memcpy(buf, text, len);
+    buf[len] = '\0';
+
+    return lv_async_post(set_text_async_cb, obj, buf, len + 1, true);
+}
+#endif
+
 void lv_label_set_text_static(lv_obj_t * obj, const char * text)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -1240,3 +1263,10 @@ static void set_ofs_y_anim(void * obj, int32_t v)
 
 
 #endif
+
+#if LV_USE_ASYNC_QUEUE
+static void set_text_async_cb(void * obj, void * text)
+{
+    lv_label_set_text(obj, text);
+}
+#endif
@@ -107,6 +107,17 @@ void lv_label_set_text(lv_obj_t * obj, const char * text);
  */
 void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...) LV_FORMAT_ATTRIBUTE(2, 3);
 
+#if LV_USE_ASYNC_QUEUE
+/**
+ * Set a new text for a label from any thread. The text is copied and set in the next `lv_timer_handler()`.
+ * If the text is set again before that, only the last text is set.
+ * @param obj           pointer to a label object
+ * @param text          '\0' terminated character string. Truncated to `LV_ASYNC_QUEUE_DATA_SIZE - 1` bytes.
+ * @return              LV_RES_OK: posted; LV_RES_INV: the queue is full
+ */
+lv_res_t lv_label_set_text_async(lv_obj_t * obj, const char * text);
+#endif
+
 /**
  * Set a static text. It will not be saved by the label so the 'text' variable
  * has to be 'alive' while the label exists.
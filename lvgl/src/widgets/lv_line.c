@@ -169,8 +169,6 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_obj_get_coords(obj, &area);
         lv_coord_t x_ofs = area.x1 - lv_obj_get_scroll_x(obj);
         lv_coord_t y_ofs = area.y1 - lv_obj_get_scroll_y(obj);
-        lv_point_t p1;
-        lv_point_t p2;
         lv_coord_t h = lv_obj_get_height(obj);
         uint16_t i;
 
@@ -178,23 +176,16 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_draw_line_dsc_init(&line_dsc);
         lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
 
-        /*Read all points and draw the lines*/
-        for(i = 0; i < line->point_num - 1; i++) {
-
-            p1.x = line->point_array[i].x + x_ofs;
-            p2.x = line->point_array[i + 1].x + x_ofs;
-
-            if(line->y_inv == 0) {
-                p1.y = line->point_array[i].y + y_ofs;
-                p2.y = line->point_array[i + 1].y + y_ofs;
-            }
-            else {
-                p1.y = h - line->point_array[i].y + y_ofs;
-                p2.y = h - line->point_array[i + 1].y + y_ofs;
-            }
-            lv_draw_line(&p1, &p2, clip_area, &line_dsc);
-            line_dsc.round_start = 0;   /*Draw the rounding only on the end points after the first line*/
+        /*Convert the points to absolute coordinates and draw all lines at once*/
+        lv_point_t * points = lv_mem_buf_get(line->point_num * sizeof(lv_point_t));
+        for(i = 0; i < line->point_num; i++) {
+            points[i].x = line->point_array[i].x + x_ofs;
+            if(line->y_inv == 0) points[i].y = line->point_array[i].y + y_ofs;
+            else points[i].y = h - line->point_array[i].y + y_ofs;
         }
+
+        lv_draw_polyline(points, line->point_num, clip_area, &line_dsc);
+        lv_mem_buf_release(points);
     }
 }
 #endif
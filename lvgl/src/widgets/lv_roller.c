@@ -646,7 +646,7 @@ static lv_res_t release_handler(lv_obj_t * obj)
         }
     }
 
-    if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER || lv_indev_get_type(indev) == LV_INDEV_TYPE_BUTTON) {
+    if(indev_type == LV_INDEV_TYPE_POINTER || indev_type == LV_INDEV_TYPE_MULTI_POINTER || indev_type == LV_INDEV_TYPE_BUTTON) {
         /*Search the clicked option (For KEYPAD and ENCODER the new value should be already set)*/
         int16_t new_opt  = -1;
         if(roller->moved == 0) {
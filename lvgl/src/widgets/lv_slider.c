@@ -184,7 +184,8 @@ static void lv_slider_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_PRESSING && slider->value_to_set != NULL) {
         lv_indev_t * indev = lv_indev_get_act();
-        if(lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) return;
+        lv_indev_type_t indev_type = lv_indev_get_type(indev);
+        if(indev_type != LV_INDEV_TYPE_POINTER && indev_type != LV_INDEV_TYPE_MULTI_POINTER) return;
 
         lv_point_t p;
         lv_indev_get_point(indev, &p);
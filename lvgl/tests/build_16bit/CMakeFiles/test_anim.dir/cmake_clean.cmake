@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_anim.dir/src/test_cases/test_anim.c.o"
+  "CMakeFiles/test_anim.dir/src/test_cases/test_anim.c.o.d"
+  "CMakeFiles/test_anim.dir/src/test_runners/test_anim_Runner.c.o"
+  "CMakeFiles/test_anim.dir/src/test_runners/test_anim_Runner.c.o.d"
+  "test_anim"
+  "test_anim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_anim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_async_queue.dir/src/test_cases/test_async_queue.c.o"
+  "CMakeFiles/test_async_queue.dir/src/test_cases/test_async_queue.c.o.d"
+  "CMakeFiles/test_async_queue.dir/src/test_runners/test_async_queue_Runner.c.o"
+  "CMakeFiles/test_async_queue.dir/src/test_runners/test_async_queue_Runner.c.o.d"
+  "test_async_queue"
+  "test_async_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_async_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
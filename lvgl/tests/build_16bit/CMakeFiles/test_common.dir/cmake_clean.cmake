@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_common.dir/src/lv_test_indev.c.o"
+  "CMakeFiles/test_common.dir/src/lv_test_indev.c.o.d"
+  "CMakeFiles/test_common.dir/src/lv_test_init.c.o"
+  "CMakeFiles/test_common.dir/src/lv_test_init.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_1.c.o"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_1.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_2.c.o"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_2.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_3.c.o"
+  "CMakeFiles/test_common.dir/src/test_fonts/font_3.c.o.d"
+  "CMakeFiles/test_common.dir/unity/unity.c.o"
+  "CMakeFiles/test_common.dir/unity/unity.c.o.d"
+  "CMakeFiles/test_common.dir/unity/unity_support.c.o"
+  "CMakeFiles/test_common.dir/unity/unity_support.c.o.d"
+  "libtest_common.a"
+  "libtest_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
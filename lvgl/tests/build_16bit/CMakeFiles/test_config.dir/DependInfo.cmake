@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lvgl/tests/src/test_cases/test_config.c" "CMakeFiles/test_config.dir/src/test_cases/test_config.c.o" "gcc" "CMakeFiles/test_config.dir/src/test_cases/test_config.c.o.d"
+  "/root/repo/lvgl/tests/src/test_runners/test_config_Runner.c" "CMakeFiles/test_config.dir/src/test_runners/test_config_Runner.c.o" "gcc" "CMakeFiles/test_config.dir/src/test_runners/test_config_Runner.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/lvgl/tests/build_16bit/CMakeFiles/test_common.dir/DependInfo.cmake"
+  "/root/repo/lvgl/tests/build_16bit/CMakeFiles/lvgl_examples.dir/DependInfo.cmake"
+  "/root/repo/lvgl/tests/build_16bit/CMakeFiles/lvgl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vlist.dir/src/test_cases/test_vlist.c.o"
+  "CMakeFiles/test_vlist.dir/src/test_cases/test_vlist.c.o.d"
+  "CMakeFiles/test_vlist.dir/src/test_runners/test_vlist_Runner.c.o"
+  "CMakeFiles/test_vlist.dir/src/test_runners/test_vlist_Runner.c.o.d"
+  "test_vlist"
+  "test_vlist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_vlist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
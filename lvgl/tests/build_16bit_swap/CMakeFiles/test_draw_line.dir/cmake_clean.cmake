@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_line.dir/src/test_cases/test_draw_line.c.o"
+  "CMakeFiles/test_draw_line.dir/src/test_cases/test_draw_line.c.o.d"
+  "CMakeFiles/test_draw_line.dir/src/test_runners/test_draw_line_Runner.c.o"
+  "CMakeFiles/test_draw_line.dir/src/test_runners/test_draw_line_Runner.c.o.d"
+  "test_draw_line"
+  "test_draw_line.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_line.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_event.dir/src/test_cases/test_event.c.o"
+  "CMakeFiles/test_event.dir/src/test_cases/test_event.c.o.d"
+  "CMakeFiles/test_event.dir/src/test_runners/test_event_Runner.c.o"
+  "CMakeFiles/test_event.dir/src/test_runners/test_event_Runner.c.o.d"
+  "test_event"
+  "test_event.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_event.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
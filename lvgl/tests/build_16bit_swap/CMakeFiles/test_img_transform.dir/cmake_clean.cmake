@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_img_transform.dir/src/test_cases/test_img_transform.c.o"
+  "CMakeFiles/test_img_transform.dir/src/test_cases/test_img_transform.c.o.d"
+  "CMakeFiles/test_img_transform.dir/src/test_runners/test_img_transform_Runner.c.o"
+  "CMakeFiles/test_img_transform.dir/src/test_runners/test_img_transform_Runner.c.o.d"
+  "test_img_transform"
+  "test_img_transform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_img_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_timer.dir/src/test_cases/test_timer.c.o"
+  "CMakeFiles/test_timer.dir/src/test_cases/test_timer.c.o.d"
+  "CMakeFiles/test_timer.dir/src/test_runners/test_timer_Runner.c.o"
+  "CMakeFiles/test_timer.dir/src/test_runners/test_timer_Runner.c.o.d"
+  "test_timer"
+  "test_timer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_timer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_polygon.dir/src/test_cases/test_draw_polygon.c.o"
+  "CMakeFiles/test_draw_polygon.dir/src/test_cases/test_draw_polygon.c.o.d"
+  "CMakeFiles/test_draw_polygon.dir/src/test_runners/test_draw_polygon_Runner.c.o"
+  "CMakeFiles/test_draw_polygon.dir/src/test_runners/test_draw_polygon_Runner.c.o.d"
+  "test_draw_polygon"
+  "test_draw_polygon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_polygon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
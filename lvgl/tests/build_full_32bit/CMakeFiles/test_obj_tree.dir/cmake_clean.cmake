@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_obj_tree.dir/src/test_cases/test_obj_tree.c.o"
+  "CMakeFiles/test_obj_tree.dir/src/test_cases/test_obj_tree.c.o.d"
+  "CMakeFiles/test_obj_tree.dir/src/test_runners/test_obj_tree_Runner.c.o"
+  "CMakeFiles/test_obj_tree.dir/src/test_runners/test_obj_tree_Runner.c.o.d"
+  "test_obj_tree"
+  "test_obj_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_obj_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scroll.dir/src/test_cases/test_scroll.c.o"
+  "CMakeFiles/test_scroll.dir/src/test_cases/test_scroll.c.o.d"
+  "CMakeFiles/test_scroll.dir/src/test_runners/test_scroll_Runner.c.o"
+  "CMakeFiles/test_scroll.dir/src/test_runners/test_scroll_Runner.c.o.d"
+  "test_scroll"
+  "test_scroll.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_scroll.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
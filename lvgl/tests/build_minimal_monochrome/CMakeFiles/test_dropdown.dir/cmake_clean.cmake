@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dropdown.dir/src/test_cases/test_dropdown.c.o"
+  "CMakeFiles/test_dropdown.dir/src/test_cases/test_dropdown.c.o.d"
+  "CMakeFiles/test_dropdown.dir/src/test_runners/test_dropdown_Runner.c.o"
+  "CMakeFiles/test_dropdown.dir/src/test_runners/test_dropdown_Runner.c.o.d"
+  "test_dropdown"
+  "test_dropdown.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dropdown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
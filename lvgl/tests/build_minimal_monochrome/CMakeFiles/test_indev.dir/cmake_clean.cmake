@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_indev.dir/src/test_cases/test_indev.c.o"
+  "CMakeFiles/test_indev.dir/src/test_cases/test_indev.c.o.d"
+  "CMakeFiles/test_indev.dir/src/test_runners/test_indev_Runner.c.o"
+  "CMakeFiles/test_indev.dir/src/test_runners/test_indev_Runner.c.o.d"
+  "test_indev"
+  "test_indev.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_indev.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
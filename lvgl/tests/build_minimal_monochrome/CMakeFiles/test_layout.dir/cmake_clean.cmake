@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_layout.dir/src/test_cases/test_layout.c.o"
+  "CMakeFiles/test_layout.dir/src/test_cases/test_layout.c.o.d"
+  "CMakeFiles/test_layout.dir/src/test_runners/test_layout_Runner.c.o"
+  "CMakeFiles/test_layout.dir/src/test_runners/test_layout_Runner.c.o.d"
+  "test_layout"
+  "test_layout.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_layout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inv_area.dir/src/test_cases/test_inv_area.c.o"
+  "CMakeFiles/test_inv_area.dir/src/test_cases/test_inv_area.c.o.d"
+  "CMakeFiles/test_inv_area.dir/src/test_runners/test_inv_area_Runner.c.o"
+  "CMakeFiles/test_inv_area.dir/src/test_runners/test_inv_area_Runner.c.o.d"
+  "test_inv_area"
+  "test_inv_area.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_inv_area.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lvgl/tests
+# Build directory: /root/repo/lvgl/tests/build_normal_8bit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_anim "/root/repo/lvgl/tests/build_normal_8bit/test_anim")
+set_tests_properties(test_anim PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_async_queue "/root/repo/lvgl/tests/build_normal_8bit/test_async_queue")
+set_tests_properties(test_async_queue PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_config "/root/repo/lvgl/tests/build_normal_8bit/test_config")
+set_tests_properties(test_config PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_arc "/root/repo/lvgl/tests/build_normal_8bit/test_draw_arc")
+set_tests_properties(test_draw_arc PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_line "/root/repo/lvgl/tests/build_normal_8bit/test_draw_line")
+set_tests_properties(test_draw_line PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_polygon "/root/repo/lvgl/tests/build_normal_8bit/test_draw_polygon")
+set_tests_properties(test_draw_polygon PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_dropdown "/root/repo/lvgl/tests/build_normal_8bit/test_dropdown")
+set_tests_properties(test_dropdown PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_event "/root/repo/lvgl/tests/build_normal_8bit/test_event")
+set_tests_properties(test_event PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_font_loader "/root/repo/lvgl/tests/build_normal_8bit/test_font_loader")
+set_tests_properties(test_font_loader PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_grid "/root/repo/lvgl/tests/build_normal_8bit/test_grid")
+set_tests_properties(test_grid PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_img_transform "/root/repo/lvgl/tests/build_normal_8bit/test_img_transform")
+set_tests_properties(test_img_transform PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_indev "/root/repo/lvgl/tests/build_normal_8bit/test_indev")
+set_tests_properties(test_indev PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_inv_area "/root/repo/lvgl/tests/build_normal_8bit/test_inv_area")
+set_tests_properties(test_inv_area PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_layout "/root/repo/lvgl/tests/build_normal_8bit/test_layout")
+set_tests_properties(test_layout PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_obj_tree "/root/repo/lvgl/tests/build_normal_8bit/test_obj_tree")
+set_tests_properties(test_obj_tree PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_scroll "/root/repo/lvgl/tests/build_normal_8bit/test_scroll")
+set_tests_properties(test_scroll PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_snapshot_layer "/root/repo/lvgl/tests/build_normal_8bit/test_snapshot_layer")
+set_tests_properties(test_snapshot_layer PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_style "/root/repo/lvgl/tests/build_normal_8bit/test_style")
+set_tests_properties(test_style PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_timer "/root/repo/lvgl/tests/build_normal_8bit/test_timer")
+set_tests_properties(test_timer PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_vlist "/root/repo/lvgl/tests/build_normal_8bit/test_vlist")
+set_tests_properties(test_vlist PROPERTIES  WORKING_DIRECTORY "/root/repo/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/lvgl/tests/CMakeLists.txt;306;add_test;/root/repo/lvgl/tests/CMakeLists.txt;0;")
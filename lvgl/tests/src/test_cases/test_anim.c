@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_anim_del_in_ready_cb(void);
+void test_anim_inv_area_join(void);
+void test_anim_present_time(void);
+
+static int32_t values[3];
+static uint32_t ready_cnt;
+
+static void value_exec_cb(void * var, int32_t v)
+{
+  *((int32_t *)var) = v;
+}
+
+static void del_ready_cb(lv_anim_t * a)
+{
+  LV_UNUSED(a);
+  ready_cnt++;
+  lv_anim_del(&values[1], value_exec_cb);
+}
+
+static void ready_cb(lv_anim_t * a)
+{
+  LV_UNUSED(a);
+  ready_cnt++;
+}
+
+static void value_anim_start(int32_t * var, uint32_t time, lv_anim_ready_cb_t cb)
+{
+  lv_anim_t a;
+  lv_anim_init(&a);
+  lv_anim_set_var(&a, var);
+  lv_anim_set_exec_cb(&a, value_exec_cb);
+  lv_anim_set_values(&a, 0, 1000);
+  lv_anim_set_time(&a, time);
+  lv_anim_set_ready_cb(&a, cb);
+  lv_anim_start(&a);
+}
+
+void test_anim_del_in_ready_cb(void)
+{
+  lv_anim_del_all();
+  ready_cnt = 0;
+  value_anim_start(&values[2], 100, ready_cb);
+  value_anim_start(&values[1], 200, ready_cb);
+  value_anim_start(&values[0], 100, del_ready_cb);
+  TEST_ASSERT_EQUAL(3, lv_anim_count_running());
+
+  lv_tick_inc(50);
+  lv_anim_refr_now();
+  TEST_ASSERT_EQUAL(500, values[0]);
+  TEST_ASSERT_EQUAL(250, values[1]);
+  TEST_ASSERT_EQUAL(500, values[2]);
+
+  /*The animations after the deleted one still run but only once*/
+  lv_tick_inc(50);
+  lv_anim_refr_now();
+  TEST_ASSERT_EQUAL(2, ready_cnt);
+  TEST_ASSERT_EQUAL(1000, values[0]);
+  TEST_ASSERT_EQUAL(250, values[1]);
+  TEST_ASSERT_EQUAL(1000, values[2]);
+  TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+  TEST_ASSERT_NULL(lv_anim_get(&values[1], value_exec_cb));
+}
+
+static void bg_opa_exec_cb(void * var, int32_t v)
+{
+  lv_obj_set_style_bg_opa(var, v, 0);
+}
+
+void test_anim_inv_area_join(void)
+{
+  lv_obj_t * objs[2];
+  uint32_t i;
+  for(i = 0; i < 2; i++) {
+    objs[i] = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(objs[i]);
+    lv_obj_set_style_bg_color(objs[i], lv_color_hex(0xff0000), 0);
+    lv_obj_set_size(objs[i], 50, 50);
+    lv_obj_set_pos(objs[i], 10 + i * 50, 10);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, objs[i]);
+    lv_anim_set_values(&a, 0, 255);
+    lv_anim_set_time(&a, 100);
+    lv_anim_set_exec_cb(&a, bg_opa_exec_cb);
+    lv_anim_start(&a);
+  }
+  lv_refr_now(NULL);
+
+  /*The areas of the neighbouring objects are saved as one area*/
+  lv_disp_t * disp = lv_disp_get_default();
+  TEST_ASSERT_EQUAL(0, disp->inv_p);
+  lv_tick_inc(10);
+  lv_anim_refr_now();
+  TEST_ASSERT_NOT_EQUAL(0, lv_obj_get_style_bg_opa(objs[1], 0));
+  TEST_ASSERT_EQUAL(1, disp->inv_p);
+  TEST_ASSERT_EQUAL(10, disp->inv_areas[0].x1);
+  TEST_ASSERT_EQUAL(109, disp->inv_areas[0].x2);
+  TEST_ASSERT_EQUAL(10, disp->inv_areas[0].y1);
+  TEST_ASSERT_EQUAL(59, disp->inv_areas[0].y2);
+
+  for(i = 0; i < 2; i++) {
+    lv_anim_del(objs[i], NULL);
+    lv_obj_del(objs[i]);
+  }
+}
+
+void test_anim_present_time(void)
+{
+  lv_anim_del_all();
+  lv_disp_t * disp = lv_disp_get_default();
+
+  /*The display presents a frame in every 20 ms. The reports are processed when the time is queried.*/
+  uint32_t i;
+  for(i = 0; i < 10; i++) {
+    lv_disp_report_present(disp->driver, lv_tick_get());
+    lv_disp_get_next_present_time(disp);
+    lv_tick_inc(20);
+  }
+  TEST_ASSERT_EQUAL(20 * 16, disp->present_period);
+
+  lv_tick_inc(5);
+  TEST_ASSERT_EQUAL(lv_tick_get() + 15, lv_disp_get_next_present_time(disp));
+
+  /*The animations are evaluated for the time of the next frame*/
+  value_anim_start(&values[0], 100, NULL);
+  lv_anim_refr_now();
+  TEST_ASSERT_INT_WITHIN(1, 150, values[0]);
+
+  lv_tick_inc(3);
+  lv_anim_refr_now();
+  TEST_ASSERT_INT_WITHIN(1, 150, values[0]);
+
+  lv_tick_inc(20);
+  lv_anim_refr_now();
+  TEST_ASSERT_INT_WITHIN(1, 350, values[0]);
+
+  /*Use the current time if there were no presentations for a long time*/
+  lv_tick_inc(LV_DISP_PRESENT_TIMEOUT + 1);
+  TEST_ASSERT_EQUAL(lv_tick_get(), lv_disp_get_next_present_time(disp));
+
+  lv_anim_del_all();
+  disp->present_period = 0;
+  disp->present_reported = 0;
+}
+
+#endif
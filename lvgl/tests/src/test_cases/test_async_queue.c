@@ -0,0 +1,231 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <pthread.h>
+#include <sched.h>
+
+void test_async_queue_coalesce(void);
+void test_async_queue_order(void);
+void test_async_queue_full(void);
+void test_async_queue_delete(void);
+void test_async_queue_remove_series(void);
+void test_async_queue_threads(void);
+
+#if LV_USE_ASYNC_QUEUE
+
+#define PRODUCER_CNT    4
+#define POST_CNT        1000
+
+static uint32_t update_cnt;
+static uint32_t received[PRODUCER_CNT];
+static bool out_of_order;
+
+static void count_cb(void * target, void * data)
+{
+  LV_UNUSED(target);
+  LV_UNUSED(data);
+  update_cnt++;
+}
+
+/*The data is the index of the producer and the number of its post*/
+static void receive_cb(void * target, void * data)
+{
+  LV_UNUSED(target);
+  uint32_t * d = data;
+  if(d[1] != received[d[0]]) out_of_order = true;
+  received[d[0]]++;
+}
+
+static void * producer_thread(void * arg)
+{
+  uint32_t d[2];
+  d[0] = (uint32_t)(uintptr_t)arg;
+  for(d[1] = 0; d[1] < POST_CNT; d[1]++) {
+    while(lv_async_post(receive_cb, NULL, d, sizeof(d), false) != LV_RES_OK) {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+void test_async_queue_coalesce(void)
+{
+  lv_obj_t * label = lv_label_create(lv_scr_act());
+  lv_label_set_text(label, "0");
+
+  /*Only the last text is set*/
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_label_set_text_async(label, "1"));
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_label_set_text_async(label, "2"));
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_label_set_text_async(label, "3"));
+  TEST_ASSERT_EQUAL_STRING("0", lv_label_get_text(label));
+
+  update_cnt = 0;
+  lv_async_post(count_cb, label, NULL, 0, true);
+  lv_async_post(count_cb, label, NULL, 0, true);
+  lv_async_post(count_cb, NULL, NULL, 0, true);
+  lv_timer_handler();
+
+  TEST_ASSERT_EQUAL_STRING("3", lv_label_get_text(label));
+  /*Different targets are not coalesced*/
+  TEST_ASSERT_EQUAL(2, update_cnt);
+
+  /*Long texts are truncated*/
+  char text[LV_ASYNC_QUEUE_DATA_SIZE + 8];
+  lv_memset(text, 'a', sizeof(text) - 1);
+  text[sizeof(text) - 1] = '\0';
+  lv_label_set_text_async(label, text);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(LV_ASYNC_QUEUE_DATA_SIZE - 1, strlen(lv_label_get_text(label)));
+
+  lv_obj_del(label);
+}
+
+void test_async_queue_order(void)
+{
+  lv_obj_t * chart = lv_chart_create(lv_scr_act());
+  lv_chart_set_point_count(chart, 3);
+  lv_chart_series_t * ser = lv_chart_add_series(chart, lv_color_black(), LV_CHART_AXIS_PRIMARY_Y);
+
+  /*All the values are added in order*/
+  lv_chart_set_next_value_async(chart, ser, 10);
+  lv_chart_set_next_value_async(chart, ser, 20);
+  lv_chart_set_next_value_async(chart, ser, 30);
+  lv_timer_handler();
+
+  TEST_ASSERT_EQUAL(10, ser->y_points[0]);
+  TEST_ASSERT_EQUAL(20, ser->y_points[1]);
+  TEST_ASSERT_EQUAL(30, ser->y_points[2]);
+
+  lv_obj_del(chart);
+}
+
+void test_async_queue_full(void)
+{
+  update_cnt = 0;
+  uint32_t i;
+  for(i = 0; i < LV_ASYNC_QUEUE_SIZE; i++) {
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_async_post(count_cb, NULL, NULL, 0, false));
+  }
+  TEST_ASSERT_EQUAL(LV_RES_INV, lv_async_post(count_cb, NULL, NULL, 0, false));
+
+  uint8_t large[LV_ASYNC_QUEUE_DATA_SIZE + 1];
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(LV_ASYNC_QUEUE_SIZE, update_cnt);
+  TEST_ASSERT_EQUAL(LV_RES_INV, lv_async_post(count_cb, NULL, large, sizeof(large), false));
+
+  /*There is space again*/
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_async_post(count_cb, NULL, NULL, 0, false));
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(LV_ASYNC_QUEUE_SIZE + 1, update_cnt);
+}
+
+void test_async_queue_delete(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_t * label = lv_label_create(parent);
+
+  /*The updates of the deleted objects are dropped*/
+  update_cnt = 0;
+  lv_label_set_text_async(label, "deleted");
+  lv_async_post(count_cb, label, NULL, 0, false);
+  lv_async_post(count_cb, parent, NULL, 0, false);
+  lv_async_post(count_cb, NULL, NULL, 0, false);
+  lv_obj_del(parent);
+  lv_timer_handler();
+
+  TEST_ASSERT_EQUAL(1, update_cnt);
+}
+
+void test_async_queue_remove_series(void)
+{
+  lv_obj_t * chart = lv_chart_create(lv_scr_act());
+  lv_chart_set_point_count(chart, 3);
+  lv_chart_series_t * ser1 = lv_chart_add_series(chart, lv_color_black(), LV_CHART_AXIS_PRIMARY_Y);
+  lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_color_black(), LV_CHART_AXIS_PRIMARY_Y);
+
+  /*The buffers outlive the series to see if a value is still written to them*/
+  lv_coord_t points1[3] = {LV_CHART_POINT_NONE, LV_CHART_POINT_NONE, LV_CHART_POINT_NONE};
+  lv_coord_t points2[3] = {LV_CHART_POINT_NONE, LV_CHART_POINT_NONE, LV_CHART_POINT_NONE};
+  lv_chart_set_ext_y_array(chart, ser1, points1);
+  lv_chart_set_ext_y_array(chart, ser2, points2);
+
+  /*The values of a removed series are dropped and not added to a new series allocated in its place*/
+  lv_chart_set_next_value_async(chart, ser1, 10);
+  lv_chart_set_next_value_async(chart, ser2, 20);
+  lv_chart_set_next_value_async(chart, ser1, 30);
+  lv_chart_remove_series(chart, ser1);
+  lv_chart_series_t * ser3 = lv_chart_add_series(chart, lv_color_black(), LV_CHART_AXIS_PRIMARY_Y);
+  lv_coord_t points3[3] = {LV_CHART_POINT_NONE, LV_CHART_POINT_NONE, LV_CHART_POINT_NONE};
+  lv_chart_set_ext_y_array(chart, ser3, points3);
+  lv_timer_handler();
+
+  TEST_ASSERT_EQUAL(LV_CHART_POINT_NONE, points1[0]);
+  TEST_ASSERT_EQUAL(LV_CHART_POINT_NONE, points3[0]);
+  TEST_ASSERT_EQUAL(LV_CHART_POINT_NONE, points3[1]);
+  TEST_ASSERT_EQUAL(20, points2[0]);
+
+  /*The series are removed with the chart too*/
+  lv_chart_set_next_value_async(chart, ser2, 40);
+  lv_obj_del(chart);
+  lv_timer_handler();
+
+  TEST_ASSERT_EQUAL(LV_CHART_POINT_NONE, points2[1]);
+}
+
+void test_async_queue_threads(void)
+{
+  pthread_t threads[PRODUCER_CNT];
+  uint32_t i;
+  lv_memset_00(received, sizeof(received));
+  out_of_order = false;
+
+  for(i = 0; i < PRODUCER_CNT; i++) {
+    pthread_create(&threads[i], NULL, producer_thread, (void *)(uintptr_t)i);
+  }
+
+  /*Apply the updates while the producers are posting*/
+  uint32_t total;
+  do {
+    lv_timer_handler();
+    total = 0;
+    for(i = 0; i < PRODUCER_CNT; i++) total += received[i];
+  } while(total < PRODUCER_CNT * POST_CNT);
+
+  for(i = 0; i < PRODUCER_CNT; i++) {
+    pthread_join(threads[i], NULL);
+    TEST_ASSERT_EQUAL(POST_CNT, received[i]);
+  }
+  TEST_ASSERT_FALSE(out_of_order);
+}
+
+#else
+
+void test_async_queue_coalesce(void)
+{
+}
+
+void test_async_queue_order(void)
+{
+}
+
+void test_async_queue_full(void)
+{
+}
+
+void test_async_queue_delete(void)
+{
+}
+
+void test_async_queue_remove_series(void)
+{
+}
+
+void test_async_queue_threads(void)
+{
+}
+
+#endif /*LV_USE_ASYNC_QUEUE*/
+
+#endif
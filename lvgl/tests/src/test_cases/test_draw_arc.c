@@ -0,0 +1,80 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_draw_arc_ring(void);
+void test_draw_arc_rounded(void);
+
+#if LV_DRAW_COMPLEX
+
+#define CANVAS_W  40
+#define CANVAS_H  40
+
+static lv_color_t canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W, CANVAS_H)];
+
+static lv_obj_t * canvas_create(void)
+{
+  lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+  lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+  lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+  return canvas;
+}
+
+void test_draw_arc_ring(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  lv_draw_arc_dsc_t dsc;
+  lv_draw_arc_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 6;
+  lv_canvas_draw_arc(canvas, 20, 20, 16, 0, 360, &dsc);
+
+  /*The ring is between radius 10 and 16 and the middle is not drawn*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20 + 13, 20));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20, 20 - 13));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20 - 13, 20));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 20, 20));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 20 + 7, 20));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 1, 1));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_arc_rounded(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  lv_draw_arc_dsc_t dsc;
+  lv_draw_arc_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 6;
+  dsc.rounded = 1;
+  lv_canvas_draw_arc(canvas, 20, 20, 16, 0, 90, &dsc);
+
+  /*Only the bottom right quarter is drawn*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20 + 9, 20 + 9));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 20 - 9, 20 - 9));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 20 - 13, 20 + 3));
+
+  /*The round ending extends the arc over the start angle*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20 + 13, 20 - 2));
+
+  lv_obj_del(canvas);
+}
+
+#else
+
+/*Arcs are available only with LV_DRAW_COMPLEX*/
+void test_draw_arc_ring(void)
+{
+}
+
+void test_draw_arc_rounded(void)
+{
+}
+
+#endif /*LV_DRAW_COMPLEX*/
+
+#endif
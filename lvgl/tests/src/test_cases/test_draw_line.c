@@ -0,0 +1,149 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_draw_polyline_miter_join(void);
+void test_draw_polyline_round_join(void);
+void test_draw_polyline_blend_once(void);
+void test_draw_polyline_long(void);
+
+#if LV_DRAW_COMPLEX
+
+#define CANVAS_W_MAX  100
+#define CANVAS_H_MAX  40
+
+static lv_color_t canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W_MAX, CANVAS_H_MAX)];
+
+static lv_obj_t * canvas_create(lv_coord_t w, lv_coord_t h)
+{
+  lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+  lv_canvas_set_buffer(canvas, canvas_buf, w, h, LV_IMG_CF_TRUE_COLOR);
+  lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+  return canvas;
+}
+
+void test_draw_polyline_miter_join(void)
+{
+  lv_obj_t * canvas = canvas_create(40, 40);
+
+  lv_draw_line_dsc_t dsc;
+  lv_draw_line_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 6;
+
+  lv_point_t points[] = {{5, 30}, {20, 10}, {35, 30}};
+  lv_canvas_draw_line(canvas, points, 3, &dsc);
+
+  /*The miter reaches 5 px above the corner*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 19, 7));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 20, 7));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 19, 3));
+
+  /*Inside the corner*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 19, 12));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 19, 20));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polyline_round_join(void)
+{
+  lv_obj_t * canvas = canvas_create(40, 40);
+
+  lv_draw_line_dsc_t dsc;
+  lv_draw_line_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 6;
+  dsc.round_start = 1;
+  dsc.round_end = 1;
+
+  lv_point_t points[] = {{5, 30}, {20, 10}, {35, 30}};
+  lv_canvas_draw_line(canvas, points, 3, &dsc);
+
+  /*The round join ends 3 px above the corner*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 19, 8));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 19, 6));
+
+  /*Round endings*/
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 3, 31));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 36, 31));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polyline_blend_once(void)
+{
+  lv_obj_t * canvas = canvas_create(40, 40);
+
+  lv_draw_line_dsc_t dsc;
+  lv_draw_line_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 4;
+  dsc.opa = LV_OPA_50;
+
+  /*The line goes back on itself but the overlapping part should look like a simple line*/
+  lv_point_t points[] = {{5, 10}, {35, 10}, {20, 10}};
+  lv_canvas_draw_line(canvas, points, 3, &dsc);
+
+  lv_point_t ref_points[] = {{5, 30}, {35, 30}};
+  lv_canvas_draw_line(canvas, ref_points, 2, &dsc);
+
+  TEST_ASSERT_EQUAL_COLOR(lv_canvas_get_px(canvas, 25, 30), lv_canvas_get_px(canvas, 25, 10));
+  TEST_ASSERT_EQUAL_COLOR(lv_canvas_get_px(canvas, 10, 30), lv_canvas_get_px(canvas, 10, 10));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 25, 20));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polyline_long(void)
+{
+  lv_obj_t * canvas = canvas_create(CANVAS_W_MAX, CANVAS_H_MAX);
+
+  lv_draw_line_dsc_t dsc;
+  lv_draw_line_dsc_init(&dsc);
+  dsc.color = lv_color_black();
+  dsc.width = 4;
+  dsc.opa = LV_OPA_50;
+
+  /*A line with many points is drawn in parts. The parts shouldn't be visible.*/
+  lv_point_t points[CANVAS_W_MAX];
+  uint32_t i;
+  for(i = 0; i < CANVAS_W_MAX; i++) {
+    points[i].x = i;
+    points[i].y = 20;
+  }
+  lv_canvas_draw_line(canvas, points, CANVAS_W_MAX, &dsc);
+
+  lv_color_t ref = lv_canvas_get_px(canvas, 2, 20);
+  TEST_ASSERT_TRUE(ref.full != lv_color_white().full);
+  for(i = 2; i < CANVAS_W_MAX - 2; i++) {
+    TEST_ASSERT_EQUAL_COLOR(ref, lv_canvas_get_px(canvas, i, 19));
+    TEST_ASSERT_EQUAL_COLOR(ref, lv_canvas_get_px(canvas, i, 20));
+  }
+
+  lv_obj_del(canvas);
+}
+
+#else
+
+/*Polylines are drawn segment by segment without LV_DRAW_COMPLEX*/
+void test_draw_polyline_miter_join(void)
+{
+}
+
+void test_draw_polyline_round_join(void)
+{
+}
+
+void test_draw_polyline_blend_once(void)
+{
+}
+
+void test_draw_polyline_long(void)
+{
+}
+
+#endif /*LV_DRAW_COMPLEX*/
+
+#endif
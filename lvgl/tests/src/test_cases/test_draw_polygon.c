@@ -0,0 +1,102 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_draw_polygon_rect(void);
+void test_draw_polygon_concave(void);
+void test_draw_polygon_many_points(void);
+void test_draw_polygon_antialias(void);
+
+#define CANVAS_W  24
+#define CANVAS_H  24
+
+static lv_color_t canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W, CANVAS_H)];
+
+static lv_obj_t * canvas_create(void)
+{
+  lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+  lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+  lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+  return canvas;
+}
+
+static void draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32_t point_cnt)
+{
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+  dsc.bg_color = lv_color_black();
+  lv_canvas_draw_polygon(canvas, points, point_cnt, &dsc);
+}
+
+void test_draw_polygon_rect(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  /*The points are on the top left corner of the pixels*/
+  lv_point_t p[] = {{2, 2}, {8, 2}, {8, 6}, {2, 6}};
+  draw_polygon(canvas, p, 4);
+
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 2, 2));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 7, 5));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 8, 2));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 2, 6));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 1, 1));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polygon_concave(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  /*"U" shape*/
+  lv_point_t p[] = {{0, 0}, {12, 0}, {12, 10}, {8, 10}, {8, 4}, {4, 4}, {4, 10}, {0, 10}};
+  draw_polygon(canvas, p, 8);
+
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 2, 7));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 10, 7));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 6, 2));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 6, 7));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polygon_many_points(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  /*Much more edges than the number of available mask slots*/
+  lv_point_t p[90];
+  uint32_t i;
+  for(i = 0; i < 90; i++) {
+    p[i].x = 12 + (10 * lv_trigo_cos(i * 4)) / LV_TRIGO_SIN_MAX;
+    p[i].y = 12 + (10 * lv_trigo_sin(i * 4)) / LV_TRIGO_SIN_MAX;
+  }
+  draw_polygon(canvas, p, 90);
+
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 12, 12));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 5, 12));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 2, 2));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 21, 21));
+
+  lv_obj_del(canvas);
+}
+
+void test_draw_polygon_antialias(void)
+{
+  lv_obj_t * canvas = canvas_create();
+
+  lv_point_t p[] = {{0, 0}, {20, 0}, {0, 20}};
+  draw_polygon(canvas, p, 3);
+
+  /*The diagonal halves the pixels on it*/
+  lv_color_t c = lv_canvas_get_px(canvas, 10, 9);
+  TEST_ASSERT_INT_WITHIN(8, 0x7F, LV_COLOR_GET_G(c));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_black(), lv_canvas_get_px(canvas, 9, 9));
+  TEST_ASSERT_EQUAL_COLOR(lv_color_white(), lv_canvas_get_px(canvas, 11, 9));
+
+  lv_obj_del(canvas);
+}
+
+#endif
@@ -0,0 +1,108 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_event_filter(void);
+void test_event_remove(void);
+void test_event_bubble(void);
+
+static uint32_t clicked_cnt;
+static uint32_t all_cnt;
+static uint32_t custom_cnt;
+
+static void clicked_event_cb(lv_event_t * e)
+{
+  TEST_ASSERT_EQUAL(LV_EVENT_CLICKED, lv_event_get_code(e));
+  clicked_cnt++;
+}
+
+static void all_event_cb(lv_event_t * e)
+{
+  LV_UNUSED(e);
+  all_cnt++;
+}
+
+static void custom_event_cb(lv_event_t * e)
+{
+  uint32_t * cnt = lv_event_get_user_data(e);
+  (*cnt)++;
+}
+
+void test_event_filter(void)
+{
+  lv_obj_t * obj = lv_obj_create(lv_scr_act());
+  clicked_cnt = 0;
+  custom_cnt = 0;
+
+  uint32_t custom_code = lv_event_register_id();
+  lv_obj_add_event_cb(obj, clicked_event_cb, LV_EVENT_CLICKED, NULL);
+  lv_obj_add_event_cb(obj, custom_event_cb, custom_code, &custom_cnt);
+
+  lv_event_send(obj, LV_EVENT_PRESSED, NULL);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  lv_event_send(obj, custom_code, NULL);
+  TEST_ASSERT_EQUAL(2, clicked_cnt);
+  TEST_ASSERT_EQUAL(1, custom_cnt);
+  TEST_ASSERT_EQUAL_PTR(&custom_cnt, lv_obj_get_event_user_data(obj, custom_event_cb));
+  TEST_ASSERT_NULL(lv_obj_get_event_user_data(obj, all_event_cb));
+
+  lv_obj_del(obj);
+}
+
+void test_event_remove(void)
+{
+  lv_obj_t * obj = lv_obj_create(lv_scr_act());
+  clicked_cnt = 0;
+  all_cnt = 0;
+
+  struct _lv_event_dsc_t * dsc = lv_obj_add_event_cb(obj, all_event_cb, LV_EVENT_ALL, NULL);
+  lv_obj_add_event_cb(obj, clicked_event_cb, LV_EVENT_CLICKED, NULL);
+  lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(2, all_cnt);
+  TEST_ASSERT_EQUAL(1, clicked_cnt);
+
+  /*The remaining callbacks are still called*/
+  lv_obj_remove_event_dsc(obj, dsc);
+  lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(2, all_cnt);
+  TEST_ASSERT_EQUAL(2, clicked_cnt);
+
+  lv_obj_add_event_cb(obj, clicked_event_cb, LV_EVENT_CLICKED, NULL);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(4, clicked_cnt);
+
+  lv_obj_remove_event_cb(obj, clicked_event_cb);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(5, clicked_cnt);
+
+  lv_obj_remove_event_cb(obj, clicked_event_cb);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(5, clicked_cnt);
+
+  lv_obj_del(obj);
+}
+
+void test_event_bubble(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_t * obj = lv_obj_create(parent);
+  clicked_cnt = 0;
+
+  /*The parent gets the event even if the child has no callback for it*/
+  lv_obj_add_event_cb(parent, clicked_event_cb, LV_EVENT_CLICKED, NULL);
+  lv_obj_add_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(1, clicked_cnt);
+
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+  lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+  TEST_ASSERT_EQUAL(1, clicked_cnt);
+
+  lv_obj_del(parent);
+}
+
+#endif
@@ -0,0 +1,153 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_grid_content_track_update(void);
+void test_grid_track_move(void);
+void test_grid_template_change(void);
+
+#define COL_CNT     3
+#define ROW_CNT     4
+
+static lv_coord_t col_dsc[] = {LV_GRID_CONTENT, 50, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+static lv_coord_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+static lv_obj_t * items[ROW_CNT][COL_CNT];
+
+static lv_obj_t * grid_create(void)
+{
+  lv_obj_t * cont = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(cont);
+  lv_obj_set_size(cont, 300, 200);
+  lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+  uint32_t row;
+  uint32_t col;
+  for(row = 0; row < ROW_CNT; row++) {
+    for(col = 0; col < COL_CNT; col++) {
+      lv_obj_t * item = lv_obj_create(cont);
+      lv_obj_remove_style_all(item);
+      lv_obj_set_size(item, 40, 20);
+      lv_obj_set_grid_cell(item, LV_GRID_ALIGN_START, col, 1, LV_GRID_ALIGN_START, row, 1);
+      items[row][col] = item;
+    }
+  }
+
+  lv_obj_update_layout(cont);
+  return cont;
+}
+
+void test_grid_content_track_update(void)
+{
+  lv_obj_t * cont = grid_create();
+  TEST_ASSERT_EQUAL(40, lv_obj_get_x(items[2][1]));
+  TEST_ASSERT_EQUAL(90, lv_obj_get_x(items[2][2]));
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[3][0]));
+
+  /*A larger item makes its CONTENT tracks larger*/
+  lv_obj_set_size(items[1][0], 60, 30);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(60, lv_obj_get_x(items[2][1]));
+  TEST_ASSERT_EQUAL(110, lv_obj_get_x(items[2][2]));
+  TEST_ASSERT_EQUAL(20, lv_obj_get_y(items[1][2]));
+  TEST_ASSERT_EQUAL(50, lv_obj_get_y(items[2][2]));
+  TEST_ASSERT_EQUAL(70, lv_obj_get_y(items[3][0]));
+
+  /*The other items still define the size of the tracks*/
+  lv_obj_set_size(items[1][0], 10, 10);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(40, lv_obj_get_x(items[2][1]));
+  TEST_ASSERT_EQUAL(40, lv_obj_get_y(items[2][2]));
+
+  /*Hidden and deleted items don't count*/
+  lv_obj_set_height(items[2][1], 50);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(90, lv_obj_get_y(items[3][2]));
+
+  lv_obj_add_flag(items[2][1], LV_OBJ_FLAG_HIDDEN);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[3][2]));
+
+  lv_obj_clear_flag(items[2][1], LV_OBJ_FLAG_HIDDEN);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(90, lv_obj_get_y(items[3][2]));
+
+  lv_obj_del(items[2][1]);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[3][2]));
+
+  /*An item moved to an other cell*/
+  lv_obj_set_grid_cell(items[0][0], LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_START, 3, 1);
+  lv_obj_set_size(items[0][0], 70, 40);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(70, lv_obj_get_x(items[0][1]));
+  TEST_ASSERT_EQUAL(0, lv_obj_get_y(items[0][1]));
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[0][0]));
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[3][2]));
+
+  lv_obj_del(cont);
+}
+
+void test_grid_track_move(void)
+{
+  lv_obj_t * cont = grid_create();
+
+  /*The FR track follows the size of the container*/
+  lv_obj_set_grid_cell(items[0][2], LV_GRID_ALIGN_END, 2, 1, LV_GRID_ALIGN_START, 0, 1);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(260, lv_obj_get_x(items[0][2]));
+
+  lv_obj_set_width(cont, 200);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(160, lv_obj_get_x(items[0][2]));
+  TEST_ASSERT_EQUAL(90, lv_obj_get_x(items[1][2]));
+
+  /*Gaps move the tracks*/
+  lv_obj_set_style_pad_column(cont, 5, 0);
+  lv_obj_set_style_pad_row(cont, 10, 0);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(45, lv_obj_get_x(items[1][1]));
+  TEST_ASSERT_EQUAL(100, lv_obj_get_x(items[1][2]));
+  TEST_ASSERT_EQUAL(90, lv_obj_get_y(items[3][1]));
+
+  /*Translated items are placed again*/
+  lv_obj_set_style_translate_x(items[3][1], 7, 0);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(52, lv_obj_get_x(items[3][1]));
+
+  /*Stretched items follow the size of the track*/
+  lv_obj_set_grid_cell(items[2][2], LV_GRID_ALIGN_STRETCH, 2, 1, LV_GRID_ALIGN_STRETCH, 2, 1);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(100, lv_obj_get_width(items[2][2]));
+  TEST_ASSERT_EQUAL(20, lv_obj_get_height(items[2][2]));
+
+  lv_obj_set_height(items[2][0], 35);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(35, lv_obj_get_height(items[2][2]));
+  TEST_ASSERT_EQUAL(105, lv_obj_get_y(items[3][1]));
+
+  lv_obj_del(cont);
+}
+
+void test_grid_template_change(void)
+{
+  lv_obj_t * cont = grid_create();
+
+  static lv_coord_t col_dsc_2[] = {30, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+  lv_obj_set_grid_dsc_array(cont, col_dsc_2, row_dsc);
+  lv_obj_set_width(items[0][1], 45);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(30, lv_obj_get_x(items[1][1]));
+  TEST_ASSERT_EQUAL(0, lv_obj_get_x(items[1][0]));
+
+  /*The content of a track which was not CONTENT is measured again*/
+  lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+  lv_obj_update_layout(cont);
+  TEST_ASSERT_EQUAL(40, lv_obj_get_x(items[1][1]));
+  TEST_ASSERT_EQUAL(90, lv_obj_get_x(items[1][2]));
+
+  lv_obj_del(cont);
+}
+
+#endif
@@ -0,0 +1,146 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_img_transform_zoom(void);
+void test_img_transform_rotate(void);
+void test_img_transform_alpha(void);
+void test_img_transform_indexed(void);
+
+#if LV_DRAW_COMPLEX
+
+static void transform_init(lv_img_transform_dsc_t * dsc, const void * src, lv_coord_t w, lv_coord_t h,
+                           lv_img_cf_t cf, int16_t angle, uint16_t zoom)
+{
+  lv_memset_00(dsc, sizeof(lv_img_transform_dsc_t));
+  dsc->cfg.src = src;
+  dsc->cfg.src_w = w;
+  dsc->cfg.src_h = h;
+  dsc->cfg.cf = cf;
+  dsc->cfg.angle = angle;
+  dsc->cfg.zoom = zoom;
+  dsc->cfg.color = lv_color_hex(0x123456);
+  dsc->cfg.antialias = false;
+  _lv_img_buf_transform_init(dsc);
+}
+
+void test_img_transform_zoom(void)
+{
+  lv_color_t src[4 * 2];
+  uint32_t i;
+  for(i = 0; i < 8; i++) src[i] = lv_color_hex(0x101010 * (i + 1));
+
+  lv_img_transform_dsc_t dsc;
+  transform_init(&dsc, src, 4, 2, LV_IMG_CF_TRUE_COLOR, 0, 512);
+
+  lv_color_t cbuf[12];
+  lv_opa_t abuf[12];
+
+  /*Every source pixel should be repeated twice and the pixels on the right should be transparent*/
+  TEST_ASSERT_TRUE(_lv_img_buf_transform_line(&dsc, 0, 2, 12, cbuf, abuf));
+  for(i = 0; i < 8; i++) {
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, abuf[i]);
+    TEST_ASSERT_EQUAL_COLOR(src[4 + i / 2], cbuf[i]);
+  }
+  for(i = 8; i < 12; i++) TEST_ASSERT_EQUAL(LV_OPA_TRANSP, abuf[i]);
+
+  /*Line below the image*/
+  TEST_ASSERT_FALSE(_lv_img_buf_transform_line(&dsc, 0, 4, 12, cbuf, abuf));
+  for(i = 0; i < 12; i++) TEST_ASSERT_EQUAL(LV_OPA_TRANSP, abuf[i]);
+
+  /*Line starting far on the left*/
+  TEST_ASSERT_TRUE(_lv_img_buf_transform_line(&dsc, -10, 0, 12, cbuf, abuf));
+  for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL(LV_OPA_TRANSP, abuf[i]);
+  TEST_ASSERT_EQUAL_COLOR(src[0], cbuf[10]);
+  TEST_ASSERT_EQUAL_COLOR(src[0], cbuf[11]);
+}
+
+void test_img_transform_rotate(void)
+{
+  lv_color_t src[3 * 3];
+  uint32_t i;
+  for(i = 0; i < 9; i++) src[i] = lv_color_hex(0x101010 * (i + 1));
+
+  lv_img_transform_dsc_t dsc;
+  transform_init(&dsc, src, 3, 3, LV_IMG_CF_TRUE_COLOR, 900, LV_IMG_ZOOM_NONE);
+
+  lv_color_t cbuf[3];
+  lv_opa_t abuf[3];
+
+  /*Rotating by 90 degrees around (0;0) maps (x;y) to the source's (y;-x)*/
+  TEST_ASSERT_TRUE(_lv_img_buf_transform_line(&dsc, -2, 1, 3, cbuf, abuf));
+  for(i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, abuf[i]);
+    TEST_ASSERT_EQUAL_COLOR(src[(2 - i) * 3 + 1], cbuf[i]);
+  }
+}
+
+void test_img_transform_alpha(void)
+{
+  uint8_t src[4] = {0x00, 0x40, 0x80, 0xFF};
+
+  lv_img_transform_dsc_t dsc;
+  transform_init(&dsc, src, 4, 1, LV_IMG_CF_ALPHA_8BIT, 0, LV_IMG_ZOOM_NONE);
+
+  lv_color_t cbuf[4];
+  lv_opa_t abuf[4];
+
+  TEST_ASSERT_TRUE(_lv_img_buf_transform_line(&dsc, 0, 0, 4, cbuf, abuf));
+  uint32_t i;
+  for(i = 0; i < 4; i++) {
+    TEST_ASSERT_EQUAL(src[i], abuf[i]);
+    TEST_ASSERT_EQUAL_COLOR(dsc.cfg.color, cbuf[i]);
+  }
+}
+
+void test_img_transform_indexed(void)
+{
+  /*2 bit indexed image: palette of 4 colors followed by 1 byte per row*/
+  lv_color32_t src[4 + 1];
+  src[0].full = 0x00000000;
+  src[1].full = 0xFFFF0000;
+  src[2].full = 0xFF00FF00;
+  src[3].full = 0x800000FF;
+  uint8_t * indices = (uint8_t *)&src[4];
+  indices[0] = 0x1B;  /*Indices: 0, 1, 2, 3*/
+  indices[1] = 0xE4;  /*Indices: 3, 2, 1, 0*/
+
+  lv_img_transform_dsc_t dsc;
+  transform_init(&dsc, src, 4, 2, LV_IMG_CF_INDEXED_2BIT, 0, LV_IMG_ZOOM_NONE);
+
+  lv_color_t cbuf[4];
+  lv_opa_t abuf[4];
+
+  TEST_ASSERT_TRUE(_lv_img_buf_transform_line(&dsc, 0, 1, 4, cbuf, abuf));
+  TEST_ASSERT_EQUAL(0x80, abuf[0]);
+  TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000FF), cbuf[0]);
+  TEST_ASSERT_EQUAL(LV_OPA_COVER, abuf[1]);
+  TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00FF00), cbuf[1]);
+  TEST_ASSERT_EQUAL(LV_OPA_COVER, abuf[2]);
+  TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xFF0000), cbuf[2]);
+  TEST_ASSERT_EQUAL(LV_OPA_TRANSP, abuf[3]);
+}
+
+#else
+
+/*Image transformation is available only with LV_DRAW_COMPLEX*/
+void test_img_transform_zoom(void)
+{
+}
+
+void test_img_transform_rotate(void)
+{
+}
+
+void test_img_transform_alpha(void)
+{
+}
+
+void test_img_transform_indexed(void)
+{
+}
+
+#endif /*LV_DRAW_COMPLEX*/
+
+#endif
@@ -0,0 +1,290 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+void test_indev_buffered_samples(void);
+void test_indev_sample_time(void);
+void test_indev_pinch_rotate(void);
+void test_indev_filter_predict(void);
+
+typedef struct {
+  lv_indev_state_t state;
+  uint32_t timestamp;
+  lv_point_t point;
+} sample_t;
+
+static sample_t samples[32];
+static uint32_t sample_cnt;
+static uint32_t sample_act;
+
+static uint32_t pressing_cnt;
+static uint32_t long_pressed_cnt;
+static uint32_t short_clicked_cnt;
+static uint32_t clicked_cnt;
+static uint32_t pinch_cnt;
+static uint32_t rotate_cnt;
+static uint16_t pinch_scale;
+static int16_t rotation;
+
+typedef struct {
+  uint8_t touch_cnt;
+  lv_indev_touch_t touches[2];
+} multi_sample_t;
+
+static multi_sample_t multi_samples[8];
+static uint32_t multi_cnt;
+static uint32_t multi_act;
+
+/*Report the queued samples in one read like a buffering driver*/
+static void buffered_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+  LV_UNUSED(drv);
+  if(sample_act < sample_cnt) {
+    data->point = samples[sample_act].point;
+    data->state = samples[sample_act].state;
+    data->timestamp = samples[sample_act].timestamp;
+    sample_act++;
+    data->continue_reading = sample_act < sample_cnt;
+  }
+  else {
+    data->state = LV_INDEV_STATE_RELEASED;
+  }
+}
+
+static void event_cb(lv_event_t * e)
+{
+  lv_event_code_t code = lv_event_get_code(e);
+  if(code == LV_EVENT_PRESSING) pressing_cnt++;
+  else if(code == LV_EVENT_LONG_PRESSED) long_pressed_cnt++;
+  else if(code == LV_EVENT_SHORT_CLICKED) short_clicked_cnt++;
+  else if(code == LV_EVENT_CLICKED) clicked_cnt++;
+  else if(code == LV_EVENT_PINCH) {
+    pinch_cnt++;
+    pinch_scale = lv_indev_get_pinch_scale(lv_event_get_indev(e));
+  }
+  else if(code == LV_EVENT_ROTATE) {
+    rotate_cnt++;
+    rotation = lv_indev_get_rotation(lv_event_get_indev(e));
+  }
+}
+
+static void add_point_sample(lv_indev_state_t state, uint32_t timestamp, lv_coord_t x, lv_coord_t y)
+{
+  samples[sample_cnt].state = state;
+  samples[sample_cnt].timestamp = timestamp;
+  samples[sample_cnt].point.x = x;
+  samples[sample_cnt].point.y = y;
+  sample_cnt++;
+}
+
+static void add_sample(lv_indev_state_t state, uint32_t timestamp)
+{
+  add_point_sample(state, timestamp, 50, 50);
+}
+
+/*Report the queued touches in one read like a buffering driver*/
+static void multi_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+  LV_UNUSED(drv);
+  if(multi_act < multi_cnt) {
+    data->touch_cnt = multi_samples[multi_act].touch_cnt;
+    lv_memcpy(data->touches, multi_samples[multi_act].touches, sizeof(multi_samples[0].touches));
+    multi_act++;
+    data->continue_reading = multi_act < multi_cnt;
+  }
+}
+
+static void add_multi_sample(uint8_t touch_cnt, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+  multi_sample_t * m = &multi_samples[multi_cnt];
+  m->touch_cnt = touch_cnt;
+  m->touches[0].id = 1;
+  m->touches[0].point.x = x1;
+  m->touches[0].point.y = y1;
+  m->touches[1].id = 2;
+  m->touches[1].point.x = x2;
+  m->touches[1].point.y = y2;
+  multi_cnt++;
+}
+
+/*Input devices can't be deleted so register it only once*/
+static lv_indev_t * indev_create(void)
+{
+  static lv_indev_drv_t drv;
+  static lv_indev_t * indev;
+  if(drv.read_cb) return indev;
+  lv_indev_drv_init(&drv);
+  drv.type = LV_INDEV_TYPE_POINTER;
+  drv.read_cb = buffered_read_cb;
+  indev = lv_indev_drv_register(&drv);
+  return indev;
+}
+
+static lv_obj_t * obj_create(void)
+{
+  pressing_cnt = 0;
+  long_pressed_cnt = 0;
+  short_clicked_cnt = 0;
+  clicked_cnt = 0;
+  pinch_cnt = 0;
+  rotate_cnt = 0;
+  sample_cnt = 0;
+  sample_act = 0;
+
+  lv_obj_t * obj = lv_obj_create(lv_scr_act());
+  lv_obj_set_size(obj, 100, 100);
+  lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, NULL);
+  return obj;
+}
+
+void test_indev_buffered_samples(void)
+{
+  lv_obj_t * obj = obj_create();
+  indev_create();
+
+  /*All the samples are processed in one read*/
+  add_sample(LV_INDEV_STATE_PRESSED, 0);
+  add_sample(LV_INDEV_STATE_PRESSED, 0);
+  add_sample(LV_INDEV_STATE_PRESSED, 0);
+  add_sample(LV_INDEV_STATE_RELEASED, 0);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  TEST_ASSERT_EQUAL(sample_cnt, sample_act);
+  TEST_ASSERT_EQUAL(3, pressing_cnt);
+  TEST_ASSERT_EQUAL(1, short_clicked_cnt);
+  /*Without time stamps all the samples are at the time of reading*/
+  TEST_ASSERT_EQUAL(0, long_pressed_cnt);
+
+  lv_obj_del(obj);
+}
+
+void test_indev_sample_time(void)
+{
+  lv_obj_t * obj = obj_create();
+  indev_create();
+
+  /*The samples of a long press arrive at once but the press is recognized from their time stamps*/
+  uint32_t t0 = lv_tick_get();
+  lv_tick_inc(600);
+  add_sample(LV_INDEV_STATE_PRESSED, t0);
+  add_sample(LV_INDEV_STATE_PRESSED, t0 + LV_INDEV_DEF_LONG_PRESS_TIME + 100);
+  add_sample(LV_INDEV_STATE_RELEASED, t0 + LV_INDEV_DEF_LONG_PRESS_TIME + 110);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  TEST_ASSERT_EQUAL(sample_cnt, sample_act);
+  TEST_ASSERT_EQUAL(1, long_pressed_cnt);
+  TEST_ASSERT_EQUAL(0, short_clicked_cnt);
+
+  lv_obj_del(obj);
+}
+
+void test_indev_pinch_rotate(void)
+{
+  lv_obj_t * obj = obj_create();
+  lv_obj_set_size(obj, 400, 400);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE);
+  multi_cnt = 0;
+  multi_act = 0;
+
+  static lv_indev_drv_t drv;
+  lv_indev_drv_init(&drv);
+  drv.type = LV_INDEV_TYPE_MULTI_POINTER;
+  drv.read_cb = multi_read_cb;
+  lv_indev_t * indev = lv_indev_drv_register(&drv);
+
+  /*The first finger presses, the second one joins 100 px right to it, then moves 50 px farther*/
+  add_multi_sample(1, 50, 100, 0, 0);
+  add_multi_sample(2, 50, 100, 150, 100);
+  add_multi_sample(2, 50, 100, 200, 100);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  TEST_ASSERT_EQUAL(multi_cnt, multi_act);
+  TEST_ASSERT_EQUAL(1, pinch_cnt);
+  TEST_ASSERT_EQUAL(384, pinch_scale);
+  TEST_ASSERT_EQUAL(0, rotate_cnt);
+
+  lv_point_t p;
+  lv_indev_get_point(indev, &p);
+  TEST_ASSERT_EQUAL(50, p.x);
+  lv_indev_get_pinch_center(indev, &p);
+  TEST_ASSERT_EQUAL(125, p.x);
+  TEST_ASSERT_EQUAL(100, p.y);
+
+  /*Rotate the second finger below the first one at the same distance*/
+  multi_cnt = 0;
+  multi_act = 0;
+  add_multi_sample(2, 50, 100, 50, 250);
+  add_multi_sample(0, 0, 0, 0, 0);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  TEST_ASSERT_EQUAL(1, pinch_cnt);
+  TEST_ASSERT_EQUAL(1, rotate_cnt);
+  TEST_ASSERT_EQUAL(900, rotation);
+
+  /*Not clicked after pinching*/
+  TEST_ASSERT_GREATER_THAN(0, pressing_cnt);
+  TEST_ASSERT_EQUAL(0, clicked_cnt);
+
+  /*A single touch works as a pointer*/
+  multi_cnt = 0;
+  multi_act = 0;
+  add_multi_sample(1, 60, 60, 0, 0);
+  add_multi_sample(0, 0, 0, 0, 0);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+  TEST_ASSERT_EQUAL(1, clicked_cnt);
+
+  lv_indev_enable(indev, false);
+  lv_obj_del(obj);
+}
+
+void test_indev_filter_predict(void)
+{
+  lv_obj_t * obj = obj_create();
+  lv_obj_set_size(obj, 400, 400);
+  lv_indev_t * indev = indev_create();
+  lv_point_t p;
+
+  /*Moving with 1000 px/s: the point is extrapolated to the current time (at most by `predict_time`)*/
+  indev->driver->predict_time = 30;
+  uint32_t t = lv_tick_get() - 200;
+  uint32_t i;
+  for(i = 0; i <= 10; i++) {
+    add_point_sample(LV_INDEV_STATE_PRESSED, t + i * 10, 100 + i * 10, 100);
+  }
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  lv_indev_get_point(indev, &p);
+  TEST_ASSERT_INT_WITHIN(8, 200 + 30, p.x);
+  TEST_ASSERT_EQUAL(100, p.y);
+
+  sample_cnt = 0;
+  sample_act = 0;
+  add_point_sample(LV_INDEV_STATE_RELEASED, lv_tick_get(), 200, 100);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  /*The jitter of a not moving finger is smoothed*/
+  indev->driver->predict_time = 0;
+  indev->driver->filter_min_cutoff = 10;
+  sample_cnt = 0;
+  sample_act = 0;
+  t = lv_tick_get() - 200;
+  for(i = 0; i < 20; i++) {
+    add_point_sample(LV_INDEV_STATE_PRESSED, t + i * 10, (i & 1) ? 104 : 100, 100);
+  }
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  lv_indev_get_point(indev, &p);
+  TEST_ASSERT_INT_WITHIN(1, 102, p.x);
+
+  sample_cnt = 0;
+  sample_act = 0;
+  add_point_sample(LV_INDEV_STATE_RELEASED, lv_tick_get(), 104, 100);
+  lv_test_indev_wait(LV_INDEV_DEF_READ_PERIOD + 1);
+
+  indev->driver->filter_min_cutoff = 0;
+  lv_obj_del(obj);
+}
+
+#endif
@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_inv_area_overflow(void);
+void test_inv_area_overlap(void);
+void test_inv_area_join_close(void);
+void test_inv_area_translate(void);
+
+static uint32_t refr_px_num;
+
+static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+  LV_UNUSED(drv);
+  LV_UNUSED(time);
+  refr_px_num = px;
+}
+
+static void inv_area(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+  lv_area_t a;
+  lv_area_set(&a, x1, y1, x2, y2);
+  lv_obj_invalidate_area(lv_scr_act(), &a);
+}
+
+/*Refresh the invalid areas and return the number of refreshed pixels*/
+static uint32_t refr(void)
+{
+  lv_disp_t * disp = lv_disp_get_default();
+  refr_px_num = 0;
+  disp->driver->monitor_cb = monitor_cb;
+  lv_refr_now(disp);
+  disp->driver->monitor_cb = NULL;
+  return refr_px_num;
+}
+
+void test_inv_area_overflow(void)
+{
+  lv_disp_t * disp = lv_disp_get_default();
+  refr();
+
+  /*More small areas than the size of the buffer*/
+  lv_area_t a[40];
+  uint32_t i;
+  for(i = 0; i < 40; i++) {
+    lv_area_set(&a[i], (i % 8) * 80 + 10, (i / 8) * 80 + 10, (i % 8) * 80 + 13, (i / 8) * 80 + 13);
+    lv_obj_invalidate_area(lv_scr_act(), &a[i]);
+  }
+
+  TEST_ASSERT_LESS_OR_EQUAL(LV_INV_BUF_SIZE, disp->inv_p);
+  for(i = 0; i < 40; i++) {
+    uint32_t j;
+    bool found = false;
+    for(j = 0; j < disp->inv_p; j++) {
+      if(_lv_area_is_in(&a[i], &disp->inv_areas[j], 0)) found = true;
+    }
+    TEST_ASSERT_TRUE(found);
+  }
+
+  /*Not the whole screen is refreshed*/
+  uint32_t scr_size = lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp);
+  TEST_ASSERT_LESS_THAN(scr_size / 10, refr());
+}
+
+void test_inv_area_overlap(void)
+{
+  refr();
+
+  /*The common part is refreshed only once*/
+  inv_area(0, 0, 99, 99);
+  inv_area(50, 50, 149, 149);
+  TEST_ASSERT_EQUAL(17500, refr());
+
+  /*An area in an other area is not refreshed again*/
+  inv_area(10, 10, 19, 19);
+  inv_area(0, 0, 99, 99);
+  TEST_ASSERT_EQUAL(10000, refr());
+}
+
+void test_inv_area_join_close(void)
+{
+  refr();
+
+  /*Refreshing a few more pixels is cheaper than refreshing two areas*/
+  inv_area(0, 0, 9, 9);
+  inv_area(15, 0, 24, 9);
+  TEST_ASSERT_EQUAL(250, refr());
+
+  /*Far areas are refreshed separately*/
+  inv_area(0, 0, 9, 9);
+  inv_area(200, 200, 209, 209);
+  TEST_ASSERT_EQUAL(200, refr());
+}
+
+void test_inv_area_translate(void)
+{
+  lv_disp_t * disp = lv_disp_get_default();
+  lv_obj_t * obj = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_pos(obj, 10, 10);
+  lv_obj_set_size(obj, 50, 50);
+  refr();
+
+  /*The old position is invalidated right away, without waiting for the layout update*/
+  lv_area_t old_coords;
+  lv_obj_get_coords(obj, &old_coords);
+  lv_obj_set_style_translate_x(obj, 100, 0);
+
+  bool found = false;
+  uint32_t i;
+  for(i = 0; i < disp->inv_p; i++) {
+    if(_lv_area_is_in(&old_coords, &disp->inv_areas[i], 0)) found = true;
+  }
+  TEST_ASSERT_TRUE(found);
+
+  /*Both positions are refreshed*/
+  TEST_ASSERT_EQUAL(5000, refr());
+
+  lv_obj_del(obj);
+}
+
+#endif
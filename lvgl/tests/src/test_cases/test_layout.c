@@ -0,0 +1,62 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_layout_update_invalid_branch(void);
+
+#define CONT_CNT    20
+#define ITEM_CNT    10
+
+static lv_obj_t * column_create(lv_obj_t * parent)
+{
+  lv_obj_t * obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_size(obj, 200, LV_SIZE_CONTENT);
+  lv_obj_set_layout(obj, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
+  return obj;
+}
+
+void test_layout_update_invalid_branch(void)
+{
+  lv_obj_t * root = column_create(lv_scr_act());
+  lv_obj_t * conts[CONT_CNT];
+  lv_obj_t * items[CONT_CNT][ITEM_CNT];
+  uint32_t i;
+  uint32_t j;
+  for(i = 0; i < CONT_CNT; i++) {
+    conts[i] = column_create(root);
+    for(j = 0; j < ITEM_CNT; j++) {
+      items[i][j] = lv_obj_create(conts[i]);
+      lv_obj_remove_style_all(items[i][j]);
+      lv_obj_set_size(items[i][j], 100, 10);
+    }
+  }
+
+  lv_obj_update_layout(root);
+  TEST_ASSERT_EQUAL(40, lv_obj_get_y(items[5][4]));
+  TEST_ASSERT_EQUAL(600, lv_obj_get_y(conts[6]));
+
+  /*Only the branch of the changed object is visited, not all the objects*/
+  uint32_t visit_cnt = lv_layout_get_visit_cnt();
+  lv_obj_set_height(items[5][3], 30);
+  lv_obj_update_layout(root);
+  TEST_ASSERT_LESS_THAN(CONT_CNT * ITEM_CNT / 4, lv_layout_get_visit_cnt() - visit_cnt);
+
+  /*The layouts of the parents are updated*/
+  TEST_ASSERT_EQUAL(60, lv_obj_get_y(items[5][4]));
+  TEST_ASSERT_EQUAL(120, lv_obj_get_height(conts[5]));
+  TEST_ASSERT_EQUAL(620, lv_obj_get_y(conts[6]));
+
+  /*The moved objects are updated too*/
+  lv_obj_set_parent(items[5][3], conts[7]);
+  lv_obj_update_layout(root);
+  TEST_ASSERT_EQUAL(90, lv_obj_get_height(conts[5]));
+  TEST_ASSERT_EQUAL(130, lv_obj_get_height(conts[7]));
+  TEST_ASSERT_EQUAL(100, lv_obj_get_y(items[5][3]));
+
+  lv_obj_del(root);
+}
+
+#endif
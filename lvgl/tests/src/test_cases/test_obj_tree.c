@@ -5,6 +5,8 @@
 
 void test_obj_tree_1(void);
 void test_obj_tree_2(void);
+void test_obj_tree_child_index_hit_test(void);
+void test_obj_tree_child_index_draw(void);
 
 void test_obj_tree_1(void)
 {
@@ -36,4 +38,98 @@ void test_obj_tree_2(void)
  //TEST_ASSERT_EQUAL_SCREENSHOT("scr1.png")
 }
 
+#define CHILD_CNT   100
+#define CHILD_H     20
+
+static lv_obj_t * children[CHILD_CNT];
+static uint32_t draw_cnt[CHILD_CNT];
+
+static void draw_event_cb(lv_event_t * e)
+{
+  draw_cnt[(uintptr_t)lv_event_get_user_data(e)]++;
+}
+
+/*A scrollable column of many children which are indexed by their parent*/
+static lv_obj_t * column_create(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(parent);
+  lv_obj_set_size(parent, 200, 200);
+
+  uintptr_t i;
+  for(i = 0; i < CHILD_CNT; i++) {
+    children[i] = lv_obj_create(parent);
+    lv_obj_remove_style_all(children[i]);
+    lv_obj_set_size(children[i], 200, CHILD_H);
+    lv_obj_set_pos(children[i], 0, i * CHILD_H);
+    lv_obj_add_event_cb(children[i], draw_event_cb, LV_EVENT_DRAW_MAIN, (void *)i);
+  }
+
+  lv_obj_update_layout(parent);
+  lv_memset_00(draw_cnt, sizeof(draw_cnt));
+  return parent;
+}
+
+void test_obj_tree_child_index_hit_test(void)
+{
+  lv_obj_t * parent = column_create();
+  lv_point_t p = {10, 45};
+  TEST_ASSERT_EQUAL_PTR(children[2], lv_indev_search_obj(parent, &p));
+
+  lv_obj_scroll_to_y(parent, 100, LV_ANIM_OFF);
+  TEST_ASSERT_EQUAL_PTR(children[7], lv_indev_search_obj(parent, &p));
+
+  /*Children out of order*/
+  lv_obj_set_y(children[90], 7 * CHILD_H);
+  lv_obj_update_layout(parent);
+  TEST_ASSERT_EQUAL_PTR(children[90], lv_indev_search_obj(parent, &p));
+
+  /*Floating children are not scrolled*/
+  lv_obj_t * floating = lv_obj_create(parent);
+  lv_obj_remove_style_all(floating);
+  lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+  lv_obj_set_size(floating, 50, 50);
+  lv_obj_update_layout(parent);
+  p.y = 10;
+  TEST_ASSERT_EQUAL_PTR(floating, lv_indev_search_obj(parent, &p));
+
+  lv_obj_move_background(floating);
+  TEST_ASSERT_EQUAL_PTR(children[5], lv_indev_search_obj(parent, &p));
+
+  /*Extended click area*/
+  lv_obj_del(floating);
+  lv_obj_set_x(children[5], 100);
+  lv_obj_set_ext_click_area(children[5], 95);
+  lv_obj_update_layout(parent);
+  TEST_ASSERT_EQUAL_PTR(children[5], lv_indev_search_obj(parent, &p));
+
+  lv_obj_del(parent);
+}
+
+void test_obj_tree_child_index_draw(void)
+{
+  lv_obj_t * parent = column_create();
+  lv_obj_scroll_to_y(parent, 5 * CHILD_H, LV_ANIM_OFF);
+  lv_refr_now(NULL);
+  lv_memset_00(draw_cnt, sizeof(draw_cnt));
+
+  /*Only the invalidated child is redrawn*/
+  lv_obj_invalidate(children[8]);
+  lv_refr_now(NULL);
+  uint32_t i;
+  for(i = 0; i < CHILD_CNT; i++) {
+    TEST_ASSERT_EQUAL(i == 8 ? 1 : 0, draw_cnt[i]);
+  }
+
+  /*Only the visible children are drawn*/
+  lv_memset_00(draw_cnt, sizeof(draw_cnt));
+  lv_obj_invalidate(parent);
+  lv_refr_now(NULL);
+  for(i = 0; i < CHILD_CNT; i++) {
+    TEST_ASSERT_EQUAL(i >= 5 && i < 15 ? 1 : 0, draw_cnt[i]);
+  }
+
+  lv_obj_del(parent);
+}
+
 #endif
@@ -0,0 +1,166 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_scroll_copy(void);
+void test_scroll_copy_fallback(void);
+
+#define FB_W    800
+#define FB_H    480
+
+static lv_color_t fb[FB_W * FB_H];
+static lv_color_t fb_ref[FB_W * FB_H];
+static uint32_t copy_cnt;
+static uint32_t refr_px_num;
+
+static void fb_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+  lv_coord_t w = lv_area_get_width(area);
+  lv_coord_t y;
+  for(y = area->y1; y <= area->y2; y++) {
+    lv_memcpy(&fb[y * FB_W + area->x1], color_p, w * sizeof(lv_color_t));
+    color_p += w;
+  }
+
+  lv_disp_flush_ready(drv);
+}
+
+static bool fb_copy_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+  LV_UNUSED(drv);
+  copy_cnt++;
+
+  /*The source pixels which remain in the area*/
+  lv_coord_t x1 = area->x1 + (dx < 0 ? -dx : 0);
+  lv_coord_t x2 = area->x2 - (dx > 0 ? dx : 0);
+  lv_coord_t y1 = area->y1 + (dy < 0 ? -dy : 0);
+  lv_coord_t y2 = area->y2 - (dy > 0 ? dy : 0);
+  uint32_t w = x2 - x1 + 1;
+
+  lv_coord_t y;
+  if(dy > 0) {
+    for(y = y2; y >= y1; y--) memmove(&fb[(y + dy) * FB_W + x1 + dx], &fb[y * FB_W + x1], w * sizeof(lv_color_t));
+  }
+  else {
+    for(y = y1; y <= y2; y++) memmove(&fb[(y + dy) * FB_W + x1 + dx], &fb[y * FB_W + x1], w * sizeof(lv_color_t));
+  }
+
+  return true;
+}
+
+static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+  LV_UNUSED(drv);
+  LV_UNUSED(time);
+  refr_px_num = px;
+}
+
+static void refr(void)
+{
+  refr_px_num = 0;
+  lv_refr_now(NULL);
+}
+
+static lv_obj_t * cont_create(void)
+{
+  lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+  drv->flush_cb = fb_flush_cb;
+  drv->copy_cb = fb_copy_cb;
+  drv->monitor_cb = monitor_cb;
+
+  lv_obj_t * cont = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(cont);
+  lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+  lv_obj_set_style_bg_color(cont, lv_color_white(), 0);
+  lv_obj_set_pos(cont, 50, 50);
+  lv_obj_set_size(cont, 300, 300);
+
+  uint32_t i;
+  for(i = 0; i < 20; i++) {
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_make(i * 12, 255 - i * 12, (i % 2) * 255), 0);
+    lv_obj_set_pos(obj, (i % 3) * 20, i * 50);
+    lv_obj_set_size(obj, 400, 40);
+  }
+
+  lv_obj_invalidate(lv_scr_act());
+  refr();
+  copy_cnt = 0;
+  return cont;
+}
+
+static void cont_del(lv_obj_t * cont)
+{
+  lv_obj_del(cont);
+  lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+  drv->copy_cb = NULL;
+  drv->monitor_cb = NULL;
+  lv_refr_now(NULL);
+}
+
+void test_scroll_copy(void)
+{
+  lv_obj_t * cont = cont_create();
+
+  lv_obj_scroll_by(cont, 0, -7, LV_ANIM_OFF);
+  refr();
+  TEST_ASSERT_EQUAL(1, copy_cnt);
+  TEST_ASSERT_EQUAL(300 * 7, refr_px_num);
+
+  /*The scrolls between two refreshes are moved together*/
+  lv_obj_set_style_bg_color(lv_obj_get_child(cont, 5), lv_color_black(), 0);
+  lv_obj_scroll_by(cont, 0, -13, LV_ANIM_OFF);
+  lv_obj_scroll_by(cont, -11, 20, LV_ANIM_OFF);
+  lv_obj_scroll_by(cont, -5, -30, LV_ANIM_OFF);
+  refr();
+  TEST_ASSERT_EQUAL(2, copy_cnt);
+  TEST_ASSERT_LESS_THAN(300 * 300 / 2, refr_px_num);
+
+  /*Redraw the whole screen and compare it with the result of copying*/
+  lv_memcpy(fb_ref, fb, sizeof(fb));
+  lv_obj_invalidate(lv_scr_act());
+  refr();
+  TEST_ASSERT_EQUAL(0, memcmp(fb, fb_ref, sizeof(fb)));
+
+  cont_del(cont);
+}
+
+void test_scroll_copy_fallback(void)
+{
+  lv_obj_t * cont = cont_create();
+  lv_disp_t * disp = lv_disp_get_default();
+
+  /*Another object is drawn on the content*/
+  lv_obj_t * obj = lv_obj_create(lv_scr_act());
+  lv_obj_set_pos(obj, 300, 300);
+  lv_obj_set_size(obj, 100, 100);
+  refr();
+
+  lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+  TEST_ASSERT_FALSE(disp->copy_pending);
+  refr();
+  TEST_ASSERT_EQUAL(0, copy_cnt);
+  lv_obj_del(obj);
+  refr();
+
+  /*The background is transparent*/
+  lv_obj_set_style_bg_opa(cont, LV_OPA_50, 0);
+  refr();
+  lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+  TEST_ASSERT_FALSE(disp->copy_pending);
+
+  /*Both conditions are fine*/
+  lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+  refr();
+  lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+  TEST_ASSERT_TRUE(disp->copy_pending);
+  refr();
+  TEST_ASSERT_EQUAL(1, copy_cnt);
+
+  cont_del(cont);
+}
+
+#endif
@@ -0,0 +1,171 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_snapshot_layer_opa(void);
+void test_snapshot_layer_cache(void);
+void test_snapshot_layer_remove(void);
+void test_snapshot_layer_transform(void);
+
+#if LV_USE_SNAPSHOT
+
+static uint32_t draw_cnt;
+
+static void draw_event_cb(lv_event_t * e)
+{
+  LV_UNUSED(e);
+  draw_cnt++;
+}
+
+static lv_obj_t * rect_create(lv_obj_t * parent, lv_coord_t size, lv_color_t color)
+{
+  lv_obj_t * obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_size(obj, size, size);
+  lv_obj_set_style_bg_color(obj, color, 0);
+  lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+  return obj;
+}
+
+/*A white layer with a black rectangle in its top left corner*/
+static lv_obj_t * layer_create(lv_obj_t * parent, lv_obj_t ** inner)
+{
+  lv_obj_t * layer = rect_create(parent, 40, lv_color_white());
+  *inner = rect_create(layer, 20, lv_color_black());
+  lv_obj_add_event_cb(*inner, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+  TEST_ASSERT_EQUAL(LV_RES_OK, lv_snapshot_layer_add(layer));
+  lv_snapshot_layer_set_opa(layer, LV_OPA_50);
+  return layer;
+}
+
+static void assert_px(const lv_img_dsc_t * snapshot, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa)
+{
+  TEST_ASSERT_EQUAL_COLOR(color, lv_img_buf_get_px_color((lv_img_dsc_t *)snapshot, x, y, lv_color_black()));
+  TEST_ASSERT_INT_WITHIN(2, opa, lv_img_buf_get_px_alpha((lv_img_dsc_t *)snapshot, x, y));
+}
+
+void test_snapshot_layer_opa(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(parent);
+  lv_obj_set_size(parent, 40, 40);
+
+  lv_obj_t * inner;
+  layer_create(parent, &inner);
+
+  /*The layer is blended as one image so the white background is not visible under the black rectangle*/
+  lv_img_dsc_t * snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  TEST_ASSERT_NOT_NULL(snapshot);
+  assert_px(snapshot, 5, 5, lv_color_black(), LV_OPA_50);
+  assert_px(snapshot, 30, 30, lv_color_white(), LV_OPA_50);
+  lv_snapshot_free(snapshot);
+
+  lv_obj_del(parent);
+}
+
+void test_snapshot_layer_cache(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(parent);
+  lv_obj_set_size(parent, 60, 60);
+
+  lv_obj_t * inner;
+  lv_obj_t * layer = layer_create(parent, &inner);
+  draw_cnt = 0;
+
+  lv_img_dsc_t * snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  lv_snapshot_free(snapshot);
+  TEST_ASSERT_EQUAL(1, draw_cnt);
+
+  /*Moving the layer uses the cache*/
+  lv_obj_set_pos(layer, 10, 10);
+  snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  TEST_ASSERT_EQUAL(1, draw_cnt);
+  assert_px(snapshot, 5, 5, lv_color_black(), LV_OPA_TRANSP);
+  assert_px(snapshot, 15, 15, lv_color_black(), LV_OPA_50);
+  lv_snapshot_free(snapshot);
+
+  /*Changing a child redraws the cache*/
+  lv_obj_set_style_bg_color(inner, lv_color_white(), 0);
+  snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  TEST_ASSERT_EQUAL(2, draw_cnt);
+  assert_px(snapshot, 15, 15, lv_color_white(), LV_OPA_50);
+  lv_snapshot_free(snapshot);
+
+  lv_obj_del(parent);
+}
+
+void test_snapshot_layer_remove(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(parent);
+  lv_obj_set_size(parent, 40, 40);
+
+  lv_obj_t * inner;
+  lv_obj_t * layer = layer_create(parent, &inner);
+  lv_snapshot_layer_remove(layer);
+  TEST_ASSERT_FALSE(lv_obj_has_flag(layer, LV_OBJ_FLAG_LAYER));
+
+  /*The children are drawn directly again*/
+  lv_img_dsc_t * snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  assert_px(snapshot, 5, 5, lv_color_black(), LV_OPA_COVER);
+  lv_snapshot_free(snapshot);
+
+  lv_obj_del(parent);
+}
+
+void test_snapshot_layer_transform(void)
+{
+  lv_obj_t * parent = lv_obj_create(lv_scr_act());
+  lv_obj_remove_style_all(parent);
+  lv_obj_set_size(parent, 80, 80);
+
+  lv_obj_t * inner;
+  lv_obj_t * layer = layer_create(parent, &inner);
+  lv_obj_center(layer);
+  draw_cnt = 0;
+
+  /*The zoomed layer covers the parent*/
+  lv_snapshot_layer_set_zoom(layer, 512);
+  lv_img_dsc_t * snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  assert_px(snapshot, 2, 2, lv_color_black(), LV_OPA_50);
+  assert_px(snapshot, 37, 37, lv_color_black(), LV_OPA_50);
+  assert_px(snapshot, 77, 77, lv_color_white(), LV_OPA_50);
+  lv_snapshot_free(snapshot);
+
+  /*Rotating doesn't redraw the cache*/
+  lv_snapshot_layer_set_zoom(layer, LV_IMG_ZOOM_NONE);
+  lv_snapshot_layer_set_angle(layer, 1800);
+  snapshot = lv_snapshot_take(parent, LV_IMG_CF_TRUE_COLOR_ALPHA);
+  assert_px(snapshot, 55, 55, lv_color_black(), LV_OPA_50);
+  assert_px(snapshot, 25, 25, lv_color_white(), LV_OPA_50);
+  assert_px(snapshot, 5, 5, lv_color_black(), LV_OPA_TRANSP);
+  lv_snapshot_free(snapshot);
+  TEST_ASSERT_EQUAL(1, draw_cnt);
+
+  lv_obj_del(parent);
+}
+
+#else
+
+void test_snapshot_layer_opa(void)
+{
+}
+
+void test_snapshot_layer_cache(void)
+{
+}
+
+void test_snapshot_layer_remove(void)
+{
+}
+
+void test_snapshot_layer_transform(void)
+{
+}
+
+#endif /*LV_USE_SNAPSHOT*/
+
+#endif
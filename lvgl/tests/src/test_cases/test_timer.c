@@ -0,0 +1,151 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_timer_order(void);
+void test_timer_delete(void);
+void test_timer_pause(void);
+void test_timer_zero_period(void);
+
+static uint32_t run_order[8];
+static uint32_t run_cnt;
+
+static void record_timer_cb(lv_timer_t * timer)
+{
+  if(run_cnt < 8) run_order[run_cnt] = (uint32_t)(lv_uintptr_t)timer->user_data;
+  run_cnt++;
+}
+
+static void del_timer_cb(lv_timer_t * timer)
+{
+  record_timer_cb(timer);
+  lv_timer_del(timer);
+}
+
+static void del_other_timer_cb(lv_timer_t * timer)
+{
+  record_timer_cb(timer);
+  lv_timer_t * other = lv_timer_get_next(NULL);
+  while(other) {
+    if(other->user_data == (void *)2) {
+      lv_timer_del(other);
+      break;
+    }
+    other = lv_timer_get_next(other);
+  }
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+  lv_timer_t * t = lv_timer_get_next(NULL);
+  while(t) {
+    if(t == timer) return true;
+    t = lv_timer_get_next(t);
+  }
+  return false;
+}
+
+void test_timer_order(void)
+{
+  run_cnt = 0;
+  lv_timer_t * t1 = lv_timer_create(record_timer_cb, 30, (void *)1);
+  lv_timer_t * t2 = lv_timer_create(record_timer_cb, 10, (void *)2);
+  lv_timer_t * t3 = lv_timer_create(record_timer_cb, 20, (void *)3);
+
+  /*Only the ready timers run*/
+  lv_tick_inc(15);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(1, run_cnt);
+  TEST_ASSERT_EQUAL(2, run_order[0]);
+
+  /*The most overdue timer runs first*/
+  lv_tick_inc(20);
+  uint32_t time_till_next = lv_timer_handler();
+  TEST_ASSERT_EQUAL(4, run_cnt);
+  TEST_ASSERT_EQUAL(3, run_order[1]);
+  TEST_ASSERT_EQUAL(2, run_order[2]);
+  TEST_ASSERT_EQUAL(1, run_order[3]);
+  TEST_ASSERT_LESS_OR_EQUAL(10, time_till_next);
+
+  lv_timer_set_period(t1, 5);
+  TEST_ASSERT_LESS_OR_EQUAL(5, lv_timer_handler());
+
+  lv_timer_del(t1);
+  lv_timer_del(t2);
+  lv_timer_del(t3);
+}
+
+void test_timer_delete(void)
+{
+  run_cnt = 0;
+  lv_timer_t * t1 = lv_timer_create(del_other_timer_cb, 10, (void *)1);
+  lv_timer_t * t2 = lv_timer_create(record_timer_cb, 20, (void *)2);
+  lv_timer_t * t3 = lv_timer_create(del_timer_cb, 10, (void *)3);
+  lv_timer_t * t4 = lv_timer_create(record_timer_cb, 10, (void *)4);
+  lv_timer_set_repeat_count(t4, 2);
+
+  /*Timers deleted in the callbacks don't run*/
+  lv_tick_inc(30);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(3, run_cnt);
+  TEST_ASSERT_FALSE(timer_exists(t2));
+  TEST_ASSERT_FALSE(timer_exists(t3));
+
+  /*The timers are deleted when the repeat count is over*/
+  lv_tick_inc(10);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(5, run_cnt);
+  TEST_ASSERT_FALSE(timer_exists(t4));
+
+  lv_timer_set_repeat_count(t1, 0);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(5, run_cnt);
+  TEST_ASSERT_FALSE(timer_exists(t1));
+}
+
+void test_timer_pause(void)
+{
+  run_cnt = 0;
+  lv_timer_t * t1 = lv_timer_create(record_timer_cb, 10, (void *)1);
+
+  lv_timer_pause(t1);
+  lv_tick_inc(20);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(0, run_cnt);
+
+  lv_timer_resume(t1);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(1, run_cnt);
+
+  /*Reset and ready move the next run*/
+  lv_tick_inc(8);
+  lv_timer_reset(t1);
+  lv_tick_inc(8);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(1, run_cnt);
+
+  lv_timer_ready(t1);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(2, run_cnt);
+
+  lv_timer_del(t1);
+}
+
+void test_timer_zero_period(void)
+{
+  run_cnt = 0;
+  lv_timer_t * t1 = lv_timer_create(record_timer_cb, 0, (void *)1);
+  lv_timer_t * t2 = lv_timer_create(record_timer_cb, 0, (void *)2);
+
+  /*The timers run only once in a call even if they are ready again*/
+  TEST_ASSERT_EQUAL(0, lv_timer_handler());
+  TEST_ASSERT_EQUAL(2, run_cnt);
+  lv_timer_handler();
+  TEST_ASSERT_EQUAL(4, run_cnt);
+
+  lv_timer_del(t1);
+  lv_timer_del(t2);
+}
+
+#endif
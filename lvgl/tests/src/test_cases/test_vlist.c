@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void test_vlist_recycle(void);
+void test_vlist_scroll_far(void);
+void test_vlist_measure(void);
+void test_vlist_refresh(void);
+
+#define ROW_CNT     5000
+
+static uint32_t create_cnt;
+static uint32_t bind_cnt;
+static bool var_height;
+
+static lv_obj_t * row_create_cb(lv_obj_t * vlist)
+{
+  lv_obj_t * row = lv_obj_create(vlist);
+  lv_obj_remove_style_all(row);
+  lv_obj_set_size(row, LV_PCT(100), 40);
+  create_cnt++;
+  return row;
+}
+
+static void row_bind_cb(lv_obj_t * vlist, lv_obj_t * row, uint32_t id)
+{
+  LV_UNUSED(vlist);
+  if(var_height) lv_obj_set_height(row, 20 + (id % 3) * 10);
+  bind_cnt++;
+}
+
+static lv_obj_t * vlist_create(void)
+{
+  create_cnt = 0;
+  bind_cnt = 0;
+
+  lv_obj_t * vlist = lv_vlist_create(lv_scr_act());
+  lv_obj_remove_style_all(vlist);
+  lv_obj_set_size(vlist, 200, 300);
+  lv_vlist_set_row_height(vlist, 40);
+  lv_vlist_set_create_cb(vlist, row_create_cb);
+  lv_vlist_set_bind_cb(vlist, row_bind_cb);
+  lv_vlist_set_row_cnt(vlist, ROW_CNT);
+  lv_obj_update_layout(vlist);
+  return vlist;
+}
+
+/*The rows in the view follow each other without gaps*/
+static void assert_rows_continuous(lv_obj_t * vlist)
+{
+  uint32_t id;
+  lv_obj_t * prev = NULL;
+  uint32_t row_cnt = 0;
+  for(id = 0; id < ROW_CNT; id++) {
+    lv_obj_t * row = lv_vlist_get_row(vlist, id);
+    if(row == NULL) continue;
+    if(prev) TEST_ASSERT_EQUAL(prev->coords.y2 + 1, row->coords.y1);
+    prev = row;
+    row_cnt++;
+  }
+
+  TEST_ASSERT_GREATER_THAN(0, row_cnt);
+  TEST_ASSERT_GREATER_OR_EQUAL(vlist->coords.y2, prev->coords.y2);
+}
+
+void test_vlist_recycle(void)
+{
+  var_height = false;
+  lv_obj_t * vlist = vlist_create();
+
+  /*Only the visible rows are created*/
+  TEST_ASSERT_EQUAL(ROW_CNT * 40, lv_vlist_get_content_height(vlist));
+  TEST_ASSERT_LESS_OR_EQUAL(300 / 40 + 1, create_cnt);
+  TEST_ASSERT_EQUAL(create_cnt, lv_obj_get_child_cnt(vlist));
+  TEST_ASSERT_EQUAL(vlist->coords.y1, lv_vlist_get_row(vlist, 0)->coords.y1);
+  assert_rows_continuous(vlist);
+
+  /*The row objects are reused while scrolling*/
+  uint32_t create_cnt_start = create_cnt;
+  uint32_t i;
+  for(i = 0; i < 100; i++) {
+    lv_obj_scroll_by(vlist, 0, -13, LV_ANIM_OFF);
+  }
+
+  TEST_ASSERT_EQUAL(1300, lv_vlist_get_scroll_y(vlist));
+  TEST_ASSERT_LESS_OR_EQUAL(create_cnt_start + 1, create_cnt);
+  TEST_ASSERT_EQUAL(vlist->coords.y1 - 20, lv_vlist_get_row(vlist, 32)->coords.y1);
+  TEST_ASSERT_NULL(lv_vlist_get_row(vlist, 31));
+  TEST_ASSERT_EQUAL(32, lv_vlist_get_row_id(vlist, lv_vlist_get_row(vlist, 32)));
+  assert_rows_continuous(vlist);
+
+  lv_obj_del(vlist);
+}
+
+void test_vlist_scroll_far(void)
+{
+  var_height = false;
+  lv_obj_t * vlist = vlist_create();
+
+  /*The content is much taller than the range of lv_coord_t*/
+  lv_vlist_scroll_to_row(vlist, 4000, LV_ANIM_OFF);
+  TEST_ASSERT_EQUAL(4000 * 40, lv_vlist_get_scroll_y(vlist));
+  TEST_ASSERT_EQUAL(vlist->coords.y1, lv_vlist_get_row(vlist, 4000)->coords.y1);
+  TEST_ASSERT_LESS_THAN(1000, lv_obj_get_scroll_y(vlist));
+  assert_rows_continuous(vlist);
+
+  /*Scrolling can't go beyond the last row*/
+  lv_vlist_scroll_to_row(vlist, ROW_CNT - 1, LV_ANIM_OFF);
+  TEST_ASSERT_EQUAL(ROW_CNT * 40 - 300, lv_vlist_get_scroll_y(vlist));
+  TEST_ASSERT_EQUAL(vlist->coords.y2, lv_vlist_get_row(vlist, ROW_CNT - 1)->coords.y2);
+  TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_bottom(vlist));
+
+  lv_obj_scroll_by(vlist, 0, 100, LV_ANIM_OFF);
+  TEST_ASSERT_EQUAL(ROW_CNT * 40 - 400, lv_vlist_get_scroll_y(vlist));
+  assert_rows_continuous(vlist);
+
+  lv_obj_del(vlist);
+}
+
+void test_vlist_measure(void)
+{
+  var_height = true;
+  lv_obj_t * vlist = vlist_create();
+
+  /*The estimated height is used for the not visible rows*/
+  int32_t content_h = lv_vlist_get_content_height(vlist);
+  TEST_ASSERT_LESS_THAN(ROW_CNT * 40, content_h);
+  TEST_ASSERT_GREATER_THAN((ROW_CNT - 20) * 40, content_h);
+  assert_rows_continuous(vlist);
+
+  /*The visible rows don't move when the rows above them are measured*/
+  lv_vlist_scroll_to_row(vlist, 1000, LV_ANIM_OFF);
+  lv_obj_t * row = lv_vlist_get_row(vlist, 1000);
+  lv_coord_t y1 = row->coords.y1;
+  lv_obj_scroll_by(vlist, 0, 50, LV_ANIM_OFF);
+  TEST_ASSERT_EQUAL_PTR(row, lv_vlist_get_row(vlist, 1000));
+  TEST_ASSERT_EQUAL(y1 + 50, row->coords.y1);
+  TEST_ASSERT_EQUAL(20, lv_obj_get_height(lv_vlist_get_row(vlist, 999)));
+  TEST_ASSERT_EQUAL(30, lv_obj_get_height(row));
+  assert_rows_continuous(vlist);
+
+  lv_obj_del(vlist);
+}
+
+void test_vlist_refresh(void)
+{
+  var_height = false;
+  lv_obj_t * vlist = vlist_create();
+
+  /*Only the changed row is bound again*/
+  uint32_t bind_cnt_start = bind_cnt;
+  lv_vlist_refresh_row(vlist, 2);
+  TEST_ASSERT_EQUAL(bind_cnt_start + 1, bind_cnt);
+  lv_vlist_refresh_row(vlist, 3000);
+  TEST_ASSERT_EQUAL(bind_cnt_start + 1, bind_cnt);
+
+  /*Less rows*/
+  lv_vlist_scroll_to_row(vlist, 4000, LV_ANIM_OFF);
+  lv_vlist_set_row_cnt(vlist, 3);
+  TEST_ASSERT_EQUAL(0, lv_vlist_get_scroll_y(vlist));
+  TEST_ASSERT_EQUAL(120, lv_vlist_get_content_height(vlist));
+  TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, 2));
+  TEST_ASSERT_NULL(lv_vlist_get_row(vlist, 3));
+  TEST_ASSERT_LESS_OR_EQUAL(0, lv_obj_get_scroll_bottom(vlist));
+
+  lv_obj_del(vlist);
+}
+
+#endif
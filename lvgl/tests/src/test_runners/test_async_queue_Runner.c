@@ -0,0 +1,107 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "lv_test_init.h"
+#include "../lvgl.h"
+#include <pthread.h>
+#include <sched.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_async_queue_coalesce(void);
+extern void test_async_queue_order(void);
+extern void test_async_queue_full(void);
+extern void test_async_queue_delete(void);
+extern void test_async_queue_remove_series(void);
+extern void test_async_queue_threads(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Setup (stub)=====*/
+void setUp(void) {}
+
+/*=======Teardown (stub)=====*/
+void tearDown(void) {}
+
+/*=======Suite Setup=====*/
+void suiteSetUp(void)
+{
+lv_test_init();
+}
+
+/*=======Suite Teardown=====*/
+int suiteTearDown(int num_failures)
+{
+lv_test_deinit();return num_failures;
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  suiteSetUp();
+  UnityBegin("./src/test_cases/test_async_queue.c");
+  run_test(test_async_queue_coalesce, "test_async_queue_coalesce", 8);
+  run_test(test_async_queue_order, "test_async_queue_order", 9);
+  run_test(test_async_queue_full, "test_async_queue_full", 10);
+  run_test(test_async_queue_delete, "test_async_queue_delete", 11);
+  run_test(test_async_queue_remove_series, "test_async_queue_remove_series", 12);
+  run_test(test_async_queue_threads, "test_async_queue_threads", 13);
+
+  return suiteTearDown(UnityEnd());
+}
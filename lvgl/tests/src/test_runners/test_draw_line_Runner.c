@@ -0,0 +1,101 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "lv_test_init.h"
+#include "../lvgl.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_draw_polyline_miter_join(void);
+extern void test_draw_polyline_round_join(void);
+extern void test_draw_polyline_blend_once(void);
+extern void test_draw_polyline_long(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Setup (stub)=====*/
+void setUp(void) {}
+
+/*=======Teardown (stub)=====*/
+void tearDown(void) {}
+
+/*=======Suite Setup=====*/
+void suiteSetUp(void)
+{
+lv_test_init();
+}
+
+/*=======Suite Teardown=====*/
+int suiteTearDown(int num_failures)
+{
+lv_test_deinit();return num_failures;
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        setUp();
+        func();
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  suiteSetUp();
+  UnityBegin("./src/test_cases/test_draw_line.c");
+  run_test(test_draw_polyline_miter_join, "test_draw_polyline_miter_join", 6);
+  run_test(test_draw_polyline_round_join, "test_draw_polyline_round_join", 7);
+  run_test(test_draw_polyline_blend_once, "test_draw_polyline_blend_once", 8);
+  run_test(test_draw_polyline_long, "test_draw_polyline_long", 9);
+
+  return suiteTearDown(UnityEnd());
+}
@@ -1,11 +1,16 @@
 #include "lvgl/lvgl.h"
 #include "lv_drivers/display/fbdev.h"
+#include "lv_drivers/display/flush_thread.h"
 #include "lv_drivers/indev/evdev.h"
 #include "lv_demos/lv_demo.h"
 #include <unistd.h>
 #include <pthread.h>
 #include <time.h>
 #include <sys/time.h>
+#if USE_EVDEV && EVDEV_THREAD
+#include <poll.h>
+#include <sys/eventfd.h>
+#endif
 
 #define DISP_BUF_SIZE (128 * 1024)
 
@@ -22,34 +27,73 @@ int main(void)
 
     /*Initialize a descriptor for the buffer*/
     static lv_disp_draw_buf_t disp_buf;
+#if USE_FLUSH_THREAD
+    /*Draw into the second buffer while the first one is copied to the frame buffer*/
+    static lv_color_t buf2[DISP_BUF_SIZE];
+    lv_disp_draw_buf_init(&disp_buf, buf, buf2, DISP_BUF_SIZE);
+#else
     lv_disp_draw_buf_init(&disp_buf, buf, NULL, DISP_BUF_SIZE);
+#endif
 
     /*Initialize and register a display driver*/
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf   = &disp_buf;
     disp_drv.flush_cb   = fbdev_flush;
+    disp_drv.copy_cb    = fbdev_copy;
+#if USE_FLUSH_THREAD
+    disp_drv.wait_cb    = flush_thread_wait;
+#endif
     disp_drv.hor_res    = 1024;
     disp_drv.ver_res    = 600;
+    /*For a rotated panel set e.g. `disp_drv.rotated = LV_DISP_ROT_90` and keep `sw_rotate = 0`.
+     *`fbdev_flush` rotates the areas while writing them to the frame buffer.*/
     lv_disp_drv_register(&disp_drv);
 
-#if USE_EVDEV
+#if USE_EVDEV && EVDEV_HOTPLUG
+    /*An input device for every touchscreen, mouse, encoder and keyboard, also for the ones plugged in later*/
+    evdev_hotplug_init();
+#elif USE_EVDEV
 	evdev_init();
 	
 	static lv_indev_drv_t indev_drv;
-    lv_indev_drv_init(&indev_drv);
-    indev_drv.type = LV_INDEV_TYPE_POINTER;
-    indev_drv.read_cb = evdev_read;
+    /*Pinch and rotate with two fingers. The jitter is smoothed with the EVDEV_FILTER_... settings*/
+    evdev_indev_drv_init(&indev_drv, LV_INDEV_TYPE_MULTI_POINTER);
     lv_indev_drv_register(&indev_drv);
 #endif
 
     /*Create a Demo*/
     lv_demo_widgets();
 
+#if USE_EVDEV && EVDEV_THREAD
+    /*The input thread signals this fd when new samples arrive*/
+    struct pollfd wake;
+    wake.fd = evdev_get_wake_fd();
+    wake.events = POLLIN;
+#endif
+
     /*Handle LitlevGL tasks (tickless mode)*/
     while(1) {
+#if USE_EVDEV && EVDEV_THREAD
+        uint32_t idle_ms = lv_task_handler();
+        if(idle_ms > 5) idle_ms = 5;
+
+        /*Sleep until the next timer or until new input arrives and process it immediately*/
+        if(poll(&wake, 1, idle_ms) > 0) {
+            eventfd_t cnt;
+            eventfd_read(wake.fd, &cnt);
+
+            /*The fd is shared by the devices so read all of them*/
+            lv_indev_t * indev = lv_indev_get_next(NULL);
+            while(indev) {
+                lv_timer_ready(indev->driver->read_timer);
+                indev = lv_indev_get_next(indev);
+            }
+        }
+#else
         lv_task_handler();
         usleep(5000);
+#endif
     }
 
     return 0;